@@ -31,6 +31,8 @@ find_package(PkgConfig)
 
 option(OTBR_DOC "Build documentation" OFF)
 
+option(OTBR_BENCHMARKS "Build microbenchmarks" OFF)
+
 option(OTBR_BORDER_AGENT "Enable Border Agent" ON)
 if (OTBR_BORDER_AGENT)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_BORDER_AGENT=1)
@@ -172,9 +174,23 @@ else()
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_POWER_CALIBRATION=0)
 endif()
 
+option(OTBR_EPOLL "Use epoll as the mainloop event backend on Linux" ON)
+if (OTBR_EPOLL AND CMAKE_SYSTEM_NAME STREQUAL "Linux")
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_EPOLL=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_EPOLL=0)
+endif()
+
 option(OTBR_DNSSD_PLAT "Enable OTBR DNS-SD platform implementation" OFF)
 if (OTBR_DNSSD_PLAT)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DNSSD_PLAT=1)
 else()
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DNSSD_PLAT=0)
 endif()
+
+option(OTBR_MDNS_SHARE_CONNECTION "Share one mDNSResponder connection among all DNS-SD operations" OFF)
+if (OTBR_MDNS_SHARE_CONNECTION)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MDNS_SHARE_CONNECTION=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MDNS_SHARE_CONNECTION=0)
+endif()
@@ -117,7 +117,8 @@ void Application::Deinit(void)
 
 otbrError Application::Run(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError             error = OTBR_ERROR_NONE;
+    otbr::MainloopContext mainloop;
 
 #ifdef HAVE_LIBSYSTEMD
     if (getenv("SYSTEMD_EXEC_PID") != nullptr)
@@ -149,8 +150,7 @@ otbrError Application::Run(void)
 
     while (!sShouldTerminate)
     {
-        otbr::MainloopContext mainloop;
-        int                   rval;
+        int rval;
 
         mainloop.mMaxFd   = -1;
         mainloop.mTimeout = kPollTimeout;
@@ -161,8 +161,7 @@ otbrError Application::Run(void)
 
         MainloopManager::GetInstance().Update(mainloop);
 
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      &mainloop.mTimeout);
+        rval = MainloopManager::GetInstance().Poll(mainloop);
 
         if (rval >= 0)
         {
@@ -180,7 +179,7 @@ otbrError Application::Run(void)
         else if (errno != EINTR)
         {
             error = OTBR_ERROR_ERRNO;
-            otbrLogErr("select() failed: %s", strerror(errno));
+            otbrLogErr("Mainloop poll failed: %s", strerror(errno));
             break;
         }
     }
@@ -188,6 +187,16 @@ otbrError Application::Run(void)
     return error;
 }
 
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+void Application::SetSrpMaxInFlightUpdates(uint16_t aMaxInFlightUpdates)
+{
+    if (mAdvertisingProxy != nullptr)
+    {
+        mAdvertisingProxy->SetMaxInFlightUpdates(aMaxInFlightUpdates);
+    }
+}
+#endif
+
 void Application::HandleSignal(int aSignal)
 {
     sShouldTerminate = true;
@@ -280,7 +289,11 @@ void Application::InitRcpMode(void)
     mRestWebServer->Init();
 #endif
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent->Init(*mBorderAgent);
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mDBusAgent->Init(*mBorderAgent, mAdvertisingProxy.get());
+#else
+    mDBusAgent->Init(*mBorderAgent, /* aAdvertisingProxy */ nullptr);
+#endif
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
     mVendorServer->Init();
@@ -320,7 +333,7 @@ void Application::InitNcpMode(void)
     mPublisher->Start();
 #endif
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent->Init(*mBorderAgent);
+    mDBusAgent->Init(*mBorderAgent, /* aAdvertisingProxy */ nullptr);
 #endif
 }
 
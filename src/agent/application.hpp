@@ -128,6 +128,29 @@ public:
      */
     void SetErrorCondition(ErrorCondition aErrorCondition) { mErrorCondition = aErrorCondition; }
 
+#if OTBR_ENABLE_MDNS
+    /**
+     * This method sets the window within which updates of an mDNS registration are coalesced.
+     *
+     * It applies to all the registrations of the application, including those of the Border Agent and the
+     * Advertising Proxy.
+     *
+     * @param[in] aWindow  The coalescing window. Zero publishes every update immediately.
+     */
+    void SetMdnsUpdateCoalescingWindow(Milliseconds aWindow) { mPublisher->SetUpdateCoalescingWindow(aWindow); }
+#endif
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This method sets the max number of SRP updates which the Advertising Proxy publishes at the same time.
+     *
+     * It has no effect with an NCP, which advertises SRP updates itself.
+     *
+     * @param[in] aMaxInFlightUpdates  The max number of in-flight SRP updates, or 0 for no limit.
+     */
+    void SetSrpMaxInFlightUpdates(uint16_t aMaxInFlightUpdates);
+#endif
+
     /**
      * This method runs the application until exit.
      *
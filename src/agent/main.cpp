@@ -68,6 +68,14 @@ static const char kDefaultInterfaceName[] = DEFAULT_INTERFACE_NAME;
 static const uint32_t kPortNumber = 8081;
 #define HELP_DEFAULT_REST_PORT_NUMBER "8081"
 
+// Window within which updates of an mDNS registration are coalesced, in milliseconds.
+static const uint32_t kMdnsCoalescingWindow = 0;
+#define HELP_DEFAULT_MDNS_COALESCING_WINDOW "0"
+
+// Max number of SRP updates which are being advertised at the same time, 0 for no limit.
+static const uint32_t kSrpMaxInFlightUpdates = 16;
+#define HELP_DEFAULT_SRP_MAX_IN_FLIGHT_UPDATES "16"
+
 enum
 {
     OTBR_OPT_BACKBONE_INTERFACE_NAME = 'B',
@@ -82,6 +90,8 @@ enum
     OTBR_OPT_AUTO_ATTACH,
     OTBR_OPT_REST_LISTEN_ADDR,
     OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_MDNS_COALESCING_WINDOW,
+    OTBR_OPT_SRP_MAX_IN_FLIGHT_UPDATES,
 };
 
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
@@ -102,6 +112,8 @@ static const struct option kOptions[] = {
     {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
     {"rest-listen-address", required_argument, nullptr, OTBR_OPT_REST_LISTEN_ADDR},
     {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"mdns-coalescing-window", required_argument, nullptr, OTBR_OPT_MDNS_COALESCING_WINDOW},
+    {"srp-max-in-flight-updates", required_argument, nullptr, OTBR_OPT_SRP_MAX_IN_FLIGHT_UPDATES},
     {0, 0, 0, 0}};
 
 static bool ParseInteger(const char *aStr, long &aOutResult)
@@ -160,6 +172,10 @@ static void PrintHelp(const char *aProgramName)
             "     --rest-listen-address  Network address to listen on for the REST API (default: [::]).\n"
             "     --rest-listen-port     Network port to listen on for the REST API "
             "(default: " HELP_DEFAULT_REST_PORT_NUMBER ").\n"
+            "     --mdns-coalescing-window  Milliseconds within which updates of an mDNS registration are coalesced "
+            "(default: " HELP_DEFAULT_MDNS_COALESCING_WINDOW ").\n"
+            "     --srp-max-in-flight-updates  Max number of SRP updates advertised at the same time, 0 for no limit "
+            "(default: " HELP_DEFAULT_SRP_MAX_IN_FLIGHT_UPDATES ").\n"
             "\n",
             aProgramName);
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
@@ -220,14 +236,16 @@ static int realmain(int argc, char *argv[])
 {
     otbrLogLevel              logLevel = GetDefaultLogLevel();
     int                       opt;
-    int                       ret               = EXIT_SUCCESS;
-    const char               *interfaceName     = kDefaultInterfaceName;
-    bool                      verbose           = false;
-    bool                      syslogDisable     = false;
-    bool                      printRadioVersion = false;
-    bool                      enableAutoAttach  = true;
-    const char               *restListenAddress = "";
-    int                       restListenPort    = kPortNumber;
+    int                       ret                   = EXIT_SUCCESS;
+    const char               *interfaceName         = kDefaultInterfaceName;
+    bool                      verbose               = false;
+    bool                      syslogDisable         = false;
+    bool                      printRadioVersion     = false;
+    bool                      enableAutoAttach      = true;
+    const char               *restListenAddress     = "";
+    int                       restListenPort        = kPortNumber;
+    long                      mdnsCoalescingWindow  = kMdnsCoalescingWindow;
+    long                      srpMaxInFlightUpdates = kSrpMaxInFlightUpdates;
     std::vector<const char *> radioUrls;
     std::vector<const char *> backboneInterfaceNames;
     long                      parseResult;
@@ -295,6 +313,18 @@ static int realmain(int argc, char *argv[])
             restListenPort = parseResult;
             break;
 
+        case OTBR_OPT_MDNS_COALESCING_WINDOW:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(parseResult >= 0, ret = EXIT_FAILURE);
+            mdnsCoalescingWindow = parseResult;
+            break;
+
+        case OTBR_OPT_SRP_MAX_IN_FLIGHT_UPDATES:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(parseResult >= 0 && parseResult <= UINT16_MAX, ret = EXIT_FAILURE);
+            srpMaxInFlightUpdates = parseResult;
+            break;
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -341,6 +371,12 @@ static int realmain(int argc, char *argv[])
         otbr::Application app(*host, interfaceName, backboneInterfaceName, restListenAddress, restListenPort);
 
         gApp = &app;
+#if OTBR_ENABLE_MDNS
+        app.SetMdnsUpdateCoalescingWindow(otbr::Milliseconds(mdnsCoalescingWindow));
+#endif
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+        app.SetSrpMaxInFlightUpdates(static_cast<uint16_t>(srpMaxInFlightUpdates));
+#endif
         app.Init();
 #if __linux__
         app.SetErrorCondition(errorCondition);
@@ -249,7 +249,9 @@ exit:
     return error;
 }
 
-void MdnsPublisher::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+void MdnsPublisher::UnpublishServiceImpl(const std::string &aName,
+                                         const std::string &aType,
+                                         ResultCallback   &&aCallback)
 {
     NsdServiceRegistration *serviceRegistration =
         static_cast<NsdServiceRegistration *>(FindServiceRegistration(aName, aType));
@@ -325,7 +327,7 @@ otbrError MdnsPublisher::PublishKeyImpl(const std::string &aName, const KeyData
     return OTBR_ERROR_MDNS;
 }
 
-void MdnsPublisher::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+void MdnsPublisher::UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     NsdHostRegistration *hostRegistration = static_cast<NsdHostRegistration *>(FindHostRegistration(aName));
 
@@ -344,7 +346,7 @@ exit:
     return;
 }
 
-void MdnsPublisher::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+void MdnsPublisher::UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     OTBR_UNUSED_VARIABLE(aName);
     OTBR_UNUSED_VARIABLE(aCallback);
@@ -352,11 +354,13 @@ void MdnsPublisher::UnpublishKey(const std::string &aName, ResultCallback &&aCal
     DieForNotImplemented(__func__);
 }
 
-void MdnsPublisher::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+otbrError MdnsPublisher::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
-    auto service = std::make_shared<ServiceSubscription>(aType, aInstanceName, *this, mNsdPublisher);
+    otbrError error   = OTBR_ERROR_NONE;
+    auto      service = std::make_shared<ServiceSubscription>(aType, aInstanceName, *this, mNsdPublisher);
 
-    VerifyOrExit(IsStarted(), otbrLogWarning("No platform mDNS implementation registered!"));
+    VerifyOrExit(IsStarted(), otbrLogWarning("No platform mDNS implementation registered!"),
+                 error = OTBR_ERROR_INVALID_STATE);
 
     mServiceSubscriptions.push_back(std::move(service));
 
@@ -372,10 +376,10 @@ void MdnsPublisher::SubscribeService(const std::string &aType, const std::string
         mServiceSubscriptions.back()->Resolve(aInstanceName, aType);
     }
 exit:
-    return;
+    return error;
 }
 
-void MdnsPublisher::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void MdnsPublisher::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -402,11 +406,13 @@ exit:
     return;
 }
 
-void MdnsPublisher::SubscribeHost(const std::string &aHostName)
+otbrError MdnsPublisher::SubscribeHostImpl(const std::string &aHostName)
 {
-    auto host = std::make_shared<HostSubscription>(aHostName, *this, mNsdPublisher, AllocateListenerId());
+    otbrError error = OTBR_ERROR_NONE;
+    auto      host  = std::make_shared<HostSubscription>(aHostName, *this, mNsdPublisher, AllocateListenerId());
 
-    VerifyOrExit(IsStarted(), otbrLogWarning("No platform mDNS implementation registered!"));
+    VerifyOrExit(IsStarted(), otbrLogWarning("No platform mDNS implementation registered!"),
+                 error = OTBR_ERROR_INVALID_STATE);
 
     mNsdPublisher->resolveHost(aHostName, CreateNsdResolveHostCallback(host), host->mListenerId);
     mHostSubscriptions.push_back(std::move(host));
@@ -414,10 +420,10 @@ void MdnsPublisher::SubscribeHost(const std::string &aHostName)
     otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mHostSubscriptions.size());
 
 exit:
-    return;
+    return error;
 }
 
-void MdnsPublisher::UnsubscribeHost(const std::string &aHostName)
+void MdnsPublisher::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList::iterator it;
 
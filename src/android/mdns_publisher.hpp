@@ -74,24 +74,11 @@ public:
         {
             mNsdPublisher->reset();
         }
+        AbortPendingUpdates();
     }
 
     bool IsStarted(void) const override { return mNsdPublisher != nullptr; }
 
-    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
-
-    void UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-
-    void UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
-
-    void SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-
-    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-
-    void SubscribeHost(const std::string &aHostName) override;
-
-    void UnsubscribeHost(const std::string &aHostName) override;
-
     class NsdStatusReceiver : public BnNsdStatusReceiver
     {
     public:
@@ -244,6 +231,20 @@ protected:
 
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
 
+    void UnpublishServiceImpl(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
+
+    void UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override;
+
+    void UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override;
+
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+
+    void UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+
+    otbrError SubscribeHostImpl(const std::string &aHostName) override;
+
+    void UnsubscribeHostImpl(const std::string &aHostName) override;
+
     void OnServiceResolveFailedImpl(const std::string &aType, const std::string &aInstanceName, int32_t aErrorCode);
 
     void OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode);
@@ -140,7 +140,8 @@ void OtDaemonServer::Init(void)
     mBorderAgent.SetEphemeralKeyEnabled(true);
     otSysUpstreamDnsServerSetResolvConfEnabled(false);
 
-    mTaskRunner.Post(kTelemetryCheckInterval, [this]() { PushTelemetryIfConditionMatch(); });
+    mTaskRunner.Post(
+        kTelemetryCheckInterval, [this]() { PushTelemetryIfConditionMatch(); }, kTelemetrySlack);
 }
 
 void OtDaemonServer::BinderDeathCallback(void *aBinderServer)
@@ -1304,7 +1305,8 @@ void OtDaemonServer::PushTelemetryIfConditionMatch()
     // TODO: Push telemetry per kTelemetryUploadIntervalThreshold instead of on startup.
     // TODO: Save unpushed telemetries in local cache to avoid data loss.
     RetrieveAndPushAtoms(GetOtInstance());
-    mTaskRunner.Post(kTelemetryUploadIntervalThreshold, [this]() { PushTelemetryIfConditionMatch(); });
+    mTaskRunner.Post(
+        kTelemetryUploadIntervalThreshold, [this]() { PushTelemetryIfConditionMatch(); }, kTelemetrySlack);
 
 exit:
     return;
@@ -81,8 +81,9 @@ private:
 
     // Implements MainloopProcessor
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "OtDaemonServer"; }
 
     // Creates AndroidThreadHost instance
     std::unique_ptr<AndroidThreadHost> CreateAndroidHost(void);
@@ -218,6 +219,7 @@ private:
 
     static constexpr Seconds kTelemetryCheckInterval           = Seconds(600);          // 600 seconds
     static constexpr Seconds kTelemetryUploadIntervalThreshold = Seconds(60 * 60 * 12); // 12 hours
+    static constexpr Seconds kTelemetrySlack                   = Seconds(60);           // 60 seconds
 };
 
 } // namespace Android
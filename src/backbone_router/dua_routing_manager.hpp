@@ -43,6 +43,7 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
+#include "common/worker_pool.hpp"
 #include "host/rcp_host.hpp"
 #include "utils/system_utils.hpp"
 
@@ -71,9 +72,15 @@ public:
         : mEnabled(false)
         , mInterfaceName(std::move(aInterfaceName))
         , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
+        , mCommandSequence(WorkerPool::GetInstance().CreateSequence())
     {
     }
 
+    /**
+     * This destructor destroys the DUA routing manager instance.
+     */
+    ~DuaRoutingManager(void) { WorkerPool::GetInstance().ReleaseSequence(mCommandSequence); }
+
     /**
      * This method enables the DUA routing manager.
      */
@@ -94,6 +101,9 @@ private:
     bool        mEnabled : 1;
     std::string mInterfaceName;
     std::string mBackboneInterfaceName;
+
+    // The `ip` commands are executed off the mainloop, in the order they are issued.
+    WorkerPool::SequenceId mCommandSequence;
 };
 
 /**
@@ -117,36 +117,6 @@ void NdProxyManager::Init(void)
     VerifyOrDie(mBackboneIfIndex > 0, "if_nametoindex failed");
 }
 
-void NdProxyManager::Update(MainloopContext &aMainloop)
-{
-    if (mIcmp6RawSock >= 0)
-    {
-        aMainloop.AddFdToReadSet(mIcmp6RawSock);
-    }
-
-    if (mUnicastNsQueueSock >= 0)
-    {
-        aMainloop.AddFdToReadSet(mUnicastNsQueueSock);
-    }
-}
-
-void NdProxyManager::Process(const MainloopContext &aMainloop)
-{
-    VerifyOrExit(IsEnabled());
-
-    if (FD_ISSET(mIcmp6RawSock, &aMainloop.mReadFdSet))
-    {
-        ProcessMulticastNeighborSolicition();
-    }
-
-    if (FD_ISSET(mUnicastNsQueueSock, &aMainloop.mReadFdSet))
-    {
-        ProcessUnicastNeighborSolicition();
-    }
-exit:
-    return;
-}
-
 void NdProxyManager::ProcessMulticastNeighborSolicition()
 {
     struct msghdr     msghdr;
@@ -397,6 +367,14 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
                  error = OTBR_ERROR_ERRNO);
+
+    error = MainloopManager::GetInstance().AddFd(mIcmp6RawSock, MainloopContext::kReadFdSet, [this](uint8_t) {
+        if (IsEnabled())
+        {
+            ProcessMulticastNeighborSolicition();
+        }
+    });
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -410,6 +388,7 @@ void NdProxyManager::FiniIcmp6RawSocket(void)
 {
     if (mIcmp6RawSock != -1)
     {
+        MainloopManager::GetInstance().RemoveFd(mIcmp6RawSock);
         close(mIcmp6RawSock);
         mIcmp6RawSock = -1;
     }
@@ -426,6 +405,13 @@ otbrError NdProxyManager::InitNetfilterQueue(void)
     VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, 88, HandleNetfilterQueue, this)) != nullptr);
     VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, 0xffff) >= 0);
     VerifyOrExit((mUnicastNsQueueSock = nfq_fd(mNfqHandler)) >= 0);
+    SuccessOrExit(MainloopManager::GetInstance().AddFd(mUnicastNsQueueSock, MainloopContext::kReadFdSet,
+                                                       [this](uint8_t) {
+                                                           if (IsEnabled())
+                                                           {
+                                                               ProcessUnicastNeighborSolicition();
+                                                           }
+                                                       }));
 
     error = OTBR_ERROR_NONE;
 
@@ -444,6 +430,7 @@ void NdProxyManager::FiniNetfilterQueue(void)
 {
     if (mUnicastNsQueueSock != -1)
     {
+        MainloopManager::GetInstance().RemoveFd(mUnicastNsQueueSock);
         close(mUnicastNsQueueSock);
         mUnicastNsQueueSock = -1;
     }
@@ -53,7 +53,7 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
-#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/types.hpp"
 #include "host/rcp_host.hpp"
 
@@ -72,7 +72,7 @@ namespace BackboneRouter {
 /**
  * This class implements ND Proxy manager.
  */
-class NdProxyManager : public MainloopProcessor, private NonCopyable
+class NdProxyManager : private NonCopyable
 {
 public:
     /**
@@ -105,9 +105,6 @@ public:
      */
     void Disable(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
-
     /**
      * This method handles a Backbone Router ND Proxy event.
      *
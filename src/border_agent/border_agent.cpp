@@ -44,6 +44,7 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <random>
 #include <sstream>
@@ -70,7 +71,7 @@
 #include "common/types.hpp"
 #include "utils/hex.hpp"
 
-#if !(OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO)
+#if !(OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO || OTBR_ENABLE_MDNS_NATIVE)
 #error "Border Agent feature requires at least one `OTBR_MDNS` implementation"
 #endif
 
@@ -412,21 +413,86 @@ static uint64_t ConvertTimestampToUint64(const otTimestamp &aTimestamp)
            static_cast<uint64_t>(aTimestamp.mAuthoritative);
 }
 
+/**
+ * This class writes the MeshCoP TXT entries directly into the TXT data.
+ *
+ * A vendor entry replaces the standard entry with the same key in place, and the other vendor
+ * entries are written after all standard entries.
+ */
+class MeshCopTxtEncoder
+{
+public:
+    MeshCopTxtEncoder(const std::map<std::string, std::vector<uint8_t>> &aVendorEntries,
+                      Mdns::Publisher::TxtData                          &aTxtData)
+        : mVendorEntries(aVendorEntries)
+        , mEncoder(aTxtData)
+        , mError(OTBR_ERROR_NONE)
+    {
+    }
+
+    void AppendEntry(const char *aKey, const uint8_t *aValue, size_t aValueLength)
+    {
+        auto vendorEntry = mVendorEntries.find(aKey);
+
+        if (vendorEntry != mVendorEntries.end())
+        {
+            mOverriddenKeys.push_back(&vendorEntry->first);
+            aValue       = vendorEntry->second.data();
+            aValueLength = vendorEntry->second.size();
+        }
+
+        UpdateError(mEncoder.AppendEntry(aKey, aValue, aValueLength));
+    }
+
+    void AppendEntry(const char *aKey, const char *aValue)
+    {
+        AppendEntry(aKey, reinterpret_cast<const uint8_t *>(aValue), strlen(aValue));
+    }
+
+    otbrError Finish(void)
+    {
+        for (const auto &entry : mVendorEntries)
+        {
+            if (std::find(mOverriddenKeys.begin(), mOverriddenKeys.end(), &entry.first) == mOverriddenKeys.end())
+            {
+                UpdateError(mEncoder.AppendEntry(entry.first.c_str(), entry.second.data(), entry.second.size()));
+            }
+        }
+
+        mEncoder.Finish();
+
+        return mError;
+    }
+
+private:
+    void UpdateError(otbrError aError)
+    {
+        if (mError == OTBR_ERROR_NONE)
+        {
+            mError = aError;
+        }
+    }
+
+    const std::map<std::string, std::vector<uint8_t>> &mVendorEntries;
+    Mdns::Publisher::TxtDataEncoder                    mEncoder;
+    std::vector<const std::string *>                   mOverriddenKeys;
+    otbrError                                          mError;
+};
+
 #if OTBR_ENABLE_BORDER_ROUTING
-void AppendOmrTxtEntry(otInstance &aInstance, Mdns::Publisher::TxtList &aTxtList)
+void AppendOmrTxtEntry(otInstance &aInstance, MeshCopTxtEncoder &aEncoder)
 {
     otIp6Prefix       omrPrefix;
     otRoutePreference preference;
 
     if (OT_ERROR_NONE == otBorderRoutingGetFavoredOmrPrefix(&aInstance, &omrPrefix, &preference))
     {
-        std::vector<uint8_t> omrData;
+        uint8_t omrData[1 + OT_IP6_PREFIX_SIZE];
+        uint8_t omrLength = (omrPrefix.mLength + 7) / 8;
 
-        omrData.reserve(1 + OT_IP6_PREFIX_SIZE);
-        omrData.push_back(omrPrefix.mLength);
-        std::copy(omrPrefix.mPrefix.mFields.m8, omrPrefix.mPrefix.mFields.m8 + (omrPrefix.mLength + 7) / 8,
-                  std::back_inserter(omrData));
-        aTxtList.emplace_back("omr", omrData.data(), omrData.size());
+        omrData[0] = omrPrefix.mLength;
+        memcpy(&omrData[1], omrPrefix.mPrefix.mFields.m8, omrLength);
+        aEncoder.AppendEntry("omr", omrData, 1 + omrLength);
     }
 }
 #endif
@@ -473,7 +539,7 @@ StateBitmap GetStateBitmap(otInstance &aInstance)
 }
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
-void AppendBbrTxtEntries(otInstance &aInstance, StateBitmap aState, Mdns::Publisher::TxtList &aTxtList)
+void AppendBbrTxtEntries(otInstance &aInstance, StateBitmap aState, MeshCopTxtEncoder &aEncoder)
 {
     if (aState.mBbrIsActive)
     {
@@ -481,15 +547,15 @@ void AppendBbrTxtEntries(otInstance &aInstance, StateBitmap aState, Mdns::Publis
         uint16_t               bbrPort = htobe16(BackboneRouter::BackboneAgent::kBackboneUdpPort);
 
         otBackboneRouterGetConfig(&aInstance, &bbrConfig);
-        aTxtList.emplace_back("sq", &bbrConfig.mSequenceNumber, sizeof(bbrConfig.mSequenceNumber));
-        aTxtList.emplace_back("bb", reinterpret_cast<const uint8_t *>(&bbrPort), sizeof(bbrPort));
+        aEncoder.AppendEntry("sq", &bbrConfig.mSequenceNumber, sizeof(bbrConfig.mSequenceNumber));
+        aEncoder.AppendEntry("bb", reinterpret_cast<const uint8_t *>(&bbrPort), sizeof(bbrPort));
     }
 
-    aTxtList.emplace_back("dn", otThreadGetDomainName(&aInstance));
+    aEncoder.AppendEntry("dn", otThreadGetDomainName(&aInstance));
 }
 #endif
 
-void AppendActiveTimestampTxtEntry(otInstance &aInstance, Mdns::Publisher::TxtList &aTxtList)
+void AppendActiveTimestampTxtEntry(otInstance &aInstance, MeshCopTxtEncoder &aEncoder)
 {
     otError              error;
     otOperationalDataset activeDataset;
@@ -503,33 +569,7 @@ void AppendActiveTimestampTxtEntry(otInstance &aInstance, Mdns::Publisher::TxtLi
         uint64_t activeTimestampValue = ConvertTimestampToUint64(activeDataset.mActiveTimestamp);
 
         activeTimestampValue = htobe64(activeTimestampValue);
-        aTxtList.emplace_back("at", reinterpret_cast<uint8_t *>(&activeTimestampValue), sizeof(activeTimestampValue));
-    }
-}
-
-void AppendVendorTxtEntries(const std::map<std::string, std::vector<uint8_t>> &aVendorEntries,
-                            Mdns::Publisher::TxtList                          &aTxtList)
-{
-    for (const auto &entry : aVendorEntries)
-    {
-        const std::string          &key   = entry.first;
-        const std::vector<uint8_t> &value = entry.second;
-        bool                        found = false;
-
-        for (auto &addedEntry : aTxtList)
-        {
-            if (addedEntry.mKey == key)
-            {
-                addedEntry.mValue              = value;
-                addedEntry.mIsBooleanAttribute = false;
-                found                          = true;
-                break;
-            }
-        }
-        if (!found)
-        {
-            aTxtList.emplace_back(key.c_str(), value.data(), value.size());
-        }
+        aEncoder.AppendEntry("at", reinterpret_cast<uint8_t *>(&activeTimestampValue), sizeof(activeTimestampValue));
     }
 }
 
@@ -541,8 +581,8 @@ void BorderAgent::PublishMeshCopService(void)
     const otExtendedPanId   *extPanId    = otThreadGetExtendedPanId(instance);
     const otExtAddress      *extAddr     = otLinkGetExtendedAddress(instance);
     const char              *networkName = otThreadGetNetworkName(instance);
-    Mdns::Publisher::TxtList txtList{{"rv", "1"}};
     Mdns::Publisher::TxtData txtData;
+    MeshCopTxtEncoder        encoder(mMeshCopTxtUpdate, txtData);
     int                      port;
     otbrError                error;
 
@@ -550,6 +590,8 @@ void BorderAgent::PublishMeshCopService(void)
 
     otbrLogInfo("Publish meshcop service %s.%s.local.", mServiceInstanceName.c_str(), kBorderAgentServiceType);
 
+    encoder.AppendEntry("rv", "1");
+
 #if OTBR_ENABLE_PUBLISH_MESHCOP_BA_ID
     {
         otError         error;
@@ -558,7 +600,7 @@ void BorderAgent::PublishMeshCopService(void)
         error = otBorderAgentGetId(instance, &id);
         if (error == OT_ERROR_NONE)
         {
-            txtList.emplace_back("id", id.mId, sizeof(id));
+            encoder.AppendEntry("id", id.mId, sizeof(id));
         }
         else
         {
@@ -569,45 +611,43 @@ void BorderAgent::PublishMeshCopService(void)
 
     if (!mVendorOui.empty())
     {
-        txtList.emplace_back("vo", mVendorOui.data(), mVendorOui.size());
+        encoder.AppendEntry("vo", mVendorOui.data(), mVendorOui.size());
     }
     if (!mVendorName.empty())
     {
-        txtList.emplace_back("vn", mVendorName.c_str());
+        encoder.AppendEntry("vn", mVendorName.c_str());
     }
     if (!mProductName.empty())
     {
-        txtList.emplace_back("mn", mProductName.c_str());
+        encoder.AppendEntry("mn", mProductName.c_str());
     }
-    txtList.emplace_back("nn", networkName);
-    txtList.emplace_back("xp", extPanId->m8, sizeof(extPanId->m8));
-    txtList.emplace_back("tv", mHost.GetThreadVersion());
+    encoder.AppendEntry("nn", networkName);
+    encoder.AppendEntry("xp", extPanId->m8, sizeof(extPanId->m8));
+    encoder.AppendEntry("tv", mHost.GetThreadVersion());
 
     // "xa" stands for Extended MAC Address (64-bit) of the Thread Interface of the Border Agent.
-    txtList.emplace_back("xa", extAddr->m8, sizeof(extAddr->m8));
+    encoder.AppendEntry("xa", extAddr->m8, sizeof(extAddr->m8));
     state                 = GetStateBitmap(*instance);
     state.mEpskcSupported = GetEphemeralKeyEnabled();
     stateUint32           = htobe32(state.ToUint32());
-    txtList.emplace_back("sb", reinterpret_cast<uint8_t *>(&stateUint32), sizeof(stateUint32));
+    encoder.AppendEntry("sb", reinterpret_cast<uint8_t *>(&stateUint32), sizeof(stateUint32));
 
     if (state.mThreadIfStatus == kThreadIfStatusActive)
     {
         uint32_t partitionId;
 
-        AppendActiveTimestampTxtEntry(*instance, txtList);
+        AppendActiveTimestampTxtEntry(*instance, encoder);
         partitionId = otThreadGetPartitionId(instance);
-        txtList.emplace_back("pt", reinterpret_cast<uint8_t *>(&partitionId), sizeof(partitionId));
+        encoder.AppendEntry("pt", reinterpret_cast<uint8_t *>(&partitionId), sizeof(partitionId));
     }
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    AppendBbrTxtEntries(*instance, state, txtList);
+    AppendBbrTxtEntries(*instance, state, encoder);
 #endif
 #if OTBR_ENABLE_BORDER_ROUTING
-    AppendOmrTxtEntry(*instance, txtList);
+    AppendOmrTxtEntry(*instance, encoder);
 #endif
 
-    AppendVendorTxtEntries(mMeshCopTxtUpdate, txtList);
-
     if (otBorderAgentIsActive(instance))
     {
         port = otBorderAgentGetUdpPort(instance);
@@ -621,7 +661,7 @@ void BorderAgent::PublishMeshCopService(void)
         port = kBorderAgentServiceDummyPort;
     }
 
-    error = Mdns::Publisher::EncodeTxtData(txtList, txtData);
+    error = encoder.Finish();
     assert(error == OTBR_ERROR_NONE);
 
     mPublisher.PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentServiceType,
@@ -31,9 +31,10 @@
 
 #include "openthread-br/config.h"
 
-#include <functional>
 #include <type_traits>
 
+#include "common/inline_function.hpp"
+
 namespace otbr {
 
 template <class T> class OnceCallback;
@@ -42,6 +43,7 @@ template <class T> class OnceCallback;
  * A callback which can be invoked at most once.
  *
  * IsNull is guaranteed to return true once the callback has been invoked.
+ * The callable is kept in an InlineFunction, so it doesn't need to be copyable.
  *
  * Example usage:
  *  OnceCallback<int(int)> square([](int x) { return x * x; });
@@ -99,10 +101,10 @@ public:
         return cb.mFunc(std::forward<Args>(aArgs)...);
     }
 
-    bool IsNull() const { return mFunc == nullptr; }
+    bool IsNull() const { return !mFunc; }
 
 private:
-    std::function<R(Args...)> mFunc;
+    InlineFunction<R(Args...)> mFunc;
 };
 
 } // namespace otbr
@@ -28,65 +28,184 @@
 
 #include "common/dns_utils.hpp"
 
+#include <algorithm>
+
 #include <assert.h>
+#include <ctype.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 
-static bool NameEndsWithDot(const std::string &aName)
+static const char   kUdpTransport[]  = "._udp.";
+static const char   kTcpTransport[]  = "._tcp.";
+static const size_t kTransportLength = sizeof(kUdpTransport) - 1;
+static const size_t kNotFound        = static_cast<size_t>(-1);
+
+// Returns the character at @p aIndex of the name as if the name always ends with a dot.
+static char CharAtDotTerminated(const DnsNameSpan &aName, size_t aIndex)
 {
-    return !aName.empty() && aName.back() == '.';
+    return aIndex < aName.mLength ? aName.mData[aIndex] : '.';
 }
 
-DnsNameInfo SplitFullDnsName(const std::string &aName)
+static size_t FindLastTransport(const DnsNameSpan &aName, size_t aLength, const char *aTransport)
 {
-    size_t      transportPos;
-    DnsNameInfo nameInfo;
-    std::string fullName = aName;
+    size_t pos = kNotFound;
 
-    if (!NameEndsWithDot(fullName))
+    for (size_t start = aLength; start >= kTransportLength; start--)
     {
-        fullName += '.';
+        size_t i = 0;
+
+        while (i < kTransportLength && CharAtDotTerminated(aName, start - kTransportLength + i) == aTransport[i])
+        {
+            i++;
+        }
+
+        if (i == kTransportLength)
+        {
+            pos = start - kTransportLength;
+            break;
+        }
     }
 
-    transportPos = fullName.rfind("._udp.");
+    return pos;
+}
+
+static DnsNameSpan TrimTrailingDot(const DnsNameSpan &aName)
+{
+    return DnsNameSpan(aName.mData, aName.EndsWithDot() ? aName.mLength - 1 : aName.mLength);
+}
+
+DnsNameSpan::DnsNameSpan(const char *aString)
+    : DnsNameSpan(aString, strlen(aString))
+{
+}
+
+bool DnsNameSpan::EqualsCaseInsensitive(const DnsNameSpan &aOther) const
+{
+    return mLength == aOther.mLength && CompareDnsNames(*this, aOther) == 0;
+}
+
+int CompareDnsNames(const DnsNameSpan &aName1, const DnsNameSpan &aName2)
+{
+    size_t length = aName1.mLength < aName2.mLength ? aName1.mLength : aName2.mLength;
+    int    result = 0;
+
+    for (size_t i = 0; i < length && result == 0; i++)
+    {
+        result = tolower(static_cast<unsigned char>(aName1.mData[i])) -
+                 tolower(static_cast<unsigned char>(aName2.mData[i]));
+    }
+
+    if (result == 0)
+    {
+        result = (aName1.mLength < aName2.mLength) ? -1 : (aName1.mLength > aName2.mLength ? 1 : 0);
+    }
+
+    return result;
+}
+
+DnsNameView ParseFullDnsName(const DnsNameSpan &aName)
+{
+    // The name is parsed as if it ends with a dot, which is appended virtually when missing.
+    size_t      length = aName.EndsWithDot() ? aName.mLength : aName.mLength + 1;
+    size_t      transportPos;
+    DnsNameView nameView;
+
+    transportPos = FindLastTransport(aName, length, kUdpTransport);
 
-    if (transportPos == std::string::npos)
+    if (transportPos == kNotFound)
     {
-        transportPos = fullName.rfind("._tcp.");
+        transportPos = FindLastTransport(aName, length, kTcpTransport);
     }
 
-    if (transportPos == std::string::npos)
+    if (transportPos == kNotFound)
     {
         // host.domain or domain
-        size_t dotPos = fullName.find_first_of('.');
+        size_t dotPos = 0;
 
-        assert(dotPos != std::string::npos);
+        while (CharAtDotTerminated(aName, dotPos) != '.')
+        {
+            dotPos++;
+        }
 
         // host.domain
-        nameInfo.mHostName = fullName.substr(0, dotPos);
-        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+        nameView.mHostName = DnsNameSpan(aName.mData, dotPos);
+
+        if (dotPos < aName.mLength)
+        {
+            nameView.mDomain = DnsNameSpan(aName.mData + dotPos + 1, aName.mLength - dotPos - 1);
+        }
+        else
+        {
+            nameView.mDomain = DnsNameSpan(aName.mData + aName.mLength, 0);
+        }
     }
     else
     {
         // service or service instance
-        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+        size_t dotPos       = transportPos;
+        size_t domainOffset = std::min(transportPos + kTransportLength, aName.mLength);
 
-        nameInfo.mDomain = fullName.substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
+        while (dotPos > 0 && aName.mData[dotPos - 1] != '.')
+        {
+            dotPos--;
+        }
 
-        if (dotPos == std::string::npos)
+        nameView.mDomain = DnsNameSpan(aName.mData + domainOffset, aName.mLength - domainOffset);
+
+        if (dotPos == 0)
         {
             // service.domain
-            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
+            nameView.mServiceName = DnsNameSpan(aName.mData, transportPos + kTransportLength - 1);
         }
         else
         {
             // instance.service.domain
-            nameInfo.mInstanceName = fullName.substr(0, dotPos);
-            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+            nameView.mInstanceName = DnsNameSpan(aName.mData, dotPos - 1);
+            nameView.mServiceName  = DnsNameSpan(aName.mData + dotPos, transportPos + kTransportLength - 1 - dotPos);
         }
     }
 
-    if (!NameEndsWithDot(nameInfo.mDomain))
+    return nameView;
+}
+
+otbrError RewriteDnsDomain(const DnsNameSpan &aName,
+                           const DnsNameSpan &aFromDomain,
+                           const DnsNameSpan &aToDomain,
+                           char              *aBuffer,
+                           size_t             aBufferSize)
+{
+    otbrError   error    = OTBR_ERROR_NONE;
+    DnsNameView nameView = ParseFullDnsName(aName);
+    DnsNameSpan toDomain = TrimTrailingDot(aToDomain);
+    size_t      length   = nameView.mHostName.mLength + 1 + toDomain.mLength + 1;
+
+    VerifyOrExit(nameView.IsHost(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(TrimTrailingDot(nameView.mDomain).EqualsCaseInsensitive(TrimTrailingDot(aFromDomain)),
+                 error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(length < aBufferSize, error = OTBR_ERROR_INVALID_ARGS);
+
+    memcpy(aBuffer, nameView.mHostName.mData, nameView.mHostName.mLength);
+    aBuffer[nameView.mHostName.mLength] = '.';
+    memcpy(aBuffer + nameView.mHostName.mLength + 1, toDomain.mData, toDomain.mLength);
+    aBuffer[length - 1] = '.';
+    aBuffer[length]     = '\0';
+
+exit:
+    return error;
+}
+
+DnsNameInfo SplitFullDnsName(const std::string &aName)
+{
+    DnsNameView nameView = ParseFullDnsName(DnsNameSpan(aName));
+    DnsNameInfo nameInfo;
+
+    nameInfo.mInstanceName = nameView.mInstanceName.ToString();
+    nameInfo.mServiceName  = nameView.mServiceName.ToString();
+    nameInfo.mHostName     = nameView.mHostName.ToString();
+    nameInfo.mDomain       = nameView.mDomain.ToString();
+
+    if (!nameView.mDomain.EndsWithDot())
     {
         nameInfo.mDomain += '.';
     }
@@ -35,8 +35,119 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
+
+#include <string>
+
 #include "common/types.hpp"
 
+/**
+ * This structure represents a range of characters within a DNS name.
+ *
+ * The span doesn't own the characters, so the DNS name must outlive it.
+ */
+struct DnsNameSpan
+{
+    /**
+     * This constructor initializes an empty span.
+     */
+    DnsNameSpan(void) = default;
+
+    /**
+     * This constructor initializes the span with the given characters.
+     *
+     * @param[in] aData    A pointer to the first character.
+     * @param[in] aLength  The number of characters.
+     */
+    DnsNameSpan(const char *aData, size_t aLength)
+        : mData(aData)
+        , mLength(aLength)
+    {
+    }
+
+    /**
+     * This constructor initializes the span with a null-terminated string.
+     *
+     * @param[in] aString  A pointer to the null-terminated string.
+     */
+    explicit DnsNameSpan(const char *aString);
+
+    /**
+     * This constructor initializes the span with the characters of a string.
+     *
+     * @param[in] aString  A reference to the string.
+     */
+    explicit DnsNameSpan(const std::string &aString)
+        : DnsNameSpan(aString.data(), aString.size())
+    {
+    }
+
+    /**
+     * This method returns if the span is empty.
+     *
+     * @returns Whether the span is empty.
+     */
+    bool IsEmpty(void) const { return mLength == 0; }
+
+    /**
+     * This method returns if the span ends with a dot.
+     *
+     * @returns Whether the last character of the span is a dot.
+     */
+    bool EndsWithDot(void) const { return mLength > 0 && mData[mLength - 1] == '.'; }
+
+    /**
+     * This method copies the characters of the span into a string.
+     *
+     * @returns The string of the span.
+     */
+    std::string ToString(void) const { return std::string(mData, mLength); }
+
+    /**
+     * This method compares the span with another one in a case-insensitive manner.
+     *
+     * @param[in] aOther  The span to compare with.
+     *
+     * @returns Whether the two spans are equal in a case-insensitive manner.
+     */
+    bool EqualsCaseInsensitive(const DnsNameSpan &aOther) const;
+
+    /**
+     * This method compares the span with a string in a case-insensitive manner.
+     *
+     * @param[in] aString  The string to compare with.
+     *
+     * @returns Whether the span and @p aString are equal in a case-insensitive manner.
+     */
+    bool EqualsCaseInsensitive(const std::string &aString) const { return EqualsCaseInsensitive(DnsNameSpan(aString)); }
+
+    const char *mData   = ""; ///< The first character.
+    size_t      mLength = 0;  ///< The number of characters.
+};
+
+/**
+ * This function compares two DNS names in a case-insensitive manner.
+ *
+ * @param[in] aName1  The first DNS name.
+ * @param[in] aName2  The second DNS name.
+ *
+ * @returns A negative value, zero or a positive value if @p aName1 orders before, equals or orders after @p aName2.
+ */
+int CompareDnsNames(const DnsNameSpan &aName1, const DnsNameSpan &aName2);
+
+/**
+ * This structure orders DNS names in a case-insensitive manner.
+ *
+ * It allows containers to be keyed by DNS names without lowercase copies of the names.
+ */
+struct DnsNameLess
+{
+    bool operator()(const std::string &aName1, const std::string &aName2) const
+    {
+        return CompareDnsNames(DnsNameSpan(aName1), DnsNameSpan(aName2)) < 0;
+    }
+};
+
 /**
  * This structure represents DNS Name information.
  *
@@ -71,6 +182,73 @@ struct DnsNameInfo
     bool IsHost(void) const { return mServiceName.empty(); }
 };
 
+/**
+ * This structure represents the components of a DNS name as spans of the name.
+ *
+ * @sa ParseFullDnsName
+ */
+struct DnsNameView
+{
+    DnsNameSpan mInstanceName; ///< Instance name, or empty if the DNS name is not a service instance.
+    DnsNameSpan mServiceName;  ///< Service name, or empty if the DNS name is not a service or service instance.
+    DnsNameSpan mHostName;     ///< Host name, or empty if the DNS name is not a host name.
+    DnsNameSpan mDomain;       ///< Domain name, which ends with a dot only if the full DNS name does.
+
+    /**
+     * This method returns if the DNS name is a service instance.
+     *
+     * @returns Whether the DNS name is a service instance.
+     */
+    bool IsServiceInstance(void) const { return !mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a service.
+     *
+     * @returns Whether the DNS name is a service.
+     */
+    bool IsService(void) const { return !mServiceName.IsEmpty() && mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a host.
+     *
+     * @returns Whether the DNS name is a host.
+     */
+    bool IsHost(void) const { return mServiceName.IsEmpty(); }
+};
+
+/**
+ * This function parses a full DNS name into name components without copying any characters.
+ *
+ * @param[in] aName  The full DNS name to parse, which must outlive the returned spans.
+ *
+ * @returns A `DnsNameView` structure containing the spans of the name components.
+ *
+ * @sa SplitFullDnsName
+ */
+DnsNameView ParseFullDnsName(const DnsNameSpan &aName);
+
+/**
+ * This function rewrites the domain of a full host name into a buffer.
+ *
+ * For example, "host.local." is rewritten to "host.default.service.arpa." when @p aFromDomain is "local." and
+ * @p aToDomain is "default.service.arpa.". The result always ends with a dot.
+ *
+ * @param[in]  aName        The full host name.
+ * @param[in]  aFromDomain  The domain to replace, the trailing dot is optional.
+ * @param[in]  aToDomain    The domain to replace with, the trailing dot is optional.
+ * @param[out] aBuffer      A pointer to the buffer to receive the null-terminated result.
+ * @param[in]  aBufferSize  The size of @p aBuffer.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully rewrote the domain.
+ * @retval OTBR_ERROR_NOT_FOUND     If @p aName is not a host name within @p aFromDomain.
+ * @retval OTBR_ERROR_INVALID_ARGS  If @p aBuffer is too small for the result.
+ */
+otbrError RewriteDnsDomain(const DnsNameSpan &aName,
+                           const DnsNameSpan &aFromDomain,
+                           const DnsNameSpan &aToDomain,
+                           char              *aBuffer,
+                           size_t             aBufferSize);
+
 /**
  * This method splits a full DNS name into name components.
  *
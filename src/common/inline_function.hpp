@@ -0,0 +1,275 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a move-only callable with inline storage.
+ */
+
+#ifndef OTBR_COMMON_INLINE_FUNCTION_HPP_
+#define OTBR_COMMON_INLINE_FUNCTION_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace otbr {
+
+/**
+ * The default inline capacity (in bytes) of an InlineFunction.
+ *
+ * This is large enough for a lambda capturing a receiver pointer and two `std::string` values.
+ */
+constexpr size_t kInlineFunctionCapacity = 10 * sizeof(void *);
+
+/**
+ * This class includes the states shared by all InlineFunction types.
+ */
+class InlineFunctionBase
+{
+public:
+    /**
+     * This method returns how many callables have been stored on the heap because they
+     * don't fit in the inline storage of an InlineFunction.
+     *
+     * @returns The number of heap fallbacks since the program started.
+     */
+    static uint64_t GetHeapFallbackCount(void) { return HeapFallbackCounter().load(std::memory_order_relaxed); }
+
+protected:
+    static std::atomic<uint64_t> &HeapFallbackCounter(void)
+    {
+        static std::atomic<uint64_t> sHeapFallbackCounter{0};
+
+        return sHeapFallbackCounter;
+    }
+};
+
+template <typename Signature, size_t Capacity = kInlineFunctionCapacity> class InlineFunction;
+
+/**
+ * A move-only function wrapper which stores the callable in place.
+ *
+ * Unlike `std::function`, the callable doesn't need to be copyable, and a callable which is
+ * no larger than @p Capacity bytes is stored without any heap allocation. Whether a callable
+ * type fits is decided at compile time. Larger callables fall back to the heap, which is
+ * counted by `InlineFunctionBase::GetHeapFallbackCount()`.
+ */
+template <typename R, typename... Args, size_t Capacity>
+class InlineFunction<R(Args...), Capacity> : public InlineFunctionBase
+{
+    static_assert(Capacity >= sizeof(void *), "The inline storage must be able to hold a pointer");
+
+    template <typename F> struct FitsInline
+    {
+        static constexpr bool value = sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t) &&
+                                      std::is_nothrow_move_constructible<F>::value;
+    };
+
+public:
+    InlineFunction(void)
+        : mInvoke(nullptr)
+        , mManage(nullptr)
+    {
+    }
+
+    InlineFunction(std::nullptr_t)
+        : InlineFunction()
+    {
+    }
+
+    // Constructs a new `InlineFunction` instance with a callable. An empty `std::function` or a null
+    // function pointer results in an empty `InlineFunction`, as `std::function` does.
+    template <typename F,
+              typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, InlineFunction>::value &&
+                                                 !std::is_same<typename std::decay<F>::type, std::nullptr_t>::value>::type>
+    InlineFunction(F &&aFunc)
+        : InlineFunction()
+    {
+        if (!IsNull(aFunc))
+        {
+            Store<typename std::decay<F>::type>(std::forward<F>(aFunc));
+        }
+    }
+
+    InlineFunction(InlineFunction &&aOther) noexcept
+        : InlineFunction()
+    {
+        MoveFrom(aOther);
+    }
+
+    InlineFunction &operator=(InlineFunction &&aOther) noexcept
+    {
+        if (this != &aOther)
+        {
+            Reset();
+            MoveFrom(aOther);
+        }
+
+        return *this;
+    }
+
+    InlineFunction &operator=(std::nullptr_t)
+    {
+        Reset();
+
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction &)            = delete;
+    InlineFunction &operator=(const InlineFunction &) = delete;
+
+    ~InlineFunction(void) { Reset(); }
+
+    explicit operator bool(void) const { return mInvoke != nullptr; }
+
+    R operator()(Args... aArgs) const { return mInvoke(&mStorage, std::forward<Args>(aArgs)...); }
+
+private:
+    enum Operation : uint8_t
+    {
+        kMove,
+        kDestroy,
+    };
+
+    typedef R (*Invoker)(void *aStorage, Args &&...aArgs);
+    typedef void (*Manager)(Operation aOperation, void *aStorage, void *aOtherStorage);
+
+    template <typename F> static bool IsNull(const F &) { return false; }
+    template <typename T> static bool IsNull(T *aFunc) { return aFunc == nullptr; }
+    template <typename S> static bool IsNull(const std::function<S> &aFunc) { return !aFunc; }
+    template <typename S, size_t C> static bool IsNull(const InlineFunction<S, C> &aFunc) { return !aFunc; }
+
+    template <typename F> static F *GetCallable(void *aStorage, std::true_type /* aInline */)
+    {
+        return static_cast<F *>(aStorage);
+    }
+
+    template <typename F> static F *GetCallable(void *aStorage, std::false_type /* aInline */)
+    {
+        return *static_cast<F **>(aStorage);
+    }
+
+    template <typename F> static R Invoke(void *aStorage, Args &&...aArgs)
+    {
+        return (*GetCallable<F>(aStorage, std::integral_constant<bool, FitsInline<F>::value>()))(
+            std::forward<Args>(aArgs)...);
+    }
+
+    template <typename F> static void Manage(Operation aOperation, void *aStorage, void *aOtherStorage)
+    {
+        ManageCallable<F>(aOperation, aStorage, aOtherStorage, std::integral_constant<bool, FitsInline<F>::value>());
+    }
+
+    // Moves the callable from `aOtherStorage` to `aStorage`, or destroys the callable in `aStorage`.
+    template <typename F>
+    static void ManageCallable(Operation aOperation, void *aStorage, void *aOtherStorage, std::true_type /* aInline */)
+    {
+        F *callable = static_cast<F *>(aStorage);
+
+        if (aOperation == kMove)
+        {
+            F *other = static_cast<F *>(aOtherStorage);
+
+            new (aStorage) F(std::move(*other));
+            other->~F();
+        }
+        else
+        {
+            callable->~F();
+        }
+    }
+
+    template <typename F>
+    static void ManageCallable(Operation aOperation, void *aStorage, void *aOtherStorage, std::false_type /* aInline */)
+    {
+        if (aOperation == kMove)
+        {
+            *static_cast<F **>(aStorage) = *static_cast<F **>(aOtherStorage);
+        }
+        else
+        {
+            delete *static_cast<F **>(aStorage);
+        }
+    }
+
+    template <typename F, typename T> void Store(T &&aFunc)
+    {
+        StoreCallable<F>(std::forward<T>(aFunc), std::integral_constant<bool, FitsInline<F>::value>());
+        mInvoke = &Invoke<F>;
+        mManage = &Manage<F>;
+    }
+
+    template <typename F, typename T> void StoreCallable(T &&aFunc, std::true_type /* aInline */)
+    {
+        new (&mStorage) F(std::forward<T>(aFunc));
+    }
+
+    template <typename F, typename T> void StoreCallable(T &&aFunc, std::false_type /* aInline */)
+    {
+        *reinterpret_cast<F **>(&mStorage) = new F(std::forward<T>(aFunc));
+        HeapFallbackCounter().fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void MoveFrom(InlineFunction &aOther)
+    {
+        if (aOther.mInvoke != nullptr)
+        {
+            aOther.mManage(kMove, &mStorage, &aOther.mStorage);
+            mInvoke        = aOther.mInvoke;
+            mManage        = aOther.mManage;
+            aOther.mInvoke = nullptr;
+            aOther.mManage = nullptr;
+        }
+    }
+
+    void Reset(void)
+    {
+        if (mInvoke != nullptr)
+        {
+            mManage(kDestroy, &mStorage, nullptr);
+            mInvoke = nullptr;
+            mManage = nullptr;
+        }
+    }
+
+    Invoker mInvoke;
+    Manager mManage;
+
+    // The callable is invoked through a const `InlineFunction` as `std::function` does.
+    mutable typename std::aligned_storage<Capacity, alignof(std::max_align_t)>::type mStorage;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_INLINE_FUNCTION_HPP_
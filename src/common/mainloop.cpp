@@ -72,4 +72,23 @@ void MainloopContext::AddFdToSet(int aFd, uint8_t aFdSetsMask)
     }
 }
 
+bool MainloopContext::HasFdEvent(int aFd, uint8_t aFdSetsMask) const
+{
+    bool hasEvent = false;
+
+    if (aFd >= 0 && aFd < FD_SETSIZE)
+    {
+        hasEvent = ((aFdSetsMask & kErrorFdSet) && FD_ISSET(aFd, &mErrorFdSet)) ||
+                   ((aFdSetsMask & kReadFdSet) && FD_ISSET(aFd, &mReadFdSet)) ||
+                   ((aFdSetsMask & kWriteFdSet) && FD_ISSET(aFd, &mWriteFdSet));
+    }
+
+    for (auto it = mFdEvents.begin(); !hasEvent && it != mFdEvents.end(); ++it)
+    {
+        hasEvent = (it->mFd == aFd) && (it->mFdSetsMask & aFdSetsMask);
+    }
+
+    return hasEvent;
+}
+
 } // namespace otbr
@@ -36,6 +36,8 @@
 
 #include <openthread-br/config.h>
 
+#include <vector>
+
 #include <openthread/openthread-system.h>
 
 namespace otbr {
@@ -50,6 +52,15 @@ public:
     static constexpr uint8_t kReadFdSet  = 1 << 1;
     static constexpr uint8_t kWriteFdSet = 1 << 2;
 
+    /**
+     * This type represents the events of a fd registered with the MainloopManager.
+     */
+    struct FdEvent
+    {
+        int     mFd;         ///< The fd.
+        uint8_t mFdSetsMask; ///< A bitmask indicating in which fd sets the fd is ready.
+    };
+
     /**
      * This method adds a fd to the read fd set inside the MainloopContext.
      *
@@ -64,6 +75,25 @@ public:
      * @param[in] aFdSetsMask  A bitmask indicating which fd sets to add.
      */
     void AddFdToSet(int aFd, uint8_t aFdSetsMask);
+
+    /**
+     * This method indicates whether a fd is ready in any of the given fd sets.
+     *
+     * This method works for both fds added to the fd sets of this MainloopContext and fds registered
+     * with the MainloopManager, including fds which are not less than `FD_SETSIZE`.
+     *
+     * @param[in] aFd          The fd to check.
+     * @param[in] aFdSetsMask  A bitmask indicating which fd sets to check.
+     *
+     * @retval TRUE   The fd is ready in at least one of the given fd sets.
+     * @retval FALSE  The fd is not ready in any of the given fd sets.
+     */
+    bool HasFdEvent(int aFd, uint8_t aFdSetsMask) const;
+
+    /**
+     * The events of the fds registered with the MainloopManager, filled in by the MainloopManager.
+     */
+    std::vector<FdEvent> mFdEvents;
 };
 
 /**
@@ -90,6 +120,13 @@ public:
      * @param[in] aMainloop  A reference to the mainloop context.
      */
     virtual void Process(const MainloopContext &aMainloop) = 0;
+
+    /**
+     * This method returns the name of the mainloop processor, which is used in the mainloop statistics.
+     *
+     * @returns The name of the mainloop processor.
+     */
+    virtual const char *GetName(void) const { return "MainloopProcessor"; }
 };
 
 } // namespace otbr
@@ -25,12 +25,28 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
+#define OTBR_LOG_TAG "MAINLOOP"
+
 #include <assert.h>
 
 #include "common/mainloop_manager.hpp"
 
+#include "common/logging.hpp"
+
 namespace otbr {
 
+constexpr Milliseconds MainloopManager::kStallBudget;
+constexpr Milliseconds MainloopManager::kStallWarningInterval;
+
+MainloopManager::MainloopManager(void)
+    : mFdCallbackEntry(nullptr)
+    , mTimerEntry(nullptr)
+    , mPoller(MainloopPoller::Create(OTBR_ENABLE_EPOLL ? MainloopPoller::Type::kEpoll : MainloopPoller::Type::kSelect))
+{
+    mFdCallbackEntry.mStats.mName = "FdCallbacks";
+    mTimerEntry.mStats.mName      = "Timers";
+}
+
 void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
     assert(aMainloopProcessor != nullptr);
@@ -39,22 +55,208 @@ void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor
 
 void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
-    mMainloopProcessorList.remove(aMainloopProcessor);
+    mMainloopProcessorList.remove_if(
+        [aMainloopProcessor](const ProcessorEntry &aEntry) { return aEntry.mProcessor == aMainloopProcessor; });
 }
 
 void MainloopManager::Update(MainloopContext &aMainloop)
 {
-    for (auto &mainloopProcessor : mMainloopProcessorList)
+    for (ProcessorEntry &entry : mMainloopProcessorList)
     {
-        mainloopProcessor->Update(aMainloop);
+        Timepoint start = Clock::now();
+
+        entry.mProcessor->Update(aMainloop);
+        RecordLatency(entry, entry.mStats.mUpdateLatency, "Update", start, Clock::now());
+    }
+
+    if (!mTimerQueue.empty())
+    {
+        auto delay   = std::chrono::duration_cast<Microseconds>(mTimerQueue.begin()->first - Clock::now());
+        auto timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+
+        if (delay < Microseconds::zero())
+        {
+            delay = Microseconds::zero();
+        }
+
+        if (delay < timeout)
+        {
+            aMainloop.mTimeout = ToTimeval(delay);
+        }
     }
 }
 
 void MainloopManager::Process(const MainloopContext &aMainloop)
 {
-    for (auto &mainloopProcessor : mMainloopProcessorList)
+    Timepoint start = Clock::now();
+
+    ProcessFdEvents(aMainloop);
+    RecordLatency(mFdCallbackEntry, mFdCallbackEntry.mStats.mProcessLatency, "Process", start, Clock::now());
+
+    start = Clock::now();
+    ProcessTimers();
+    RecordLatency(mTimerEntry, mTimerEntry.mStats.mProcessLatency, "Process", start, Clock::now());
+
+    for (ProcessorEntry &entry : mMainloopProcessorList)
+    {
+        start = Clock::now();
+        entry.mStats.mDispatchLatency.Record(
+            static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(start - mPollReturnTime).count()));
+
+        entry.mProcessor->Process(aMainloop);
+        RecordLatency(entry, entry.mStats.mProcessLatency, "Process", start, Clock::now());
+    }
+}
+
+void MainloopManager::ProcessFdEvents(const MainloopContext &aMainloop)
+{
+    for (const MainloopContext::FdEvent &fdEvent : aMainloop.mFdEvents)
+    {
+        // The fd may have been removed by a previous callback, so the callback is looked up
+        // again for each event, and copied since it may remove itself. A fd number which has
+        // been closed and registered again since the poll belongs to a new owner, whose
+        // callback must not receive the events of the old fd.
+        auto it = mFdRegistrations.find(fdEvent.mFd);
+
+        if (it != mFdRegistrations.end() && it->second.mGeneration <= mPolledGeneration)
+        {
+            FdCallback callback = it->second.mCallback;
+
+            callback(fdEvent.mFdSetsMask);
+        }
+    }
+}
+
+void MainloopManager::ProcessTimers(void)
+{
+    Timepoint now = Clock::now();
+
+    while (!mTimerQueue.empty() && mTimerQueue.begin()->first <= now)
+    {
+        TimerId       timerId  = mTimerQueue.begin()->second;
+        auto          it       = mTimers.find(timerId);
+        TimerCallback callback = std::move(it->second.mCallback);
+
+        mTimerQueue.erase(mTimerQueue.begin());
+        mTimers.erase(it);
+
+        callback();
+    }
+}
+
+otbrError MainloopManager::AddFd(int aFd, uint8_t aFdSetsMask, FdCallback aCallback)
+{
+    otbrError error;
+
+    assert(aCallback != nullptr);
+
+    SuccessOrExit(error = mPoller->AddFd(aFd, aFdSetsMask));
+
+    {
+        auto it = mFdRegistrations.find(aFd);
+
+        // Updating a registered fd keeps its generation, so that its pending events are still dispatched.
+        if (it == mFdRegistrations.end())
+        {
+            it = mFdRegistrations.emplace(aFd, FdRegistration{++mFdGeneration, nullptr}).first;
+        }
+
+        it->second.mCallback = std::move(aCallback);
+    }
+
+exit:
+    return error;
+}
+
+void MainloopManager::RemoveFd(int aFd)
+{
+    mPoller->RemoveFd(aFd);
+    mFdRegistrations.erase(aFd);
+}
+
+MainloopManager::TimerId MainloopManager::AddTimer(Microseconds aDelay, TimerCallback aCallback)
+{
+    TimerId   timerId  = mNextTimerId++;
+    Timepoint deadline = Clock::now() + aDelay;
+
+    assert(aCallback != nullptr);
+
+    mTimers[timerId] = {deadline, std::move(aCallback)};
+    mTimerQueue.emplace(deadline, timerId);
+
+    return timerId;
+}
+
+void MainloopManager::RemoveTimer(TimerId aTimerId)
+{
+    auto it = mTimers.find(aTimerId);
+
+    VerifyOrExit(it != mTimers.end());
+
+    mTimerQueue.erase({it->second.mDeadline, aTimerId});
+    mTimers.erase(it);
+
+exit:
+    return;
+}
+
+int MainloopManager::Poll(MainloopContext &aMainloop)
+{
+    int rval;
+
+    aMainloop.mFdEvents.clear();
+
+    rval              = mPoller->Poll(aMainloop);
+    mPollReturnTime   = Clock::now();
+    mPolledGeneration = mFdGeneration;
+
+    return rval;
+}
+
+std::vector<MainloopProcessorStats> MainloopManager::GetProcessorStats(void) const
+{
+    std::vector<MainloopProcessorStats> stats;
+
+    for (const ProcessorEntry &entry : mMainloopProcessorList)
+    {
+        stats.push_back(entry.mStats);
+        stats.back().mName = entry.mProcessor->GetName();
+    }
+
+    stats.push_back(mFdCallbackEntry.mStats);
+    stats.push_back(mTimerEntry.mStats);
+
+    return stats;
+}
+
+void MainloopManager::RecordLatency(ProcessorEntry   &aEntry,
+                                    LatencyHistogram &aHistogram,
+                                    const char       *aAction,
+                                    Timepoint         aStart,
+                                    Timepoint         aEnd)
+{
+    Microseconds latency = std::chrono::duration_cast<Microseconds>(aEnd - aStart);
+
+    aHistogram.Record(static_cast<uint64_t>(latency.count()));
+
+    VerifyOrExit(latency > kStallBudget);
+    aEntry.mStats.mStallCount++;
+
+    if (aEnd - aEntry.mLastStallWarningTime < kStallWarningInterval)
     {
-        mainloopProcessor->Process(aMainloop);
+        aEntry.mSuppressedStallWarnings++;
+        ExitNow();
     }
+
+    otbrLogWarning("%s::%s() took %lld ms, over the budget of %lld ms (%u warnings suppressed)",
+                   aEntry.mProcessor != nullptr ? aEntry.mProcessor->GetName() : aEntry.mStats.mName.c_str(), aAction,
+                   static_cast<long long>(std::chrono::duration_cast<Milliseconds>(latency).count()),
+                   static_cast<long long>(kStallBudget.count()), aEntry.mSuppressedStallWarnings);
+    aEntry.mLastStallWarningTime    = aEnd;
+    aEntry.mSuppressedStallWarnings = 0;
+
+exit:
+    return;
 }
+
 } // namespace otbr
@@ -38,10 +38,18 @@
 
 #include <openthread/openthread-system.h>
 
+#include <functional>
 #include <list>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_poller.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
 #include "host/rcp_host.hpp"
 
 namespace otbr {
@@ -52,10 +60,29 @@ namespace otbr {
 class MainloopManager : private NonCopyable
 {
 public:
+    /**
+     * This type represents the callback which is invoked when a registered fd is ready.
+     *
+     * @param[in] aFdSetsMask  A bitmask indicating in which fd sets the fd is ready.
+     */
+    typedef std::function<void(uint8_t aFdSetsMask)> FdCallback;
+
+    /**
+     * This type represents the callback which is invoked when a timer fires.
+     */
+    typedef std::function<void(void)> TimerCallback;
+
+    /**
+     * This type represents a unique ID of a timer.
+     *
+     * Note: A valid timer ID is never zero.
+     */
+    typedef uint64_t TimerId;
+
     /**
      * The constructor to initialize the mainloop manager.
      */
-    MainloopManager() = default;
+    MainloopManager(void);
 
     /**
      * This method returns the singleton instance of the mainloop manager.
@@ -83,19 +110,149 @@ public:
     /**
      * This method updates the mainloop context of all mainloop processors.
      *
+     * The timeout of @p aMainloop is also limited by the earliest timer.
+     *
      * @param[in,out] aMainloop  A reference to the mainloop to be updated.
      */
     void Update(MainloopContext &aMainloop);
 
     /**
-     * This method processes mainloop events of all mainloop processors.
+     * This method processes mainloop events.
+     *
+     * The callbacks of the ready registered fds and the expired timers are invoked before the
+     * mainloop processors are processed.
      *
      * @param[in] aMainloop  A reference to the mainloop context.
      */
     void Process(const MainloopContext &aMainloop);
 
+    /**
+     * This method registers a fd to the mainloop or updates a registered fd.
+     *
+     * Unlike the fds added to a MainloopContext in `Update()`, a registered fd stays registered
+     * until `RemoveFd()` is called, and only its @p aCallback is invoked when it's ready.
+     *
+     * @param[in] aFd          The fd to register.
+     * @param[in] aFdSetsMask  A bitmask indicating which fd sets the fd should be polled in.
+     * @param[in] aCallback    The callback to invoke when the fd is ready.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully registered the fd.
+     * @retval OTBR_ERROR_INVALID_ARGS  The fd is not supported by the current poller.
+     * @retval OTBR_ERROR_ERRNO         Failed to register the fd, check `errno` for details.
+     */
+    otbrError AddFd(int aFd, uint8_t aFdSetsMask, FdCallback aCallback);
+
+    /**
+     * This method unregisters a fd from the mainloop.
+     *
+     * This method must be called before the fd is closed. It's safe to call this method in a fd or timer callback,
+     * the pending events of the fd are then not dispatched, even if the fd number is registered again.
+     *
+     * @param[in] aFd  The fd to unregister.
+     */
+    void RemoveFd(int aFd);
+
+    /**
+     * This method adds a one-shot timer to the mainloop.
+     *
+     * The timer callback is invoked on the mainloop after @p aDelay from now.
+     * This method must be called on the mainloop thread.
+     *
+     * @param[in] aDelay     The delay before invoking the callback.
+     * @param[in] aCallback  The callback to invoke when the timer fires.
+     *
+     * @returns The unique ID of the timer.
+     */
+    TimerId AddTimer(Microseconds aDelay, TimerCallback aCallback);
+
+    /**
+     * This method removes a timer which has not fired yet.
+     *
+     * It's safe to call this method in a fd or timer callback.
+     *
+     * @param[in] aTimerId  The ID of the timer to remove.
+     */
+    void RemoveTimer(TimerId aTimerId);
+
+    /**
+     * This method waits for events of the fds in @p aMainloop and of the registered fds.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop context.
+     *
+     * @returns The number of ready fds, or -1 if failed with `errno` set.
+     */
+    int Poll(MainloopContext &aMainloop);
+
+    /**
+     * This method returns the type of the poller used by the mainloop.
+     *
+     * @returns The type of the mainloop poller.
+     */
+    MainloopPoller::Type GetPollerType(void) const { return mPoller->GetType(); }
+
+    /**
+     * This method returns the latency statistics of the mainloop processors.
+     *
+     * The registered fd callbacks and timers are reported as two additional entries,
+     * "FdCallbacks" and "Timers".
+     *
+     * @returns The statistics of each mainloop processor.
+     */
+    std::vector<MainloopProcessorStats> GetProcessorStats(void) const;
+
 private:
-    std::list<MainloopProcessor *> mMainloopProcessorList;
+    // The wall time budget of a single `Update()` or `Process()` call, calls
+    // which take longer are considered to stall the mainloop.
+    static constexpr Milliseconds kStallBudget = Milliseconds(50);
+
+    // The min interval between two stall warnings of the same processor.
+    static constexpr Milliseconds kStallWarningInterval = Milliseconds(10000);
+
+    struct ProcessorEntry
+    {
+        explicit ProcessorEntry(MainloopProcessor *aProcessor)
+            : mProcessor(aProcessor)
+        {
+        }
+
+        MainloopProcessor     *mProcessor;
+        MainloopProcessorStats mStats;
+        Timepoint              mLastStallWarningTime;
+        uint32_t               mSuppressedStallWarnings = 0;
+    };
+
+    void RecordLatency(ProcessorEntry   &aEntry,
+                       LatencyHistogram &aHistogram,
+                       const char       *aAction,
+                       Timepoint         aStart,
+                       Timepoint         aEnd);
+
+    struct Timer
+    {
+        Timepoint     mDeadline;
+        TimerCallback mCallback;
+    };
+
+    struct FdRegistration
+    {
+        uint64_t   mGeneration; // Distinguishes a fd number which is closed and registered again.
+        FdCallback mCallback;
+    };
+
+    void ProcessFdEvents(const MainloopContext &aMainloop);
+    void ProcessTimers(void);
+
+    std::list<ProcessorEntry>               mMainloopProcessorList;
+    ProcessorEntry                          mFdCallbackEntry;
+    ProcessorEntry                          mTimerEntry;
+    Timepoint                               mPollReturnTime;
+    std::unique_ptr<MainloopPoller>         mPoller;
+    std::unordered_map<int, FdRegistration> mFdRegistrations;
+    std::unordered_map<TimerId, Timer>      mTimers;
+    std::set<std::pair<Timepoint, TimerId>> mTimerQueue;
+    TimerId                                 mNextTimerId      = 1;
+    uint64_t                                mFdGeneration     = 0;
+    uint64_t                                mPolledGeneration = 0;
 };
 } // namespace otbr
 #endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
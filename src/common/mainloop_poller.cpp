@@ -0,0 +1,330 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mainloop pollers.
+ */
+
+#define OTBR_LOG_TAG "MAINLOOP"
+
+#include "common/mainloop_poller.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#if OTBR_ENABLE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+std::unique_ptr<MainloopPoller> MainloopPoller::Create(Type aType)
+{
+    std::unique_ptr<MainloopPoller> poller;
+
+#if OTBR_ENABLE_EPOLL
+    if (aType == Type::kEpoll)
+    {
+        std::unique_ptr<EpollPoller> epollPoller = MakeUnique<EpollPoller>();
+
+        if (epollPoller->IsValid())
+        {
+            poller = std::move(epollPoller);
+        }
+        else
+        {
+            otbrLogWarning("Failed to create epoll instance, fall back to select(): %s", strerror(errno));
+        }
+    }
+#else
+    OTBR_UNUSED_VARIABLE(aType);
+#endif
+
+    if (poller == nullptr)
+    {
+        poller = MakeUnique<SelectPoller>();
+    }
+
+    return poller;
+}
+
+otbrError SelectPoller::AddFd(int aFd, uint8_t aFdSetsMask)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aFd >= 0 && aFd < FD_SETSIZE, error = OTBR_ERROR_INVALID_ARGS);
+    mFds[aFd] = aFdSetsMask;
+
+exit:
+    return error;
+}
+
+void SelectPoller::RemoveFd(int aFd)
+{
+    mFds.erase(aFd);
+}
+
+int SelectPoller::Poll(MainloopContext &aMainloop)
+{
+    int rval;
+
+    for (const auto &fd : mFds)
+    {
+        aMainloop.AddFdToSet(fd.first, fd.second);
+    }
+
+    rval = select(aMainloop.mMaxFd + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet,
+                  &aMainloop.mTimeout);
+    VerifyOrExit(rval > 0);
+
+    for (const auto &fd : mFds)
+    {
+        uint8_t readyMask = 0;
+
+        if ((fd.second & MainloopContext::kErrorFdSet) && FD_ISSET(fd.first, &aMainloop.mErrorFdSet))
+        {
+            readyMask |= MainloopContext::kErrorFdSet;
+        }
+        if ((fd.second & MainloopContext::kReadFdSet) && FD_ISSET(fd.first, &aMainloop.mReadFdSet))
+        {
+            readyMask |= MainloopContext::kReadFdSet;
+        }
+        if ((fd.second & MainloopContext::kWriteFdSet) && FD_ISSET(fd.first, &aMainloop.mWriteFdSet))
+        {
+            readyMask |= MainloopContext::kWriteFdSet;
+        }
+
+        if (readyMask != 0)
+        {
+            aMainloop.mFdEvents.push_back({fd.first, readyMask});
+        }
+    }
+
+exit:
+    return rval;
+}
+
+#if OTBR_ENABLE_EPOLL
+
+static uint32_t ToEpollEvents(uint8_t aFdSetsMask)
+{
+    uint32_t events = 0;
+
+    if (aFdSetsMask & MainloopContext::kErrorFdSet)
+    {
+        events |= EPOLLPRI;
+    }
+    if (aFdSetsMask & MainloopContext::kReadFdSet)
+    {
+        events |= EPOLLIN;
+    }
+    if (aFdSetsMask & MainloopContext::kWriteFdSet)
+    {
+        events |= EPOLLOUT;
+    }
+
+    return events;
+}
+
+static uint8_t FromEpollEvents(uint32_t aEvents, uint8_t aFdSetsMask)
+{
+    uint8_t readyMask = 0;
+
+    // The same as `select()`, a hang-up or an error makes a fd readable and writable.
+    if (aEvents & EPOLLPRI)
+    {
+        readyMask |= MainloopContext::kErrorFdSet;
+    }
+    if (aEvents & (EPOLLIN | EPOLLHUP | EPOLLERR))
+    {
+        readyMask |= MainloopContext::kReadFdSet;
+    }
+    if (aEvents & (EPOLLOUT | EPOLLERR))
+    {
+        readyMask |= MainloopContext::kWriteFdSet;
+    }
+
+    return readyMask & aFdSetsMask;
+}
+
+EpollPoller::EpollPoller(void)
+    : mEpollFd(epoll_create1(EPOLL_CLOEXEC))
+{
+}
+
+EpollPoller::~EpollPoller(void)
+{
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+}
+
+otbrError EpollPoller::AddFd(int aFd, uint8_t aFdSetsMask)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    auto               it    = mFds.find(aFd);
+    struct epoll_event event;
+
+    VerifyOrExit(aFd >= 0, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(it == mFds.end() || it->second != aFdSetsMask);
+
+    memset(&event, 0, sizeof(event));
+    event.events  = ToEpollEvents(aFdSetsMask);
+    event.data.fd = aFd;
+
+    VerifyOrExit(epoll_ctl(mEpollFd, (it == mFds.end()) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, aFd, &event) == 0,
+                 error = OTBR_ERROR_ERRNO);
+    mFds[aFd] = aFdSetsMask;
+
+exit:
+    return error;
+}
+
+void EpollPoller::RemoveFd(int aFd)
+{
+    auto it = mFds.find(aFd);
+
+    VerifyOrExit(it != mFds.end());
+
+    // The fd is automatically removed from the epoll instance if it's already closed,
+    // so failures are ignored here.
+    epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr);
+    mFds.erase(it);
+
+exit:
+    return;
+}
+
+int EpollPoller::Poll(MainloopContext &aMainloop)
+{
+    int                rval;
+    struct timespec    timeout;
+    struct epoll_event events[kMaxEpollEvents];
+
+    // The fds in the fd sets are only valid for this iteration, so they are polled with
+    // `ppoll()` while the registered fds are represented by the single epoll fd.
+    mPollFds.clear();
+
+    for (int fd = 0; fd <= aMainloop.mMaxFd && fd < FD_SETSIZE; ++fd)
+    {
+        short pollEvents = 0;
+
+        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        {
+            pollEvents |= POLLPRI;
+        }
+        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        {
+            pollEvents |= POLLIN;
+        }
+        if (FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        {
+            pollEvents |= POLLOUT;
+        }
+
+        if (pollEvents != 0)
+        {
+            mPollFds.push_back({fd, pollEvents, 0});
+        }
+    }
+
+    mPollFds.push_back({mEpollFd, POLLIN, 0});
+
+    timeout.tv_sec  = aMainloop.mTimeout.tv_sec;
+    timeout.tv_nsec = aMainloop.mTimeout.tv_usec * 1000;
+
+    rval = ppoll(mPollFds.data(), mPollFds.size(), &timeout, nullptr);
+    VerifyOrExit(rval >= 0);
+
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+    rval = 0;
+
+    for (size_t i = 0; i + 1 < mPollFds.size(); i++)
+    {
+        const struct pollfd &pollFd  = mPollFds[i];
+        bool                 isReady = false;
+
+        if (pollFd.revents & POLLPRI)
+        {
+            FD_SET(pollFd.fd, &aMainloop.mErrorFdSet);
+            isReady = true;
+        }
+        if ((pollFd.events & POLLIN) && (pollFd.revents & (POLLIN | POLLHUP | POLLERR)))
+        {
+            FD_SET(pollFd.fd, &aMainloop.mReadFdSet);
+            isReady = true;
+        }
+        if ((pollFd.events & POLLOUT) && (pollFd.revents & (POLLOUT | POLLERR)))
+        {
+            FD_SET(pollFd.fd, &aMainloop.mWriteFdSet);
+            isReady = true;
+        }
+
+        rval += isReady ? 1 : 0;
+    }
+
+    if (mPollFds.back().revents & POLLIN)
+    {
+        int count = epoll_wait(mEpollFd, events, kMaxEpollEvents, /* timeout */ 0);
+
+        for (int i = 0; i < count; i++)
+        {
+            auto    it = mFds.find(events[i].data.fd);
+            uint8_t readyMask;
+
+            if (it == mFds.end())
+            {
+                continue;
+            }
+
+            readyMask = FromEpollEvents(events[i].events, it->second);
+
+            if (readyMask != 0)
+            {
+                aMainloop.mFdEvents.push_back({it->first, readyMask});
+                rval++;
+            }
+        }
+    }
+
+exit:
+    return rval;
+}
+
+#endif // OTBR_ENABLE_EPOLL
+
+} // namespace otbr
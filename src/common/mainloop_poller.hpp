@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the mainloop poller which waits for fd events.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_POLLER_HPP_
+#define OTBR_COMMON_MAINLOOP_POLLER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <poll.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/types.hpp"
+
+#ifndef OTBR_ENABLE_EPOLL
+#if defined(__linux__)
+#define OTBR_ENABLE_EPOLL 1
+#else
+#define OTBR_ENABLE_EPOLL 0
+#endif
+#endif
+
+namespace otbr {
+
+/**
+ * This abstract class defines the event backend of the mainloop.
+ *
+ * Besides the fds added to the fd sets of a MainloopContext in each iteration, a poller also
+ * keeps a set of fds which are registered once and stay registered until they are removed.
+ */
+class MainloopPoller : private NonCopyable
+{
+public:
+    /**
+     * This enumeration represents the type of a mainloop poller.
+     */
+    enum class Type : uint8_t
+    {
+        kSelect, ///< Polls with `select()`.
+        kEpoll,  ///< Polls with `epoll_wait()`.
+    };
+
+    /**
+     * This function creates a mainloop poller.
+     *
+     * If the requested type is not supported, a `select()` poller is created instead.
+     *
+     * @param[in] aType  The preferred type of the poller.
+     *
+     * @returns A pointer to the newly created poller.
+     */
+    static std::unique_ptr<MainloopPoller> Create(Type aType);
+
+    virtual ~MainloopPoller(void) = default;
+
+    /**
+     * This method returns the type of this poller.
+     *
+     * @returns The type of this poller.
+     */
+    virtual Type GetType(void) const = 0;
+
+    /**
+     * This method registers a fd or updates the fd sets of a registered fd.
+     *
+     * @param[in] aFd          The fd to register.
+     * @param[in] aFdSetsMask  A bitmask indicating which fd sets the fd should be polled in.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully registered the fd.
+     * @retval OTBR_ERROR_INVALID_ARGS  The fd is not supported by this poller.
+     * @retval OTBR_ERROR_ERRNO         Failed to register the fd, check `errno` for details.
+     */
+    virtual otbrError AddFd(int aFd, uint8_t aFdSetsMask) = 0;
+
+    /**
+     * This method unregisters a fd.
+     *
+     * This method must be called before the fd is closed.
+     *
+     * @param[in] aFd  The fd to unregister.
+     */
+    virtual void RemoveFd(int aFd) = 0;
+
+    /**
+     * This method waits for events of both the fds in @p aMainloop and the registered fds.
+     *
+     * On return, the fd sets of @p aMainloop contain only the ready fds and the events of the
+     * registered fds are appended to `aMainloop.mFdEvents`.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop context.
+     *
+     * @returns The number of ready fds, or -1 if failed with `errno` set.
+     */
+    virtual int Poll(MainloopContext &aMainloop) = 0;
+};
+
+/**
+ * This class implements the mainloop poller with `select()`.
+ *
+ * Registered fds are merged into the fd sets of the mainloop context in each iteration and thus
+ * must be less than `FD_SETSIZE`.
+ */
+class SelectPoller : public MainloopPoller
+{
+public:
+    Type      GetType(void) const override { return Type::kSelect; }
+    otbrError AddFd(int aFd, uint8_t aFdSetsMask) override;
+    void      RemoveFd(int aFd) override;
+    int       Poll(MainloopContext &aMainloop) override;
+
+private:
+    std::unordered_map<int, uint8_t> mFds;
+};
+
+#if OTBR_ENABLE_EPOLL
+/**
+ * This class implements the mainloop poller with epoll.
+ *
+ * Registered fds are kept in the kernel across iterations and are not limited by `FD_SETSIZE`.
+ * The fds in the fd sets of the mainloop context (e.g. the ones added by OpenThread) are polled
+ * together with the epoll fd in a single `ppoll()` call.
+ */
+class EpollPoller : public MainloopPoller
+{
+public:
+    /**
+     * This constructor initializes the epoll poller.
+     *
+     * @note `IsValid()` should be checked after the construction.
+     */
+    EpollPoller(void);
+
+    ~EpollPoller(void) override;
+
+    /**
+     * This method indicates whether the epoll instance is successfully created.
+     *
+     * @retval TRUE   The epoll instance is valid.
+     * @retval FALSE  Failed to create the epoll instance.
+     */
+    bool IsValid(void) const { return mEpollFd != -1; }
+
+    Type      GetType(void) const override { return Type::kEpoll; }
+    otbrError AddFd(int aFd, uint8_t aFdSetsMask) override;
+    void      RemoveFd(int aFd) override;
+    int       Poll(MainloopContext &aMainloop) override;
+
+private:
+    static constexpr int kMaxEpollEvents = 64;
+
+    int                              mEpollFd;
+    std::unordered_map<int, uint8_t> mFds;
+    std::vector<struct pollfd>       mPollFds;
+};
+#endif // OTBR_ENABLE_EPOLL
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_POLLER_HPP_
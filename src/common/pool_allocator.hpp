@@ -0,0 +1,170 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for an allocator which recycles fixed-size blocks.
+ */
+
+#ifndef OTBR_COMMON_POOL_ALLOCATOR_HPP_
+#define OTBR_COMMON_POOL_ALLOCATOR_HPP_
+
+#include "openthread-br/config.h"
+
+#include <cstddef>
+#include <new>
+
+namespace otbr {
+
+/**
+ * This class implements a standard allocator which keeps released single-object blocks in a
+ * per-thread free list and hands them out again, so that short-lived objects which are created
+ * at a high rate (for example, via `std::allocate_shared`) don't hit the heap each time.
+ *
+ * @tparam T               The type of the allocated objects.
+ * @tparam kMaxFreeBlocks  The maximum number of released blocks kept by each thread.
+ */
+template <class T, size_t kMaxFreeBlocks = 16> class PoolAllocator
+{
+public:
+    typedef T value_type;
+
+    template <class U> struct rebind
+    {
+        typedef PoolAllocator<U, kMaxFreeBlocks> other;
+    };
+
+    PoolAllocator(void) noexcept = default;
+
+    template <class U> PoolAllocator(const PoolAllocator<U, kMaxFreeBlocks> &) noexcept {}
+
+    /**
+     * This method allocates storage for @p aCount objects of type `T`.
+     *
+     * @param[in] aCount  The number of objects.
+     *
+     * @returns A pointer to the allocated storage.
+     */
+    T *allocate(size_t aCount)
+    {
+        void *block = nullptr;
+
+        if (aCount == 1)
+        {
+            block = GetFreeList().Pop();
+        }
+
+        if (block == nullptr)
+        {
+            block = ::operator new(aCount * sizeof(T));
+        }
+
+        return static_cast<T *>(block);
+    }
+
+    /**
+     * This method releases the storage returned by `allocate()`.
+     *
+     * @param[in] aBlock  A pointer to the storage.
+     * @param[in] aCount  The number of objects passed to `allocate()`.
+     */
+    void deallocate(T *aBlock, size_t aCount) noexcept
+    {
+        if (aCount != 1 || !GetFreeList().Push(aBlock))
+        {
+            ::operator delete(aBlock);
+        }
+    }
+
+    template <class U> bool operator==(const PoolAllocator<U, kMaxFreeBlocks> &) const noexcept { return true; }
+    template <class U> bool operator!=(const PoolAllocator<U, kMaxFreeBlocks> &) const noexcept { return false; }
+
+private:
+    class FreeList
+    {
+    public:
+        ~FreeList(void)
+        {
+            while (mHead != nullptr)
+            {
+                ::operator delete(Pop());
+            }
+        }
+
+        bool Push(void *aBlock)
+        {
+            bool pushed = false;
+
+            if (sizeof(T) >= sizeof(Node) && alignof(T) >= alignof(Node) && mCount < kMaxFreeBlocks)
+            {
+                Node *node = new (aBlock) Node();
+
+                node->mNext = mHead;
+                mHead       = node;
+                mCount++;
+                pushed = true;
+            }
+
+            return pushed;
+        }
+
+        void *Pop(void)
+        {
+            Node *node = mHead;
+
+            if (node != nullptr)
+            {
+                mHead = node->mNext;
+                mCount--;
+                node->~Node();
+            }
+
+            return node;
+        }
+
+    private:
+        struct Node
+        {
+            Node *mNext = nullptr;
+        };
+
+        Node  *mHead  = nullptr;
+        size_t mCount = 0;
+    };
+
+    static FreeList &GetFreeList(void)
+    {
+        static thread_local FreeList sFreeList;
+
+        return sFreeList;
+    }
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_POOL_ALLOCATOR_HPP_
@@ -37,14 +37,28 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
 
 #include "common/code_utils.hpp"
 
 namespace otbr {
 
+const Milliseconds TaskRunner::kWakeupRateWindow = Milliseconds(10000);
+
 TaskRunner::TaskRunner(void)
-    : mTaskQueue(DelayedTask::Comparator{})
+    : mWakeupPending(false)
+    , mImmediateTaskHead(&mImmediateTaskStub)
+    , mImmediateTaskTail(&mImmediateTaskStub)
+    , mWindowStart(Clock::now())
 {
+#ifdef __linux__
+    // We do not handle failures when creating an eventfd, simply die.
+    mEventFd[kRead] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrDie(mEventFd[kRead] != -1, strerror(errno));
+    mEventFd[kWrite] = mEventFd[kRead];
+#else
     int flags;
 
     // We do not handle failures when creating a pipe, simply die.
@@ -54,30 +68,46 @@ TaskRunner::TaskRunner(void)
     VerifyOrDie(fcntl(mEventFd[kRead], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
     flags = fcntl(mEventFd[kWrite], F_GETFL, 0);
     VerifyOrDie(fcntl(mEventFd[kWrite], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
+#endif
 }
 
 TaskRunner::~TaskRunner(void)
 {
-    if (mEventFd[kRead] != -1)
+    Task<void> task;
+
+    // Release the tasks which are never executed.
+    while (PopImmediateTask(task))
     {
-        close(mEventFd[kRead]);
-        mEventFd[kRead] = -1;
     }
-    if (mEventFd[kWrite] != -1)
+
+    if (mEventFd[kWrite] != -1 && mEventFd[kWrite] != mEventFd[kRead])
     {
         close(mEventFd[kWrite]);
-        mEventFd[kWrite] = -1;
+    }
+    mEventFd[kWrite] = -1;
+    if (mEventFd[kRead] != -1)
+    {
+        close(mEventFd[kRead]);
+        mEventFd[kRead] = -1;
     }
 }
 
 void TaskRunner::Post(Task<void> aTask)
 {
-    Post(Milliseconds::zero(), std::move(aTask));
+    PushImmediateTask(new ImmediateTask(std::move(aTask)));
+    Wakeup();
+}
+
+TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask, Milliseconds aSlack)
+{
+    return PushTask(aDelay, std::max(aSlack, Milliseconds::zero()), std::move(aTask));
 }
 
-TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask)
+double TaskRunner::GetWakeupsPerSecond(void)
 {
-    return PushTask(aDelay, std::move(aTask));
+    UpdateWakeupRate(Clock::now());
+
+    return mWakeupsPerSecond;
 }
 
 void TaskRunner::Update(MainloopContext &aMainloop)
@@ -87,14 +117,14 @@ void TaskRunner::Update(MainloopContext &aMainloop)
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-        if (!mTaskQueue.empty())
+        if (!mLatestDeadlines.empty())
         {
-            auto  now     = Clock::now();
-            auto &task    = mTaskQueue.top();
-            auto  delay   = std::chrono::duration_cast<Microseconds>(task.GetTimeExecute() - now);
-            auto  timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+            auto now      = Clock::now();
+            auto deadline = mLatestDeadlines.begin()->first;
+            auto delay    = std::chrono::duration_cast<Microseconds>(deadline - now);
+            auto timeout  = FromTimeval<Microseconds>(aMainloop.mTimeout);
 
-            if (task.GetTimeExecute() < now)
+            if (deadline < now)
             {
                 delay = Microseconds::zero();
             }
@@ -110,42 +140,49 @@ void TaskRunner::Update(MainloopContext &aMainloop)
 
 void TaskRunner::Process(const MainloopContext &aMainloop)
 {
-    ssize_t rval;
-
-    VerifyOrExit(FD_ISSET(mEventFd[kRead], &aMainloop.mReadFdSet));
-
-    // Read any data in the pipe.
-    do
+    if (FD_ISSET(mEventFd[kRead], &aMainloop.mReadFdSet))
     {
-        uint8_t n;
-
-        rval = read(mEventFd[kRead], &n, sizeof(n));
-    } while (rval > 0 || (rval == -1 && errno == EINTR));
-
-    // Critical error happens, simply die.
-    VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
+        ClearWakeup();
+    }
 
-exit:
     PopTasks();
 }
 
-TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
+TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Milliseconds aSlack, Task<void> aTask)
 {
-    ssize_t       rval;
-    const uint8_t kOne = 1;
-    TaskId        taskId;
+    TaskId taskId;
 
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
         taskId = mNextTaskId++;
 
-        mActiveTaskIds.insert(taskId);
-        mTaskQueue.emplace(taskId, aDelay, std::move(aTask));
+        mTaskQueue.emplace_back(taskId, aDelay, aSlack, std::move(aTask));
+        mTaskIndexes[taskId] = mTaskQueue.size() - 1;
+        mLatestDeadlines.emplace(mTaskQueue.back().mLatestDeadline, taskId);
+        SiftUp(mTaskQueue.size() - 1);
     }
 
+    Wakeup();
+
+    return taskId;
+}
+
+void TaskRunner::Wakeup(void)
+{
+    ssize_t rval;
+
+    // The mainloop is already woken up and will see this task when it drains the queues.
+    VerifyOrExit(!mWakeupPending.exchange(true));
+
     do
     {
+#ifdef __linux__
+        const uint64_t kOne = 1;
+#else
+        const uint8_t kOne = 1;
+#endif
+
         rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
     } while (rval == -1 && errno == EINTR);
 
@@ -154,40 +191,122 @@ TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
     // Critical error happens, simply die.
     VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
 
-    // We are blocked because there are already data (written by other concurrent callers in
-    // different threads) in the pipe, and the mEventFd[kRead] should be readable now.
+    // We are blocked because the event fd is full, and the mEventFd[kRead] should be readable now.
     otbrLogWarning("Failed to write fd %d: %s", mEventFd[kWrite], strerror(errno));
 
 exit:
-    return taskId;
+    return;
+}
+
+void TaskRunner::ClearWakeup(void)
+{
+    ssize_t rval;
+
+    // Read any data in the event fd.
+    do
+    {
+        uint64_t n;
+
+        rval = read(mEventFd[kRead], &n, sizeof(n));
+    } while (rval > 0 || (rval == -1 && errno == EINTR));
+
+    // Critical error happens, simply die.
+    VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
+
+    // This must be cleared before draining the queues, so that a task posted after the
+    // drain always wakes up the mainloop again. The exchange also acquires the tasks
+    // pushed by a poster which saw the wakeup still pending and skipped the write.
+    mWakeupPending.exchange(false);
+}
+
+void TaskRunner::PushImmediateTask(ImmediateTask *aTask)
+{
+    ImmediateTask *prev;
+
+    aTask->mNext.store(nullptr, std::memory_order_relaxed);
+    prev = mImmediateTaskHead.exchange(aTask, std::memory_order_acq_rel);
+    prev->mNext.store(aTask, std::memory_order_release);
+}
+
+bool TaskRunner::PopImmediateTask(Task<void> &aTask)
+{
+    ImmediateTask *tail   = mImmediateTaskTail;
+    ImmediateTask *next   = tail->mNext.load(std::memory_order_acquire);
+    bool           popped = false;
+
+    if (tail == &mImmediateTaskStub)
+    {
+        VerifyOrExit(next != nullptr);
+        mImmediateTaskTail = next;
+        tail               = next;
+        next               = next->mNext.load(std::memory_order_acquire);
+    }
+
+    if (next == nullptr)
+    {
+        // A producer has swapped the head but hasn't linked its task yet, the
+        // task will be popped after the producer wakes up the mainloop.
+        VerifyOrExit(tail == mImmediateTaskHead.load(std::memory_order_acquire));
+
+        // `tail` is the last task, push back the stub so that `tail` can be unlinked.
+        PushImmediateTask(&mImmediateTaskStub);
+        next = tail->mNext.load(std::memory_order_acquire);
+        VerifyOrExit(next != nullptr);
+    }
+
+    mImmediateTaskTail = next;
+    aTask              = std::move(tail->mTask);
+    popped             = true;
+    delete tail;
+
+exit:
+    return popped;
 }
 
 void TaskRunner::Cancel(TaskRunner::TaskId aTaskId)
 {
-    std::lock_guard<std::mutex> _(mTaskQueueMutex);
+    // The cancelled task is destroyed after the mutex is released, in case
+    // its captured state posts or cancels other tasks on destruction.
+    Task<void> task;
+
+    {
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+        auto it = mTaskIndexes.find(aTaskId);
+
+        VerifyOrExit(it != mTaskIndexes.end());
+        task = RemoveTaskAt(it->second);
+    }
 
-    mActiveTaskIds.erase(aTaskId);
+exit:
+    return;
 }
 
 void TaskRunner::PopTasks(void)
 {
+    bool      executedDelayedTask = false;
+    Timepoint now                 = Clock::now();
+
     while (true)
     {
         Task<void> task;
-        bool       canceled;
+
+        if (PopImmediateTask(task))
+        {
+            task();
+            continue;
+        }
 
         // The braces here are necessary for auto-releasing of the mutex.
         {
             std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-            if (!mTaskQueue.empty() && mTaskQueue.top().GetTimeExecute() <= Clock::now())
+            // Every task whose window has opened is executed now rather than at its latest
+            // deadline, since the mainloop is awake anyway.
+            now = Clock::now();
+            if (!mTaskQueue.empty() && mTaskQueue.front().GetTimeExecute() <= now)
             {
-                const DelayedTask &top    = mTaskQueue.top();
-                TaskId             taskId = top.mTaskId;
-
-                task = std::move(top.mTask);
-                mTaskQueue.pop();
-                canceled = (mActiveTaskIds.erase(taskId) == 0);
+                task = RemoveTaskAt(0);
             }
             else
             {
@@ -195,11 +314,105 @@ void TaskRunner::PopTasks(void)
             }
         }
 
-        if (!canceled)
+        executedDelayedTask = true;
+        task();
+    }
+
+    if (executedDelayedTask)
+    {
+        UpdateWakeupRate(now);
+        mWakeupCount++;
+        mWindowWakeupCount++;
+    }
+}
+
+void TaskRunner::UpdateWakeupRate(Timepoint aNow)
+{
+    auto elapsed = std::chrono::duration_cast<Milliseconds>(aNow - mWindowStart);
+
+    VerifyOrExit(elapsed >= kWakeupRateWindow);
+
+    mWakeupsPerSecond  = mWindowWakeupCount * 1000.0 / elapsed.count();
+    mWindowWakeupCount = 0;
+    mWindowStart       = aNow;
+
+exit:
+    return;
+}
+
+TaskRunner::Task<void> TaskRunner::RemoveTaskAt(size_t aIndex)
+{
+    size_t     last = mTaskQueue.size() - 1;
+    Task<void> task;
+
+    if (aIndex != last)
+    {
+        SwapTasks(aIndex, last);
+    }
+
+    task = std::move(mTaskQueue.back().mTask);
+    mLatestDeadlines.erase(std::make_pair(mTaskQueue.back().mLatestDeadline, mTaskQueue.back().mTaskId));
+    mTaskIndexes.erase(mTaskQueue.back().mTaskId);
+    mTaskQueue.pop_back();
+
+    if (aIndex < mTaskQueue.size())
+    {
+        SiftUp(aIndex);
+        SiftDown(aIndex);
+    }
+
+    return task;
+}
+
+void TaskRunner::SiftUp(size_t aIndex)
+{
+    while (aIndex > 0)
+    {
+        size_t parent = (aIndex - 1) / 2;
+
+        if (!mTaskQueue[aIndex].IsEarlierThan(mTaskQueue[parent]))
+        {
+            break;
+        }
+
+        SwapTasks(aIndex, parent);
+        aIndex = parent;
+    }
+}
+
+void TaskRunner::SiftDown(size_t aIndex)
+{
+    while (true)
+    {
+        size_t earliest = aIndex;
+        size_t left     = 2 * aIndex + 1;
+        size_t right    = left + 1;
+
+        if (left < mTaskQueue.size() && mTaskQueue[left].IsEarlierThan(mTaskQueue[earliest]))
+        {
+            earliest = left;
+        }
+
+        if (right < mTaskQueue.size() && mTaskQueue[right].IsEarlierThan(mTaskQueue[earliest]))
         {
-            task();
+            earliest = right;
+        }
+
+        if (earliest == aIndex)
+        {
+            break;
         }
+
+        SwapTasks(aIndex, earliest);
+        aIndex = earliest;
     }
 }
 
+void TaskRunner::SwapTasks(size_t aIndex1, size_t aIndex2)
+{
+    std::swap(mTaskQueue[aIndex1], mTaskQueue[aIndex2]);
+    mTaskIndexes[mTaskQueue[aIndex1].mTaskId] = aIndex1;
+    mTaskIndexes[mTaskQueue[aIndex2].mTaskId] = aIndex2;
+}
+
 } // namespace otbr
@@ -36,14 +36,18 @@
 
 #include <openthread-br/config.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <future>
 #include <mutex>
-#include <queue>
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "common/code_utils.hpp"
+#include "common/inline_function.hpp"
 #include "common/mainloop.hpp"
 #include "common/time.hpp"
 
@@ -58,8 +62,11 @@ class TaskRunner : public MainloopProcessor, private NonCopyable
 public:
     /**
      * This type represents the generic executable task.
+     *
+     * A task is move-only, and it's stored without heap allocation when its captures fit
+     * in the inline storage.
      */
-    template <class T> using Task = std::function<T(void)>;
+    template <class T> using Task = InlineFunction<T(void)>;
 
     /**
      * This type represents a unique task ID to an delayed task.
@@ -82,7 +89,9 @@ public:
      * This method posts a task to the task runner and returns immediately.
      *
      * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
-     * It is safe to call this method in different threads concurrently.
+     * It is safe to call this method in different threads concurrently. This method
+     * doesn't take any lock, and tasks posted by this method are executed before the
+     * expired delayed tasks.
      *
      * @param[in] aTask  The task to be executed.
      */
@@ -91,15 +100,18 @@ public:
     /**
      * This method posts a task to the task runner and returns immediately.
      *
-     * The task will be executed on the mainloop after `aDelay` milliseconds from now.
-     * It is safe to call this method in different threads concurrently.
+     * The task will be executed on the mainloop after `aDelay` milliseconds from now, but no later than
+     * `aDelay + aSlack` milliseconds from now. The runner uses the slack to execute tasks whose windows
+     * overlap in a single wakeup of the mainloop. It is safe to call this method in different threads
+     * concurrently.
      *
      * @param[in] aDelay  The delay before executing the task (in milliseconds).
      * @param[in] aTask   The task to be executed.
+     * @param[in] aSlack  The tolerated lateness of the task (in milliseconds).
      *
      * @returns  The unique task ID of the delayed task.
      */
-    TaskId Post(Milliseconds aDelay, Task<void> aTask);
+    TaskId Post(Milliseconds aDelay, Task<void> aTask, Milliseconds aSlack = Milliseconds::zero());
 
     /**
      * This method cancels a delayed task from the task runner.
@@ -127,8 +139,30 @@ public:
         return pro.get_future().get();
     }
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method returns the number of times the mainloop was woken up to execute delayed tasks.
+     *
+     * This method must be called on the mainloop thread.
+     *
+     * @returns The number of timer wakeups since the task runner was created.
+     */
+    uint64_t GetWakeupCount(void) const { return mWakeupCount; }
+
+    /**
+     * This method returns the rate of timer wakeups, measured over the last completed window
+     * of `kWakeupRateWindow`.
+     *
+     * This method must be called on the mainloop thread.
+     *
+     * @returns The number of timer wakeups per second.
+     */
+    double GetWakeupsPerSecond(void);
+
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "TaskRunner"; }
+
+    static const Milliseconds kWakeupRateWindow;
 
 private:
     enum
@@ -137,49 +171,89 @@ private:
         kWrite = 1,
     };
 
-    struct DelayedTask
+    // The node of the lock-free multi-producer single-consumer queue
+    // which holds the tasks posted without a delay.
+    struct ImmediateTask
     {
-        friend class Comparator;
-
-        struct Comparator
+        explicit ImmediateTask(Task<void> aTask = nullptr)
+            : mNext(nullptr)
+            , mTask(std::move(aTask))
         {
-            bool operator()(const DelayedTask &aLhs, const DelayedTask &aRhs) const { return aRhs < aLhs; }
-        };
+        }
+
+        std::atomic<ImmediateTask *> mNext;
+        Task<void>                   mTask;
+    };
 
-        DelayedTask(TaskId aTaskId, Milliseconds aDelay, Task<void> aTask)
+    struct DelayedTask
+    {
+        DelayedTask(TaskId aTaskId, Milliseconds aDelay, Milliseconds aSlack, Task<void> aTask)
             : mTaskId(aTaskId)
             , mDeadline(Clock::now() + aDelay)
+            , mLatestDeadline(mDeadline + aSlack)
             , mTask(std::move(aTask))
         {
         }
 
-        bool operator<(const DelayedTask &aOther) const
+        bool IsEarlierThan(const DelayedTask &aOther) const
         {
-            return mDeadline <= aOther.mDeadline || (mDeadline == aOther.mDeadline && mTaskId < aOther.mTaskId);
+            return mDeadline < aOther.mDeadline || (mDeadline == aOther.mDeadline && mTaskId < aOther.mTaskId);
         }
 
         Timepoint GetTimeExecute(void) const { return mDeadline; }
 
         TaskId     mTaskId;
         Timepoint  mDeadline;
+        Timepoint  mLatestDeadline;
         Task<void> mTask;
     };
 
-    TaskId PushTask(Milliseconds aDelay, Task<void> aTask);
-    void   PopTasks(void);
+    TaskId     PushTask(Milliseconds aDelay, Milliseconds aSlack, Task<void> aTask);
+    void       PopTasks(void);
+    void       PushImmediateTask(ImmediateTask *aTask);
+    bool       PopImmediateTask(Task<void> &aTask);
+    void       Wakeup(void);
+    void       ClearWakeup(void);
+    Task<void> RemoveTaskAt(size_t aIndex);
+    void       SiftUp(size_t aIndex);
+    void       SiftDown(size_t aIndex);
+    void       SwapTasks(size_t aIndex1, size_t aIndex2);
+    void       UpdateWakeupRate(Timepoint aNow);
 
-    // The event fds which are used to wakeup the mainloop
-    // when there are pending tasks in the task queue.
+    // The event fds which are used to wakeup the mainloop when there are
+    // pending tasks. On Linux, both are the same eventfd.
     int mEventFd[2];
 
-    std::priority_queue<DelayedTask, std::vector<DelayedTask>, DelayedTask::Comparator> mTaskQueue;
+    // Whether the mainloop has been woken up but hasn't drained the tasks
+    // yet. This coalesces the wakeups of concurrent posts into one write.
+    std::atomic<bool> mWakeupPending;
 
-    std::set<TaskId> mActiveTaskIds;
-    TaskId           mNextTaskId = 1;
+    // Producers push to `mImmediateTaskHead` and the mainloop pops
+    // from `mImmediateTaskTail`. `mImmediateTaskStub` is never executed.
+    std::atomic<ImmediateTask *> mImmediateTaskHead;
+    ImmediateTask               *mImmediateTaskTail;
+    ImmediateTask                mImmediateTaskStub;
+
+    // The pending tasks are kept in a binary min-heap ordered by the deadline. The position of
+    // each task in the heap is indexed by its task ID so that a task can be removed (and its
+    // captured state be released) as soon as it's cancelled.
+    std::vector<DelayedTask>           mTaskQueue;
+    std::unordered_map<TaskId, size_t> mTaskIndexes;
+    TaskId                             mNextTaskId = 1;
+
+    // The latest deadlines of the pending tasks. The mainloop sleeps until the earliest of them
+    // and then executes every task whose deadline has passed, so that tasks with overlapping
+    // windows share a single wakeup.
+    std::set<std::pair<Timepoint, TaskId>> mLatestDeadlines;
 
     // The mutex which protects the `mTaskQueue` from being
     // simultaneously accessed by multiple threads.
     std::mutex mTaskQueueMutex;
+
+    uint64_t  mWakeupCount       = 0;
+    uint32_t  mWindowWakeupCount = 0;
+    Timepoint mWindowStart;
+    double    mWakeupsPerSecond = 0;
 };
 
 } // namespace otbr
@@ -26,6 +26,7 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <arpa/inet.h>
 #include <sstream>
 #include <sys/socket.h>
@@ -211,4 +212,81 @@ otError OtbrErrorToOtError(otbrError aError)
     return error;
 }
 
+uint8_t LatencyHistogram::GetBucket(uint64_t aLatencyUs)
+{
+    uint32_t bucket   = static_cast<uint32_t>(aLatencyUs);
+    uint8_t  exponent = kSubBucketBits;
+
+    if (aLatencyUs >= kSubBucketCount)
+    {
+        while (exponent < 63 && (aLatencyUs >> (exponent + 1)) != 0)
+        {
+            exponent++;
+        }
+
+        // The first `kSubBucketCount` buckets are taken by the latencies below 2^kSubBucketBits us, the
+        // sub-bucket is given by the bits following the most significant one.
+        bucket = kSubBucketCount * (exponent - kSubBucketBits + 1) +
+                 static_cast<uint32_t>((aLatencyUs >> (exponent - kSubBucketBits)) & (kSubBucketCount - 1));
+    }
+
+    return static_cast<uint8_t>(std::min<uint32_t>(bucket, kNumBuckets - 1));
+}
+
+uint64_t LatencyHistogram::GetBucketLowerBoundUs(uint8_t aBucket)
+{
+    uint64_t lowerBound = aBucket;
+
+    if (aBucket >= kSubBucketCount)
+    {
+        uint8_t shift = aBucket / kSubBucketCount - 1;
+
+        lowerBound = static_cast<uint64_t>(kSubBucketCount + aBucket % kSubBucketCount) << shift;
+    }
+
+    return lowerBound;
+}
+
+void LatencyHistogram::Record(uint64_t aLatencyUs)
+{
+    mCount++;
+    mTotalUs += aLatencyUs;
+    mMaxUs = static_cast<uint32_t>(std::max<uint64_t>(mMaxUs, std::min<uint64_t>(aLatencyUs, UINT32_MAX)));
+    mBuckets[GetBucket(aLatencyUs)]++;
+}
+
+uint32_t LatencyHistogram::GetPercentileUs(uint8_t aPercentile) const
+{
+    uint32_t percentile = 0;
+    uint64_t rank;
+    uint64_t count = 0;
+
+    VerifyOrExit(mCount > 0);
+
+    // The rank of the percentile latency among the recorded latencies, counting from 1.
+    rank = std::max<uint64_t>(1, (static_cast<uint64_t>(std::min<uint8_t>(aPercentile, 100)) * mCount + 99) / 100);
+
+    for (uint8_t bucket = 0; bucket < kNumBuckets; bucket++)
+    {
+        uint64_t lower;
+        uint64_t upper;
+
+        if (count + mBuckets[bucket] < rank)
+        {
+            count += mBuckets[bucket];
+            continue;
+        }
+
+        lower = GetBucketLowerBoundUs(bucket);
+        upper = (bucket == kNumBuckets - 1) ? std::max<uint64_t>(lower, mMaxUs) : GetBucketLowerBoundUs(bucket + 1);
+
+        percentile = static_cast<uint32_t>(
+            std::min<uint64_t>(lower + (upper - lower) * (rank - count) / mBuckets[bucket], mMaxUs));
+        break;
+    }
+
+exit:
+    return percentile;
+}
+
 } // namespace otbr
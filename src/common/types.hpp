@@ -39,6 +39,7 @@
 #include <netinet/in.h>
 #include <stdint.h>
 #include <string.h>
+#include <array>
 #include <string>
 #include <vector>
 
@@ -457,6 +458,66 @@ public:
     };
 };
 
+/**
+ * This structure represents a histogram of latencies in log-linear buckets.
+ *
+ * Latencies below `kSubBucketCount` us have a bucket each. Above that, each power-of-two range
+ * [2^n, 2^(n+1)) us is split into `kSubBucketCount` buckets of equal width, so that the relative
+ * error of a bucket is at most 1 / `kSubBucketCount`.
+ */
+struct LatencyHistogram
+{
+    static constexpr uint8_t kSubBucketBits  = 2;
+    static constexpr uint8_t kSubBucketCount = 1 << kSubBucketBits;
+    static constexpr uint8_t kMaxExponent    = 23; ///< The last bucket ends at 2^(kMaxExponent+1) us, about 16s.
+    static constexpr uint8_t kNumBuckets     = kSubBucketCount * (kMaxExponent - kSubBucketBits + 2);
+
+    /**
+     * This method returns the bucket of a latency.
+     *
+     * @param[in] aLatencyUs  The latency in microseconds.
+     *
+     * @returns The index of the bucket, latencies past the last bucket belong to the last bucket.
+     */
+    static uint8_t GetBucket(uint64_t aLatencyUs);
+
+    /**
+     * This method returns the smallest latency of a bucket.
+     *
+     * @param[in] aBucket  The index of the bucket, must be less than `kNumBuckets`.
+     *
+     * @returns The smallest latency of the bucket in microseconds.
+     */
+    static uint64_t GetBucketLowerBoundUs(uint8_t aBucket);
+
+    /**
+     * This method records a latency.
+     *
+     * @param[in] aLatencyUs  The latency in microseconds.
+     */
+    void Record(uint64_t aLatencyUs);
+
+    /**
+     * This method estimates a percentile of the recorded latencies.
+     *
+     * The estimate is interpolated linearly within the bucket holding the percentile, and is
+     * never larger than `mMaxUs`.
+     *
+     * @param[in] aPercentile  The percentile, in the range [0, 100].
+     *
+     * @returns The estimated percentile latency in microseconds, or 0 if no latency has been recorded.
+     */
+    uint32_t GetPercentileUs(uint8_t aPercentile) const;
+
+    uint32_t mCount   = 0; ///< The number of recorded latencies
+    uint64_t mTotalUs = 0; ///< The sum of recorded latencies in microseconds
+    uint32_t mMaxUs   = 0; ///< The max recorded latency in microseconds
+
+    // `mBuckets[i]` counts latencies in [GetBucketLowerBoundUs(i), GetBucketLowerBoundUs(i + 1)) us,
+    // and the last bucket also counts all larger latencies.
+    std::array<uint32_t, kNumBuckets> mBuckets{};
+};
+
 struct MdnsResponseCounters
 {
     uint32_t mSuccess;        ///< The number of successful responses
@@ -469,6 +530,12 @@ struct MdnsResponseCounters
     uint32_t mInvalidState;   ///< The number of 'invalid state' responses
 };
 
+struct MdnsBackendErrorCounter
+{
+    int32_t  mErrorCode; ///< The error code reported by the mDNS backend (avahi, mDNSResponder...)
+    uint32_t mCount;     ///< The number of times the error code has been reported
+};
+
 struct MdnsTelemetryInfo
 {
     static constexpr uint32_t kEmaFactorNumerator   = 1;
@@ -491,6 +558,28 @@ struct MdnsTelemetryInfo
     uint32_t mServiceResolutionEmaLatency;   ///< The EMA latency of service resolutions in milliseconds
 };
 
+struct MdnsOperationStats
+{
+    LatencyHistogram mHostRegistrationLatency;    ///< The latencies of host registrations
+    LatencyHistogram mKeyRegistrationLatency;     ///< The latencies of key registrations
+    LatencyHistogram mServiceRegistrationLatency; ///< The latencies of service registrations
+    LatencyHistogram mHostResolutionLatency;      ///< The latencies of host resolutions
+    LatencyHistogram mServiceResolutionLatency;   ///< The latencies of service resolutions
+
+    std::vector<MdnsBackendErrorCounter> mBackendErrors; ///< The failures by backend-specific error code
+
+    uint32_t mCoalescedRegistrationUpdates = 0; ///< The number of registration updates superseded by coalescing
+};
+
+struct MainloopProcessorStats
+{
+    std::string      mName;            ///< The name of the mainloop processor
+    LatencyHistogram mUpdateLatency;   ///< The wall time spent in `Update()`
+    LatencyHistogram mProcessLatency;  ///< The wall time spent in `Process()`
+    LatencyHistogram mDispatchLatency; ///< The time from the poll returning to `Process()` being called
+    uint32_t         mStallCount = 0;  ///< The number of `Update()` or `Process()` calls over the budget
+};
+
 static constexpr size_t kVendorOuiLength      = 3;
 static constexpr size_t kMaxVendorNameLength  = 24;
 static constexpr size_t kMaxProductNameLength = 24;
@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the worker pool which runs blocking work off the mainloop.
+ */
+
+#include "common/worker_pool.hpp"
+
+#include <assert.h>
+
+namespace otbr {
+
+constexpr size_t WorkerPool::kDefaultNumThreads;
+
+WorkerPool::WorkerPool(size_t aNumThreads)
+    : mStopping(false)
+    , mNextSequence(1)
+{
+    assert(aNumThreads > 0);
+
+    for (size_t i = 0; i < aNumThreads; i++)
+    {
+        mThreads.emplace_back(&WorkerPool::Run, this);
+    }
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        mStopping = true;
+    }
+
+    mCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+WorkerPool::SequenceId WorkerPool::CreateSequence(void)
+{
+    SequenceId sequence = mNextSequence++;
+
+    mAliveSequences.insert(sequence);
+
+    return sequence;
+}
+
+void WorkerPool::ReleaseSequence(SequenceId aSequence)
+{
+    mAliveSequences.erase(aSequence);
+}
+
+bool WorkerPool::IsSequenceAlive(SequenceId aSequence) const
+{
+    return mAliveSequences.count(aSequence) != 0;
+}
+
+void WorkerPool::Post(SequenceId aSequence, Work<void> aWork)
+{
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        mWorkQueue.push_back({aSequence, std::move(aWork)});
+    }
+
+    mCondition.notify_one();
+}
+
+std::deque<WorkerPool::WorkItem>::iterator WorkerPool::FindRunnableWork(void)
+{
+    // The earliest work item whose sequence is not running keeps the order within each sequence.
+    auto it = mWorkQueue.begin();
+
+    while (it != mWorkQueue.end() && mRunningSequences.count(it->mSequence) != 0)
+    {
+        ++it;
+    }
+
+    return it;
+}
+
+void WorkerPool::Run(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (true)
+    {
+        std::deque<WorkItem>::iterator it;
+        WorkItem                       item;
+
+        mCondition.wait(lock, [this]() {
+            return FindRunnableWork() != mWorkQueue.end() || (mStopping && mWorkQueue.empty());
+        });
+
+        it = FindRunnableWork();
+        if (it == mWorkQueue.end())
+        {
+            break;
+        }
+
+        item = std::move(*it);
+        mWorkQueue.erase(it);
+        mRunningSequences.insert(item.mSequence);
+
+        lock.unlock();
+        item.mWork();
+        item.mWork = nullptr;
+        lock.lock();
+
+        mRunningSequences.erase(item.mSequence);
+
+        // Work items of this sequence may have been waiting for this one.
+        mCondition.notify_all();
+    }
+}
+
+} // namespace otbr
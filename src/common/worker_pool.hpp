@@ -0,0 +1,229 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the worker pool which runs blocking work off the mainloop.
+ */
+
+#ifndef OTBR_COMMON_WORKER_POOL_HPP_
+#define OTBR_COMMON_WORKER_POOL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/inline_function.hpp"
+#include "common/task_runner.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a small pool of worker threads which runs blocking work, such as shell
+ * commands and `getifaddrs()`, off the mainloop.
+ *
+ * Work is posted on a sequence. Work items of one sequence run one at a time in the order they
+ * were posted, while work items of different sequences may run concurrently. Results are posted
+ * back to the mainloop and are delivered only while the sequence is not released.
+ */
+class WorkerPool : private NonCopyable
+{
+public:
+    /**
+     * This type represents a work item which runs on a worker thread.
+     */
+    template <class T> using Work = InlineFunction<T(void)>;
+
+    /**
+     * This type represents the handler which receives the result of a work item on the mainloop.
+     */
+    template <class T> using ResultHandler = InlineFunction<void(T)>;
+
+    /**
+     * This type represents a sequence of work items.
+     *
+     * Note: A valid sequence ID is never zero.
+     */
+    typedef uint64_t SequenceId;
+
+    static constexpr size_t kDefaultNumThreads = 2; ///< The number of worker threads of the shared pool.
+
+    /**
+     * This constructor starts the worker threads.
+     *
+     * @param[in] aNumThreads  The number of worker threads.
+     */
+    explicit WorkerPool(size_t aNumThreads);
+
+    /**
+     * This destructor runs the remaining work items and stops the worker threads.
+     *
+     * The results of the remaining work items are dropped.
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method returns the worker pool shared by the agent.
+     */
+    static WorkerPool &GetInstance(void)
+    {
+        static WorkerPool sWorkerPool(kDefaultNumThreads);
+        return sWorkerPool;
+    }
+
+    /**
+     * This method creates a new sequence.
+     *
+     * This method must be called on the mainloop thread.
+     *
+     * @returns The ID of the new sequence.
+     */
+    SequenceId CreateSequence(void);
+
+    /**
+     * This method releases a sequence.
+     *
+     * The queued work items of the sequence still run, but none of their results will be delivered
+     * after this method returns. This method must be called on the mainloop thread.
+     *
+     * @param[in] aSequence  The ID of the sequence.
+     */
+    void ReleaseSequence(SequenceId aSequence);
+
+    /**
+     * This method posts a work item whose result is not needed.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aSequence  The ID of the sequence.
+     * @param[in] aWork      The work item to run on a worker thread.
+     */
+    void Post(SequenceId aSequence, Work<void> aWork);
+
+    /**
+     * This method posts a work item and delivers its result to the mainloop.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aSequence       The ID of the sequence.
+     * @param[in] aWork           The work item to run on a worker thread.
+     * @param[in] aResultHandler  The handler which receives the result on the mainloop.
+     */
+    template <class T> void Post(SequenceId aSequence, Work<T> aWork, ResultHandler<T> aResultHandler)
+    {
+        Post(aSequence, WorkWithResult<T>(*this, aSequence, std::move(aWork), std::move(aResultHandler)));
+    }
+
+private:
+    template <class T> class ResultTask
+    {
+    public:
+        ResultTask(WorkerPool &aPool, SequenceId aSequence, ResultHandler<T> aResultHandler, T aResult)
+            : mPool(aPool)
+            , mSequence(aSequence)
+            , mResultHandler(std::move(aResultHandler))
+            , mResult(std::move(aResult))
+        {
+        }
+
+        void operator()(void)
+        {
+            if (mPool.IsSequenceAlive(mSequence))
+            {
+                mResultHandler(std::move(mResult));
+            }
+        }
+
+    private:
+        WorkerPool      &mPool;
+        SequenceId       mSequence;
+        ResultHandler<T> mResultHandler;
+        T                mResult;
+    };
+
+    template <class T> class WorkWithResult
+    {
+    public:
+        WorkWithResult(WorkerPool &aPool, SequenceId aSequence, Work<T> aWork, ResultHandler<T> aResultHandler)
+            : mPool(aPool)
+            , mSequence(aSequence)
+            , mWork(std::move(aWork))
+            , mResultHandler(std::move(aResultHandler))
+        {
+        }
+
+        void operator()(void)
+        {
+            mPool.mTaskRunner.Post(ResultTask<T>(mPool, mSequence, std::move(mResultHandler), mWork()));
+        }
+
+    private:
+        WorkerPool      &mPool;
+        SequenceId       mSequence;
+        Work<T>          mWork;
+        ResultHandler<T> mResultHandler;
+    };
+
+    struct WorkItem
+    {
+        SequenceId mSequence;
+        Work<void> mWork;
+    };
+
+    void                           Run(void);
+    std::deque<WorkItem>::iterator FindRunnableWork(void);
+    bool                           IsSequenceAlive(SequenceId aSequence) const;
+
+    std::vector<std::thread> mThreads;
+
+    // The mutex which protects the work queue and the running sequences.
+    std::mutex              mMutex;
+    std::condition_variable mCondition;
+    std::deque<WorkItem>    mWorkQueue;
+    std::set<SequenceId>    mRunningSequences;
+    bool                    mStopping;
+
+    // The sequences which are not released. Accessed on the mainloop thread only.
+    std::unordered_set<SequenceId> mAliveSequences;
+    SequenceId                     mNextSequence;
+
+    // Delivers the results to the mainloop.
+    TaskRunner mTaskRunner;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_WORKER_POOL_HPP_
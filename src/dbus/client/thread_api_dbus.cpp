@@ -681,6 +681,11 @@ ClientError ThreadApiDBus::GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetr
     return GetProperty(OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO, aMdnsTelemetryInfo);
 }
 
+ClientError ThreadApiDBus::GetMdnsOperationStats(MdnsOperationStats &aMdnsOperationStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MDNS_OPERATION_STATS, aMdnsOperationStats);
+}
+
 ClientError ThreadApiDBus::GetNat64State(Nat64ComponentState &aState)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_NAT64_STATE, aState);
@@ -718,6 +723,11 @@ ClientError ThreadApiDBus::GetCapabilities(std::vector<uint8_t> &aCapabilities)
     return GetProperty(OTBR_DBUS_PROPERTY_CAPABILITIES, aCapabilities);
 }
 
+ClientError ThreadApiDBus::GetMainloopStats(std::vector<MainloopProcessorStats> &aStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MAINLOOP_STATS, aStats);
+}
+
 std::string ThreadApiDBus::GetInterfaceName(void)
 {
     return mInterfaceName;
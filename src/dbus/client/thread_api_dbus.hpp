@@ -758,6 +758,17 @@ public:
      */
     ClientError GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetryInfo);
 
+    /**
+     * This method gets the latency histograms and backend errors of the MDNS publisher.
+     *
+     * @param[out] aMdnsOperationStats  The MDNS operation statistics.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetMdnsOperationStats(MdnsOperationStats &aMdnsOperationStats);
+
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     /**
      * This method gets the DNS-SD counters.
@@ -864,6 +875,17 @@ public:
      */
     ClientError GetCapabilities(std::vector<uint8_t> &aCapabilities);
 
+    /**
+     * This method gets the latency statistics of the mainloop processors.
+     *
+     * @param[out] aStats  The statistics of each mainloop processor.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetMainloopStats(std::vector<MainloopProcessorStats> &aStats);
+
 private:
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
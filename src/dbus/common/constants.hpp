@@ -110,6 +110,7 @@
 #define OTBR_DBUS_PROPERTY_THREAD_VERSION "ThreadVersion"
 #define OTBR_DBUS_PROPERTY_EUI64 "Eui64"
 #define OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO "MdnsTelemetryInfo"
+#define OTBR_DBUS_PROPERTY_MDNS_OPERATION_STATS "MdnsOperationStats"
 #define OTBR_DBUS_PROPERTY_RADIO_SPINEL_METRICS "RadioSpinelMetrics"
 #define OTBR_DBUS_PROPERTY_RCP_INTERFACE_METRICS "RcpInterfaceMetrics"
 #define OTBR_DBUS_PROPERTY_UPTIME "Uptime"
@@ -126,6 +127,7 @@
 #define OTBR_DBUS_PROPERTY_DHCP6_PD_STATE "Dhcp6PdState"
 #define OTBR_DBUS_PROPERTY_TELEMETRY_DATA "TelemetryData"
 #define OTBR_DBUS_PROPERTY_CAPABILITIES "Capabilities"
+#define OTBR_DBUS_PROPERTY_MAINLOOP_STATS "MainloopStats"
 
 #define OTBR_NAT64_STATE_NAME_DISABLED "disabled"
 #define OTBR_NAT64_STATE_NAME_NOT_RUNNING "not_running"
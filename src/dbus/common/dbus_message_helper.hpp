@@ -87,8 +87,12 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo &aSrpSer
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo &aSrpServerInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsResponseCounters &aMdnsResponseCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsResponseCounters &aMdnsResponseCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsBackendErrorCounter &aCounter);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsBackendErrorCounter &aCounter);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTelemetryInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsOperationStats &aMdnsOperationStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsOperationStats &aMdnsOperationStats);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const DnssdCounters &aDnssdCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, DnssdCounters &aDnssdCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics);
@@ -119,6 +123,10 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo &aTrelInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo &aTrelInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo::TrelPacketCounters &aCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo::TrelPacketCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const LatencyHistogram &aHistogram);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, LatencyHistogram &aHistogram);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopProcessorStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopProcessorStats &aStats);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -274,6 +282,12 @@ template <> struct DBusTypeTrait<SrpServerInfo>
     static constexpr const char *TYPE_AS_STRING = "(yqy(uutttt)(uutttt)(uuuuuu))";
 };
 
+template <> struct DBusTypeTrait<MdnsBackendErrorCounter>
+{
+    // struct of { int32, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(iu)";
+};
+
 template <> struct DBusTypeTrait<MdnsTelemetryInfo>
 {
     // struct of { struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32 },
@@ -284,6 +298,18 @@ template <> struct DBusTypeTrait<MdnsTelemetryInfo>
     static constexpr const char *TYPE_AS_STRING = "((uuuuuuuu)(uuuuuuuu)(uuuuuuuu)(uuuuuuuu)uuuu)";
 };
 
+template <> struct DBusTypeTrait<MdnsOperationStats>
+{
+    // struct of { struct of { uint32, uint64, uint32, array of uint32 },
+    //             struct of { uint32, uint64, uint32, array of uint32 },
+    //             struct of { uint32, uint64, uint32, array of uint32 },
+    //             struct of { uint32, uint64, uint32, array of uint32 },
+    //             struct of { uint32, uint64, uint32, array of uint32 },
+    //             array of struct of { int32, uint32 },
+    //             uint32 }
+    static constexpr const char *TYPE_AS_STRING = "((utuau)(utuau)(utuau)(utuau)(utuau)a(iu)u)";
+};
+
 template <> struct DBusTypeTrait<DnssdCounters>
 {
     // struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32 }
@@ -407,6 +433,32 @@ template <> struct DBusTypeTrait<InfraLinkInfo>
     static constexpr const char *TYPE_AS_STRING = "(sbbbuuu)";
 };
 
+template <> struct DBusTypeTrait<LatencyHistogram>
+{
+    // struct of { uint32, uint64, uint32, array of uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(utuau)";
+};
+
+template <> struct DBusTypeTrait<MainloopProcessorStats>
+{
+    // struct of { string,
+    //             struct of { uint32, uint64, uint32, array of uint32 },
+    //             struct of { uint32, uint64, uint32, array of uint32 },
+    //             struct of { uint32, uint64, uint32, array of uint32 },
+    //             uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(s(utuau)(utuau)(utuau)u)";
+};
+
+template <> struct DBusTypeTrait<std::vector<MainloopProcessorStats>>
+{
+    // array of struct of { string,
+    //                      struct of { uint32, uint64, uint32, array of uint32 },
+    //                      struct of { uint32, uint64, uint32, array of uint32 },
+    //                      struct of { uint32, uint64, uint32, array of uint32 },
+    //                      uint32 }
+    static constexpr const char *TYPE_AS_STRING = "a(s(utuau)(utuau)(utuau)u)";
+};
+
 template <> struct DBusTypeTrait<int8_t>
 {
     static constexpr int         TYPE           = DBUS_TYPE_BYTE;
@@ -692,6 +692,36 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsBackendErrorCounter &aCounter)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounter.mErrorCode));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aCounter.mCount));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsBackendErrorCounter &aCounter)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounter.mErrorCode));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aCounter.mCount));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo)
 {
     DBusMessageIter sub;
@@ -736,6 +766,48 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsOperationStats &aMdnsOperationStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsOperationStats.mHostRegistrationLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsOperationStats.mKeyRegistrationLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsOperationStats.mServiceRegistrationLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsOperationStats.mHostResolutionLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsOperationStats.mServiceResolutionLatency));
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsOperationStats.mBackendErrors));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsOperationStats.mCoalescedRegistrationUpdates));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsOperationStats &aMdnsOperationStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsOperationStats.mHostRegistrationLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsOperationStats.mKeyRegistrationLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsOperationStats.mServiceRegistrationLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsOperationStats.mHostResolutionLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsOperationStats.mServiceResolutionLatency));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsOperationStats.mBackendErrors));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsOperationStats.mCoalescedRegistrationUpdates));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics)
 {
     DBusMessageIter sub;
@@ -1258,5 +1330,75 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const LatencyHistogram &aHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistogram.mCount));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistogram.mTotalUs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistogram.mMaxUs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHistogram.mBuckets));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, LatencyHistogram &aHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistogram.mCount));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistogram.mTotalUs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistogram.mMaxUs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHistogram.mBuckets));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopProcessorStats &aStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mUpdateLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mProcessLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mDispatchLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mStallCount));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopProcessorStats &aStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mUpdateLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mProcessLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mDispatchLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mStallCount));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
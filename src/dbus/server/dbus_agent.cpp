@@ -53,7 +53,7 @@ DBusAgent::DBusAgent(otbr::Host::ThreadHost &aHost, Mdns::Publisher &aPublisher)
 {
 }
 
-void DBusAgent::Init(otbr::BorderAgent &aBorderAgent)
+void DBusAgent::Init(otbr::BorderAgent &aBorderAgent, const AdvertisingProxy *aAdvertisingProxy)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -71,7 +71,8 @@ void DBusAgent::Init(otbr::BorderAgent &aBorderAgent)
     {
     case OT_COPROCESSOR_RCP:
         mThreadObject = MakeUnique<DBusThreadObjectRcp>(*mConnection, mInterfaceName,
-                                                        static_cast<Host::RcpHost &>(mHost), &mPublisher, aBorderAgent);
+                                                        static_cast<Host::RcpHost &>(mHost), &mPublisher,
+                                                        aAdvertisingProxy, aBorderAgent);
         break;
 
     case OT_COPROCESSOR_NCP:
@@ -66,11 +66,15 @@ public:
 
     /**
      * This method initializes the dbus agent.
+     *
+     * @param[in] aBorderAgent       A reference to the Border Agent.
+     * @param[in] aAdvertisingProxy  A pointer to the Advertising Proxy, or `nullptr` if there isn't one.
      */
-    void Init(otbr::BorderAgent &aBorderAgent);
+    void Init(otbr::BorderAgent &aBorderAgent, const AdvertisingProxy *aAdvertisingProxy);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "DBusAgent"; }
 
 private:
     using Clock                                              = std::chrono::steady_clock;
@@ -49,6 +49,7 @@
 #include "common/api_strings.hpp"
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
+#include "common/mainloop_manager.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object_rcp.hpp"
@@ -101,14 +102,16 @@ static std::string GetNat64StateName(otNat64State aState)
 namespace otbr {
 namespace DBus {
 
-DBusThreadObjectRcp::DBusThreadObjectRcp(DBusConnection      &aConnection,
-                                         const std::string   &aInterfaceName,
-                                         otbr::Host::RcpHost &aHost,
-                                         Mdns::Publisher     *aPublisher,
-                                         otbr::BorderAgent   &aBorderAgent)
+DBusThreadObjectRcp::DBusThreadObjectRcp(DBusConnection         &aConnection,
+                                         const std::string      &aInterfaceName,
+                                         otbr::Host::RcpHost    &aHost,
+                                         Mdns::Publisher        *aPublisher,
+                                         const AdvertisingProxy *aAdvertisingProxy,
+                                         otbr::BorderAgent      &aBorderAgent)
     : DBusObject(&aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mHost(aHost)
     , mPublisher(aPublisher)
+    , mAdvertisingProxy(aAdvertisingProxy)
     , mBorderAgent(aBorderAgent)
 {
 }
@@ -265,6 +268,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetSrpServerInfoHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO,
                                std::bind(&DBusThreadObjectRcp::GetMdnsTelemetryInfoHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MDNS_OPERATION_STATS,
+                               std::bind(&DBusThreadObjectRcp::GetMdnsOperationStatsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNSSD_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetDnssdCountersHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OTBR_VERSION,
@@ -307,6 +312,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetTelemetryDataHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CAPABILITIES,
                                std::bind(&DBusThreadObjectRcp::GetCapabilitiesHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MAINLOOP_STATS,
+                               std::bind(&DBusThreadObjectRcp::GetMainloopStatsHandler, this, _1));
 
     SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 
@@ -1422,6 +1429,16 @@ exit:
     return error;
 }
 
+otError DBusThreadObjectRcp::GetMdnsOperationStatsHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mPublisher->GetMdnsOperationStats()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+exit:
+    return error;
+}
+
 otError DBusThreadObjectRcp::GetDnssdCountersHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
@@ -1485,7 +1502,7 @@ otError DBusThreadObjectRcp::GetTelemetryDataHandler(DBusMessageIter &aIter)
     threadnetwork::TelemetryData telemetryData;
     auto                         threadHelper = mHost.GetThreadHelper();
 
-    if (threadHelper->RetrieveTelemetryData(mPublisher, telemetryData) != OT_ERROR_NONE)
+    if (threadHelper->RetrieveTelemetryData(mPublisher, mAdvertisingProxy, telemetryData) != OT_ERROR_NONE)
     {
         otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
     }
@@ -1685,6 +1702,18 @@ exit:
     return error;
 }
 
+otError DBusThreadObjectRcp::GetMainloopStatsHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, MainloopManager::GetInstance().GetProcessorStats()) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObjectRcp::GetRadioCoexMetrics(DBusMessageIter &aIter)
 {
     otError            error = OT_ERROR_NONE;
@@ -63,17 +63,19 @@ public:
     /**
      * This constructor of dbus thread object.
      *
-     * @param[in] aConnection     The dbus connection.
-     * @param[in] aInterfaceName  The dbus interface name.
-     * @param[in] aHost           The Thread controller
-     * @param[in] aPublisher      The Mdns::Publisher
-     * @param[in] aBorderAgent    The Border Agent
+     * @param[in] aConnection        The dbus connection.
+     * @param[in] aInterfaceName     The dbus interface name.
+     * @param[in] aHost              The Thread controller
+     * @param[in] aPublisher         The Mdns::Publisher
+     * @param[in] aAdvertisingProxy  The Advertising Proxy, or `nullptr` if there isn't one.
+     * @param[in] aBorderAgent       The Border Agent
      */
-    DBusThreadObjectRcp(DBusConnection      &aConnection,
-                        const std::string   &aInterfaceName,
-                        otbr::Host::RcpHost &aHost,
-                        Mdns::Publisher     *aPublisher,
-                        otbr::BorderAgent   &aBorderAgent);
+    DBusThreadObjectRcp(DBusConnection         &aConnection,
+                        const std::string      &aInterfaceName,
+                        otbr::Host::RcpHost    &aHost,
+                        Mdns::Publisher        *aPublisher,
+                        const AdvertisingProxy *aAdvertisingProxy,
+                        otbr::BorderAgent      &aBorderAgent);
 
     otbrError Init(void) override;
 
@@ -158,6 +160,7 @@ private:
     otError GetRadioRegionHandler(DBusMessageIter &aIter);
     otError GetSrpServerInfoHandler(DBusMessageIter &aIter);
     otError GetMdnsTelemetryInfoHandler(DBusMessageIter &aIter);
+    otError GetMdnsOperationStatsHandler(DBusMessageIter &aIter);
     otError GetDnssdCountersHandler(DBusMessageIter &aIter);
     otError GetOtbrVersionHandler(DBusMessageIter &aIter);
     otError GetOtHostVersionHandler(DBusMessageIter &aIter);
@@ -179,6 +182,7 @@ private:
     otError GetDnsUpstreamQueryState(DBusMessageIter &aIter);
     otError GetTelemetryDataHandler(DBusMessageIter &aIter);
     otError GetCapabilitiesHandler(DBusMessageIter &aIter);
+    otError GetMainloopStatsHandler(DBusMessageIter &aIter);
 
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
     void ReplyEnergyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otEnergyScanResult> &aResult);
@@ -186,6 +190,7 @@ private:
     otbr::Host::RcpHost                                 &mHost;
     std::unordered_map<std::string, PropertyHandlerType> mGetPropertyHandlers;
     otbr::Mdns::Publisher                               *mPublisher;
+    const otbr::AdvertisingProxy                        *mAdvertisingProxy;
     otbr::BorderAgent                                   &mBorderAgent;
 };
 
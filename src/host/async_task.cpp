@@ -32,15 +32,21 @@
 #include <memory>
 
 #include "common/code_utils.hpp"
+#include "common/pool_allocator.hpp"
 
 namespace otbr {
 namespace Host {
 
-AsyncTask::AsyncTask(const ResultHandler &aResultHandler)
-    : mResultHandler(aResultHandler)
+AsyncTask::AsyncTask(ResultHandler aResultHandler)
+    : mResultHandler(std::move(aResultHandler))
 {
 }
 
+AsyncTaskPtr AsyncTask::Create(ResultHandler aResultHandler)
+{
+    return std::allocate_shared<AsyncTask>(PoolAllocator<AsyncTask>(), std::move(aResultHandler));
+}
+
 AsyncTask::~AsyncTask()
 {
     if (!mNext)
@@ -78,19 +84,21 @@ void AsyncTask::SetResult(otError aError, const std::string &aErrorInfo)
     }
 }
 
-AsyncTaskPtr &AsyncTask::First(const ThenHandler &aFirst)
+AsyncTaskPtr &AsyncTask::First(ThenHandler aFirst)
 {
     assert(mNext == nullptr);
 
-    return Then(aFirst);
+    return Then(std::move(aFirst));
 }
 
-AsyncTaskPtr &AsyncTask::Then(const ThenHandler &aThen)
+AsyncTaskPtr &AsyncTask::Then(ThenHandler aThen)
 {
     assert(mNext == nullptr);
 
-    mNext = std::make_shared<AsyncTask>(mResultHandler);
-    mThen = aThen;
+    // The result handler is handed over to the next task.
+    mNext          = Create(std::move(mResultHandler));
+    mResultHandler = nullptr;
+    mThen          = std::move(aThen);
 
     return mNext;
 }
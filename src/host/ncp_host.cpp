@@ -154,10 +154,8 @@ void NcpHost::Deinit(void)
 
 void NcpHost::Join(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs, const AsyncResultReceiver &aReceiver)
 {
-    AsyncTaskPtr task;
-    auto errorHandler = [aReceiver](otError aError, const std::string &aErrorInfo) { aReceiver(aError, aErrorInfo); };
+    AsyncTaskPtr task = AsyncTask::Create(aReceiver);
 
-    task = std::make_shared<AsyncTask>(errorHandler);
     task->First([this, aActiveOpDatasetTlvs](AsyncTaskPtr aNext) {
             mNcpSpinel.DatasetSetActiveTlvs(aActiveOpDatasetTlvs, std::move(aNext));
         })
@@ -168,10 +166,8 @@ void NcpHost::Join(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs, const A
 
 void NcpHost::Leave(bool aEraseDataset, const AsyncResultReceiver &aReceiver)
 {
-    AsyncTaskPtr task;
-    auto errorHandler = [aReceiver](otError aError, const std::string &aErrorInfo) { aReceiver(aError, aErrorInfo); };
+    AsyncTaskPtr task = AsyncTask::Create(aReceiver);
 
-    task = std::make_shared<AsyncTask>(errorHandler);
     task->First([this](AsyncTaskPtr aNext) { mNcpSpinel.ThreadDetachGracefully(std::move(aNext)); })
         ->Then([this, aEraseDataset](AsyncTaskPtr aNext) {
             if (aEraseDataset)
@@ -191,12 +187,11 @@ void NcpHost::ScheduleMigration(const otOperationalDatasetTlvs &aPendingOpDatase
 {
     otDeviceRole role  = GetDeviceRole();
     otError      error = OT_ERROR_NONE;
-    auto errorHandler  = [aReceiver](otError aError, const std::string &aErrorInfo) { aReceiver(aError, aErrorInfo); };
 
     VerifyOrExit(role != OT_DEVICE_ROLE_DISABLED && role != OT_DEVICE_ROLE_DETACHED, error = OT_ERROR_INVALID_STATE);
 
     mNcpSpinel.DatasetMgmtSetPending(std::make_shared<otOperationalDatasetTlvs>(aPendingOpDatasetTlvs),
-                                     std::make_shared<AsyncTask>(errorHandler));
+                                     AsyncTask::Create(aReceiver));
 
 exit:
     if (error != OT_ERROR_NONE)
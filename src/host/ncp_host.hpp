@@ -122,8 +122,9 @@ public:
     void Deinit(void) override;
 
     // MainloopProcessor methods
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "NcpHost"; }
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     void SetMdnsPublisher(Mdns::Publisher *aPublisher);
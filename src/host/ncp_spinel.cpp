@@ -109,10 +109,7 @@ void NcpSpinel::DatasetSetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDa
         return aEncoder.WriteData(aActiveOpDatasetTlvs.mTlvs, aActiveOpDatasetTlvs.mLength);
     };
 
-    VerifyOrExit(mDatasetSetActiveTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, encodingFunc));
-    mDatasetSetActiveTask = aAsyncTask;
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, encodingFunc, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -146,10 +143,7 @@ void NcpSpinel::Ip6SetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
     otError      error        = OT_ERROR_NONE;
     EncodingFunc encodingFunc = [aEnable](ot::Spinel::Encoder &aEncoder) { return aEncoder.WriteBool(aEnable); };
 
-    VerifyOrExit(mIp6SetEnabledTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_IF_UP, encodingFunc));
-    mIp6SetEnabledTask = aAsyncTask;
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_IF_UP, encodingFunc, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -178,10 +172,7 @@ void NcpSpinel::ThreadSetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
     otError      error        = OT_ERROR_NONE;
     EncodingFunc encodingFunc = [aEnable](ot::Spinel::Encoder &aEncoder) { return aEncoder.WriteBool(aEnable); };
 
-    VerifyOrExit(mThreadSetEnabledTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_STACK_UP, encodingFunc));
-    mThreadSetEnabledTask = aAsyncTask;
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_STACK_UP, encodingFunc, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -215,13 +206,12 @@ void NcpSpinel::ThreadErasePersistentInfo(AsyncTaskPtr aAsyncTask)
     otError      error = OT_ERROR_NONE;
     spinel_tid_t tid   = GetNextTid();
 
-    VerifyOrExit(mThreadErasePersistentInfoTask == nullptr, error = OT_ERROR_BUSY);
-
+    VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
     SuccessOrExit(error = mSpinelDriver->SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, tid));
 
-    mWaitingKeyTable[tid]          = SPINEL_PROP_LAST_STATUS;
-    mCmdTable[tid]                 = SPINEL_CMD_NET_CLEAR;
-    mThreadErasePersistentInfoTask = aAsyncTask;
+    mWaitingKeyTable[tid] = SPINEL_PROP_LAST_STATUS;
+    mCmdTable[tid]        = SPINEL_CMD_NET_CLEAR;
+    mTidTaskTable[tid]    = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -371,7 +361,7 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
         spinel_status_t status = SPINEL_STATUS_OK;
 
         SuccessOrExit(error = SpinelDataUnpack(data, len, SPINEL_DATATYPE_UINT_PACKED_S, &status));
-        CallAndClear(mThreadErasePersistentInfoTask, ot::Spinel::SpinelStatusToOtError(status));
+        CallAndClear(mTidTaskTable[aTid], ot::Spinel::SpinelStatusToOtError(status));
         break;
     }
     default:
@@ -388,6 +378,8 @@ exit:
     {
         otbrLogCrit("Error parsing response with tid:%u", aTid);
     }
+    // A transaction whose response didn't complete its receiver has failed.
+    CallAndClear(mTidTaskTable[aTid], OT_ERROR_FAILED, "Unexpected response!");
     FreeTidTableItem(aTid);
 }
 
@@ -697,7 +689,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
     {
     case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
         VerifyOrExit(aKey == SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, error = OTBR_ERROR_INVALID_STATE);
-        CallAndClear(mDatasetSetActiveTask, OT_ERROR_NONE);
+        CallAndClear(mTidTaskTable[aTid], OT_ERROR_NONE);
         {
             otOperationalDatasetTlvs datasetTlvs;
             VerifyOrExit(ParseOperationalDatasetTlvs(aData, aLength, datasetTlvs) == OT_ERROR_NONE,
@@ -708,7 +700,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
 
     case SPINEL_PROP_NET_IF_UP:
         VerifyOrExit(aKey == SPINEL_PROP_NET_IF_UP, error = OTBR_ERROR_INVALID_STATE);
-        CallAndClear(mIp6SetEnabledTask, OT_ERROR_NONE);
+        CallAndClear(mTidTaskTable[aTid], OT_ERROR_NONE);
         {
             bool isUp;
             SuccessOrExit(error = SpinelDataUnpack(aData, aLength, SPINEL_DATATYPE_BOOL_S, &isUp));
@@ -718,7 +710,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
 
     case SPINEL_PROP_NET_STACK_UP:
         VerifyOrExit(aKey == SPINEL_PROP_NET_STACK_UP, error = OTBR_ERROR_INVALID_STATE);
-        CallAndClear(mThreadSetEnabledTask, OT_ERROR_NONE);
+        CallAndClear(mTidTaskTable[aTid], OT_ERROR_NONE);
         break;
 
     case SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS:
@@ -881,9 +873,13 @@ void NcpSpinel::FreeTidTableItem(spinel_tid_t aTid)
 
     mCmdTable[aTid]        = SPINEL_CMD_NOOP;
     mWaitingKeyTable[aTid] = SPINEL_PROP_LAST_STATUS;
+    mTidTaskTable[aTid]    = nullptr;
 }
 
-otError NcpSpinel::SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
+otError NcpSpinel::SendCommand(spinel_command_t    aCmd,
+                               spinel_prop_key_t   aKey,
+                               const EncodingFunc &aEncodingFunc,
+                               AsyncTaskPtr        aAsyncTask)
 {
     otError      error  = OT_ERROR_NONE;
     spinel_tid_t tid    = GetNextTid();
@@ -897,6 +893,7 @@ otError NcpSpinel::SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, co
 
     mCmdTable[tid]        = aCmd;
     mWaitingKeyTable[tid] = aKey;
+    mTidTaskTable[tid]    = std::move(aAsyncTask);
 exit:
     if (error != OT_ERROR_NONE)
     {
@@ -905,9 +902,9 @@ exit:
     return error;
 }
 
-otError NcpSpinel::SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
+otError NcpSpinel::SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc, AsyncTaskPtr aAsyncTask)
 {
-    return SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, aEncodingFunc);
+    return SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, aEncodingFunc, std::move(aAsyncTask));
 }
 
 otError NcpSpinel::InsertProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
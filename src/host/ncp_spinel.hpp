@@ -124,8 +124,8 @@ public:
     /**
      * This method sets the active dataset on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * This method may be called again before the previous call completed. The result of each call is
+     * delivered to its own receiver, matched by the transaction id of the response.
      *
      * @param[in] aActiveOpDatasetTlvs  A reference to the active operational dataset of the Thread network.
      * @param[in] aAsyncTask            A pointer to an async result to receive the result of this operation.
@@ -147,8 +147,8 @@ public:
     /**
      * This method enableds/disables the IP6 on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * This method may be called again before the previous call completed. The result of each call is
+     * delivered to its own receiver, matched by the transaction id of the response.
      *
      * @param[in] aEnable     TRUE to enable and FALSE to disable.
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
@@ -201,8 +201,8 @@ public:
     /**
      * This method enableds/disables the Thread network on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * This method may be called again before the previous call completed. The result of each call is
+     * delivered to its own receiver, matched by the transaction id of the response.
      *
      * @param[in] aEnable     TRUE to enable and FALSE to disable.
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
@@ -222,8 +222,8 @@ public:
     /**
      * This method instructs the NCP to erase the persistent network info.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * This method may be called again before the previous call completed. The result of each call is
+     * delivered to its own receiver, matched by the transaction id of the response.
      *
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
      */
@@ -301,8 +301,10 @@ private:
     {
         if (aResult)
         {
-            aResult->SetResult(aError, aErrorInfo);
+            AsyncTaskPtr result = std::move(aResult);
+
             aResult = nullptr;
+            result->SetResult(aError, aErrorInfo);
         }
     }
 
@@ -344,8 +346,11 @@ private:
     void         FreeTidTableItem(spinel_tid_t aTid);
 
     using EncodingFunc = std::function<otError(ot::Spinel::Encoder &aEncoder)>;
-    otError SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
-    otError SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
+    otError SendCommand(spinel_command_t    aCmd,
+                        spinel_prop_key_t   aKey,
+                        const EncodingFunc &aEncodingFunc,
+                        AsyncTaskPtr        aAsyncTask = nullptr);
+    otError SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc, AsyncTaskPtr aAsyncTask = nullptr);
     otError InsertProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
     otError RemoveProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
 
@@ -378,6 +383,8 @@ private:
     spinel_prop_key_t mWaitingKeyTable[kMaxTids]; ///< The property keys of ongoing transactions.
     spinel_command_t  mCmdTable[kMaxTids];        ///< The mapping of spinel command and tids when the response
                                                   ///< is LAST_STATUS.
+    AsyncTaskPtr      mTidTaskTable[kMaxTids];    ///< The receivers of ongoing transactions which complete with
+                                                  ///< their responses.
 
     static constexpr uint16_t kTxBufferSize = 2048;
     uint8_t                   mTxBuffer[kTxBufferSize];
@@ -392,12 +399,10 @@ private:
     otbr::Mdns::Publisher *mPublisher;
 #endif
 
-    AsyncTaskPtr mDatasetSetActiveTask;
+    // These operations complete with a notification rather than with the response of their transaction,
+    // so only one call of each may be outstanding.
     AsyncTaskPtr mDatasetMgmtSetPendingTask;
-    AsyncTaskPtr mIp6SetEnabledTask;
-    AsyncTaskPtr mThreadSetEnabledTask;
     AsyncTaskPtr mThreadDetachGracefullyTask;
-    AsyncTaskPtr mThreadErasePersistentInfoTask;
 
     Ip6AddressTableCallback          mIp6AddressTableCallback;
     Ip6MulticastAddressTableCallback mIp6MulticastAddressTableCallback;
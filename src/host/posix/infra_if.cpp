@@ -70,11 +70,21 @@ InfraIf::InfraIf(Dependencies &aDependencies)
     , mInfraIfIndex(0)
 #ifdef __linux__
     , mNetlinkSocket(-1)
+    , mAddressQuerySequence(WorkerPool::GetInstance().CreateSequence())
+    , mAddressQueryPending(false)
+    , mAddressQueryDirty(false)
 #endif
     , mInfraIfIcmp6Socket(-1)
 {
 }
 
+InfraIf::~InfraIf(void)
+{
+#ifdef __linux__
+    WorkerPool::GetInstance().ReleaseSequence(mAddressQuerySequence);
+#endif
+}
+
 #ifdef __linux__
 // Create a Netlink socket that subscribes to link & addresses events.
 int CreateNetlinkSocket(void)
@@ -180,7 +190,7 @@ otbrError InfraIf::SetInfraIf(const char *aIfName)
     mInfraIfIcmp6Socket = CreateIcmp6Socket(aIfName);
     VerifyOrDie(mInfraIfIcmp6Socket != -1, "Failed to create Icmp6 socket!");
 
-    addresses = GetAddresses();
+    addresses = GetAddresses(mInfraIfName);
 
     SuccessOrExit(mDeps.SetInfraIf(mInfraIfIndex, IsRunning(addresses), addresses), error = OTBR_ERROR_OPENTHREAD);
 exit:
@@ -344,7 +354,7 @@ short InfraIf::GetFlags(void) const
     return ifReq.ifr_flags;
 }
 
-std::vector<Ip6Address> InfraIf::GetAddresses(void)
+std::vector<Ip6Address> InfraIf::GetAddresses(const char *aInfraIfName)
 {
     struct ifaddrs         *ifAddrs = nullptr;
     std::vector<Ip6Address> addrs;
@@ -359,7 +369,7 @@ std::vector<Ip6Address> InfraIf::GetAddresses(void)
     {
         struct sockaddr_in6 *ip6Addr;
 
-        if (strncmp(addr->ifa_name, mInfraIfName, sizeof(mInfraIfName)) != 0 || addr->ifa_addr == nullptr ||
+        if (strncmp(addr->ifa_name, aInfraIfName, IFNAMSIZ) != 0 || addr->ifa_addr == nullptr ||
             addr->ifa_addr->sa_family != AF_INET6)
         {
             continue;
@@ -490,12 +500,8 @@ void InfraIf::ReceiveNetlinkMessage(void)
         case RTM_DELADDR:
         case RTM_NEWLINK:
         case RTM_DELLINK:
-        {
-            std::vector<Ip6Address> addresses = GetAddresses();
-
-            mDeps.SetInfraIf(mInfraIfIndex, IsRunning(addresses), addresses);
+            QueryAddresses();
             break;
-        }
         case NLMSG_ERROR:
         {
             struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
@@ -509,6 +515,45 @@ void InfraIf::ReceiveNetlinkMessage(void)
         }
     }
 
+exit:
+    return;
+}
+
+void InfraIf::QueryAddresses(void)
+{
+    std::string infraIfName;
+
+    if (mAddressQueryPending)
+    {
+        mAddressQueryDirty = true;
+        ExitNow();
+    }
+
+    mAddressQueryPending = true;
+    infraIfName          = mInfraIfName;
+
+    WorkerPool::GetInstance().Post<std::vector<Ip6Address>>(
+        mAddressQuerySequence, [infraIfName]() { return GetAddresses(infraIfName.c_str()); },
+        [this](std::vector<Ip6Address> aAddresses) { HandleAddresses(aAddresses); });
+
+exit:
+    return;
+}
+
+void InfraIf::HandleAddresses(const std::vector<Ip6Address> &aAddresses)
+{
+    mAddressQueryPending = false;
+
+    VerifyOrExit(mInfraIfIndex != 0, mAddressQueryDirty = false);
+
+    mDeps.SetInfraIf(mInfraIfIndex, IsRunning(aAddresses), aAddresses);
+
+    if (mAddressQueryDirty)
+    {
+        mAddressQueryDirty = false;
+        QueryAddresses();
+    }
+
 exit:
     return;
 }
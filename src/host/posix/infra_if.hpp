@@ -42,6 +42,7 @@
 
 #include "common/mainloop.hpp"
 #include "common/types.hpp"
+#include "common/worker_pool.hpp"
 
 namespace otbr {
 
@@ -69,6 +70,7 @@ public:
     };
 
     InfraIf(Dependencies &aDependencies);
+    ~InfraIf(void);
 
     void      Init(void);
     void      Deinit(void);
@@ -84,11 +86,13 @@ private:
     static int              CreateIcmp6Socket(const char *aInfraIfName);
     bool                    IsRunning(const std::vector<Ip6Address> &aAddrs) const;
     short                   GetFlags(void) const;
-    std::vector<Ip6Address> GetAddresses(void);
-    static bool             HasLinkLocalAddress(const std::vector<Ip6Address> &aAddrs);
-    void                    ReceiveIcmp6Message(void);
+    static std::vector<Ip6Address> GetAddresses(const char *aInfraIfName);
+    static bool                    HasLinkLocalAddress(const std::vector<Ip6Address> &aAddrs);
+    void                           ReceiveIcmp6Message(void);
 #ifdef __linux__
     void ReceiveNetlinkMessage(void);
+    void QueryAddresses(void);
+    void HandleAddresses(const std::vector<Ip6Address> &aAddresses);
 #endif
 
     Dependencies &mDeps;
@@ -96,6 +100,12 @@ private:
     unsigned int  mInfraIfIndex;
 #ifdef __linux__
     int mNetlinkSocket;
+
+    // `getifaddrs()` is called on the worker pool when netlink reports a change. Changes
+    // reported while a query is running are folded into one more query.
+    WorkerPool::SequenceId mAddressQuerySequence;
+    bool                   mAddressQueryPending;
+    bool                   mAddressQueryDirty;
 #endif
     int mInfraIfIcmp6Socket;
 };
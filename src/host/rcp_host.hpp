@@ -135,8 +135,9 @@ public:
         return mThreadHelper.get();
     }
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "RcpHost"; }
 
     /**
      * This method posts a task to the timer
@@ -38,12 +38,16 @@
 #if OTBR_ENABLE_MDNS
 
 #include <assert.h>
+#include <inttypes.h>
+#include <strings.h>
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 
 #include "common/code_utils.hpp"
 #include "utils/dns_utils.hpp"
+#include "utils/string_utils.hpp"
 
 namespace otbr {
 
@@ -59,132 +63,955 @@ void Publisher::PublishService(const std::string &aHostName,
 {
     otbrError error;
 
-    mServiceRegistrationBeginTime[std::make_pair(aName, aType)] = Clock::now();
+    if (mUpdateCoalescingWindow > Milliseconds::zero())
+    {
+        ServiceRegistration *serviceReg = FindServiceRegistration(aName, aType);
+
+        if (serviceReg != nullptr && !serviceReg->IsOutdated(aHostName, aName, aType, aSubTypeList, aPort, aTxtData))
+        {
+            serviceReg = nullptr;
+        }
+
+        if (ShouldDeferUpdate(mPendingServiceUpdates, NameKey(aName, aType), serviceReg))
+        {
+            Batch batch;
+
+            batch.PublishService(aHostName, aName, aType, aSubTypeList, aPort, aTxtData);
+            DeferUpdate(mPendingServiceUpdates, serviceReg, std::move(batch.mOperations.back()), std::move(aCallback));
+            ExitNow();
+        }
+    }
+
+    mPublishBeginTime = Clock::now();
 
     error = PublishServiceImpl(aHostName, aName, aType, aSubTypeList, aPort, aTxtData, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
     {
         UpdateMdnsResponseCounters(mTelemetryInfo.mServiceRegistrations, error);
     }
+
+exit:
+    return;
+}
+
+void Publisher::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+{
+    AbortPendingUpdate(mPendingServiceUpdates, NameKey(aName, aType));
+    UnpublishServiceImpl(aName, aType, std::move(aCallback));
 }
 
 void Publisher::PublishHost(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback)
 {
     otbrError error;
 
-    mHostRegistrationBeginTime[aName] = Clock::now();
+    if (mUpdateCoalescingWindow > Milliseconds::zero())
+    {
+        HostRegistration *hostReg = FindHostRegistration(aName);
+
+        if (hostReg != nullptr && !hostReg->IsOutdated(aName, aAddresses))
+        {
+            hostReg = nullptr;
+        }
+
+        if (ShouldDeferUpdate(mPendingHostUpdates, NameKey(aName), hostReg))
+        {
+            Batch batch;
+
+            batch.PublishHost(aName, aAddresses);
+            DeferUpdate(mPendingHostUpdates, hostReg, std::move(batch.mOperations.back()), std::move(aCallback));
+            ExitNow();
+        }
+    }
+
+    mPublishBeginTime = Clock::now();
 
     error = PublishHostImpl(aName, aAddresses, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
     {
         UpdateMdnsResponseCounters(mTelemetryInfo.mHostRegistrations, error);
     }
+
+exit:
+    return;
+}
+
+void Publisher::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+{
+    AbortPendingUpdate(mPendingHostUpdates, NameKey(aName));
+    UnpublishHostImpl(aName, std::move(aCallback));
 }
 
 void Publisher::PublishKey(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
 {
     otbrError error;
 
-    mKeyRegistrationBeginTime[aName] = Clock::now();
+    if (mUpdateCoalescingWindow > Milliseconds::zero())
+    {
+        KeyRegistration *keyReg = FindKeyRegistration(aName);
+
+        if (keyReg != nullptr && !keyReg->IsOutdated(aName, aKeyData))
+        {
+            keyReg = nullptr;
+        }
+
+        if (ShouldDeferUpdate(mPendingKeyUpdates, NameKey(aName), keyReg))
+        {
+            Batch batch;
+
+            batch.PublishKey(aName, aKeyData);
+            DeferUpdate(mPendingKeyUpdates, keyReg, std::move(batch.mOperations.back()), std::move(aCallback));
+            ExitNow();
+        }
+    }
+
+    mPublishBeginTime = Clock::now();
 
     error = PublishKeyImpl(aName, aKeyData, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
     {
         UpdateMdnsResponseCounters(mTelemetryInfo.mKeyRegistrations, error);
     }
+
+exit:
+    return;
+}
+
+void Publisher::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+{
+    AbortPendingUpdate(mPendingKeyUpdates, NameKey(aName));
+    UnpublishKeyImpl(aName, std::move(aCallback));
+}
+
+bool Publisher::ShouldDeferUpdate(const PendingUpdateMap &aPendingUpdates,
+                                  const NameKey          &aKey,
+                                  const Registration     *aOutdatedReg) const
+{
+    // An update is deferred if an earlier update of the same name is already deferred, so that
+    // the last one wins, or if it outdates a registration which began within the window.
+    return aPendingUpdates.find(aKey) != aPendingUpdates.end() ||
+           (aOutdatedReg != nullptr && Clock::now() - aOutdatedReg->mBeginTime < mUpdateCoalescingWindow);
+}
+
+void Publisher::DeferUpdate(PendingUpdateMap   &aPendingUpdates,
+                            const Registration *aOutdatedReg,
+                            Batch::Operation  &&aOperation,
+                            ResultCallback    &&aCallback)
+{
+    auto it = aPendingUpdates.find(MakeNameKey(aOperation));
+
+    if (it != aPendingUpdates.end())
+    {
+        PendingUpdate &update = *it->second;
+
+        otbrLogInfo("Coalescing update of %s", aOperation.mName.c_str());
+
+        // The names of the superseded operation are equal to the new ones, so the
+        // key keeps referring to valid names after the operation is replaced.
+        update.mOperation = std::move(aOperation);
+        update.mCallback  = std::bind(
+            [](std::shared_ptr<ResultCallback> aSupersededCallback, std::shared_ptr<ResultCallback> aNewCallback,
+               otbrError aError) {
+                std::move (*aSupersededCallback)(aError);
+                std::move (*aNewCallback)(aError);
+            },
+            std::make_shared<ResultCallback>(std::move(update.mCallback)),
+            std::make_shared<ResultCallback>(std::move(aCallback)), std::placeholders::_1);
+
+        mOperationStats.mCoalescedRegistrationUpdates++;
+    }
+    else
+    {
+        PendingUpdatePtr update(new PendingUpdate(std::move(aOperation), std::move(aCallback)));
+        PendingUpdate   &pendingUpdate = *update;
+        Timepoint        deferUntil;
+        Timepoint        now = Clock::now();
+
+        assert(aOutdatedReg != nullptr);
+        deferUntil = aOutdatedReg->mBeginTime + mUpdateCoalescingWindow;
+
+        otbrLogInfo("Deferring update of %s", pendingUpdate.mOperation.mName.c_str());
+
+        pendingUpdate.mTimerId = MainloopManager::GetInstance().AddTimer(
+            std::chrono::duration_cast<Microseconds>(deferUntil > now ? deferUntil - now : Clock::duration::zero()),
+            [this, &aPendingUpdates, &pendingUpdate]() { HandlePendingUpdateTimer(aPendingUpdates, pendingUpdate); });
+        aPendingUpdates.emplace(MakeNameKey(pendingUpdate.mOperation), std::move(update));
+    }
+}
+
+void Publisher::HandlePendingUpdateTimer(PendingUpdateMap &aPendingUpdates, const PendingUpdate &aUpdate)
+{
+    auto             it = aPendingUpdates.find(MakeNameKey(aUpdate.mOperation));
+    PendingUpdatePtr update;
+
+    assert(it != aPendingUpdates.end() && it->second.get() == &aUpdate);
+
+    update = std::move(it->second);
+    aPendingUpdates.erase(it);
+
+    DispatchOperation(update->mOperation, std::move(update->mCallback));
+}
+
+void Publisher::AbortPendingUpdate(PendingUpdateMap &aPendingUpdates, const NameKey &aKey)
+{
+    auto             it = aPendingUpdates.find(aKey);
+    PendingUpdatePtr update;
+
+    VerifyOrExit(it != aPendingUpdates.end());
+
+    update = std::move(it->second);
+    aPendingUpdates.erase(it);
+
+    MainloopManager::GetInstance().RemoveTimer(update->mTimerId);
+    std::move(update->mCallback)(OTBR_ERROR_ABORTED);
+
+exit:
+    return;
+}
+
+void Publisher::AbortPendingUpdates(void)
+{
+    AbortPendingUpdates(mPendingServiceUpdates);
+    AbortPendingUpdates(mPendingHostUpdates);
+    AbortPendingUpdates(mPendingKeyUpdates);
+}
+
+void Publisher::AbortPendingUpdates(PendingUpdateMap &aPendingUpdates)
+{
+    PendingUpdateMap pendingUpdates = std::move(aPendingUpdates);
+
+    aPendingUpdates.clear();
+
+    for (auto &entry : pendingUpdates)
+    {
+        MainloopManager::GetInstance().RemoveTimer(entry.second->mTimerId);
+        std::move(entry.second->mCallback)(OTBR_ERROR_ABORTED);
+    }
+}
+
+void Publisher::DispatchOperation(Batch::Operation &aOperation, ResultCallback &&aCallback)
+{
+    switch (aOperation.mAction)
+    {
+    case Batch::Action::kPublishService:
+        PublishService(aOperation.mHostName, aOperation.mName, aOperation.mType, aOperation.mSubTypeList,
+                       aOperation.mPort, aOperation.mTxtData, std::move(aCallback));
+        break;
+    case Batch::Action::kUnpublishService:
+        UnpublishService(aOperation.mName, aOperation.mType, std::move(aCallback));
+        break;
+    case Batch::Action::kPublishHost:
+        PublishHost(aOperation.mName, aOperation.mAddresses, std::move(aCallback));
+        break;
+    case Batch::Action::kUnpublishHost:
+        UnpublishHost(aOperation.mName, std::move(aCallback));
+        break;
+    case Batch::Action::kPublishKey:
+        PublishKey(aOperation.mName, aOperation.mKeyData, std::move(aCallback));
+        break;
+    case Batch::Action::kUnpublishKey:
+        UnpublishKey(aOperation.mName, std::move(aCallback));
+        break;
+    }
+}
+
+Publisher::NameKey Publisher::MakeNameKey(const Batch::Operation &aOperation)
+{
+    return aOperation.mType.empty() ? NameKey(aOperation.mName) : NameKey(aOperation.mName, aOperation.mType);
+}
+
+std::string Publisher::GetPublishGroupName(const Batch &aBatch, const Batch::Operation &aOperation)
+{
+    // Returns the name which owns the records published by @p aOperation, or an empty string if
+    // they can't be grouped. Only the records of one name are grouped, i.e. a host or a service
+    // instance with its key, so that updating a service doesn't register the host and its other
+    // services again.
+    std::string groupName;
+
+    switch (aOperation.mAction)
+    {
+    case Batch::Action::kPublishService:
+        groupName = aOperation.mName + "." + aOperation.mType;
+        break;
+    case Batch::Action::kPublishHost:
+        groupName = aOperation.mName;
+        break;
+    case Batch::Action::kPublishKey:
+        // A key belongs to the host or the service instance of the same name.
+        for (const Batch::Operation &operation : aBatch.mOperations)
+        {
+            if (operation.mAction == Batch::Action::kPublishHost && operation.mName == aOperation.mName)
+            {
+                ExitNow(groupName = operation.mName);
+            }
+            if (operation.mAction == Batch::Action::kPublishService && operation.mName == aOperation.mName)
+            {
+                ExitNow(groupName = operation.mName + "." + operation.mType);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return groupName;
+}
+
+void Publisher::Batch::PublishService(std::string aHostName,
+                                      std::string aName,
+                                      std::string aType,
+                                      SubTypeList aSubTypeList,
+                                      uint16_t    aPort,
+                                      TxtData     aTxtData)
+{
+    mOperations.emplace_back(Action::kPublishService);
+
+    Operation &operation = mOperations.back();
+
+    operation.mHostName    = std::move(aHostName);
+    operation.mName        = std::move(aName);
+    operation.mType        = std::move(aType);
+    operation.mSubTypeList = std::move(aSubTypeList);
+    operation.mPort        = aPort;
+    operation.mTxtData     = std::move(aTxtData);
+}
+
+void Publisher::Batch::UnpublishService(std::string aName, std::string aType)
+{
+    mOperations.emplace_back(Action::kUnpublishService);
+    mOperations.back().mName = std::move(aName);
+    mOperations.back().mType = std::move(aType);
+}
+
+void Publisher::Batch::PublishHost(std::string aName, AddressList aAddresses)
+{
+    mOperations.emplace_back(Action::kPublishHost);
+    mOperations.back().mName      = std::move(aName);
+    mOperations.back().mAddresses = std::move(aAddresses);
+}
+
+void Publisher::Batch::UnpublishHost(std::string aName)
+{
+    mOperations.emplace_back(Action::kUnpublishHost);
+    mOperations.back().mName = std::move(aName);
+}
+
+void Publisher::Batch::PublishKey(std::string aName, KeyData aKeyData)
+{
+    mOperations.emplace_back(Action::kPublishKey);
+    mOperations.back().mName    = std::move(aName);
+    mOperations.back().mKeyData = std::move(aKeyData);
+}
+
+void Publisher::Batch::UnpublishKey(std::string aName)
+{
+    mOperations.emplace_back(Action::kUnpublishKey);
+    mOperations.back().mName = std::move(aName);
+}
+
+void Publisher::Batch::Append(Batch &&aOther)
+{
+    if (mOperations.empty())
+    {
+        mOperations = std::move(aOther.mOperations);
+    }
+    else
+    {
+        mOperations.insert(mOperations.end(), std::make_move_iterator(aOther.mOperations.begin()),
+                           std::make_move_iterator(aOther.mOperations.end()));
+    }
+    aOther.mOperations.clear();
+}
+
+void Publisher::PublishBatch(Batch aBatch, BatchResultCallback &&aCallback)
+{
+    // The results of all operations are collected in a single shared object. One extra
+    // pending count is held while the operations are being dispatched, so that results
+    // which are delivered synchronously don't complete the batch prematurely.
+    struct BatchResult
+    {
+        BatchResult(BatchResultCallback &&aCallback, size_t aSize)
+            : mCallback(std::move(aCallback))
+            , mErrors(aSize, OTBR_ERROR_NONE)
+            , mPendingCount(aSize + 1)
+        {
+        }
+
+        void HandleResult(void)
+        {
+            otbrError error = OTBR_ERROR_NONE;
+
+            VerifyOrExit(--mPendingCount == 0);
+
+            for (otbrError operationError : mErrors)
+            {
+                if (operationError != OTBR_ERROR_NONE)
+                {
+                    error = operationError;
+                    break;
+                }
+            }
+            std::move(mCallback)(error, mErrors);
+
+        exit:
+            return;
+        }
+
+        BatchResultCallback    mCallback;
+        std::vector<otbrError> mErrors;
+        size_t                 mPendingCount;
+    };
+
+    auto        result  = std::make_shared<BatchResult>(std::move(aCallback), aBatch.GetSize());
+    bool        inGroup = false;
+    std::string groupName;
+
+    for (size_t i = 0; i < aBatch.mOperations.size(); i++)
+    {
+        Batch::Operation &operation   = aBatch.mOperations[i];
+        bool              isUnpublish = operation.IsUnpublish();
+        ResultCallback    callback    = [result, i, isUnpublish](otbrError aError) {
+            if (isUnpublish && aError == OTBR_ERROR_NOT_FOUND)
+            {
+                aError = OTBR_ERROR_NONE;
+            }
+            result->mErrors[i] = aError;
+            result->HandleResult();
+        };
+
+        // Un-publishing adds no records, so it doesn't end a group.
+        if (!isUnpublish)
+        {
+            std::string name = GetPublishGroupName(aBatch, operation);
+
+            if (inGroup && name != groupName)
+            {
+                EndPublishGroup();
+                inGroup = false;
+            }
+
+            if (!inGroup && !name.empty())
+            {
+                BeginPublishGroup();
+                inGroup   = true;
+                groupName = std::move(name);
+            }
+        }
+
+        mPublishGroupArmed = inGroup && !isUnpublish;
+        DispatchOperation(operation, std::move(callback));
+        mPublishGroupArmed = false;
+    }
+
+    if (inGroup)
+    {
+        EndPublishGroup();
+    }
+
+    result->HandleResult();
 }
 
 void Publisher::OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode)
 {
+    RecordBackendError(aErrorCode);
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, DnsErrorToOtbrError(aErrorCode));
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceName, aType, DnsErrorToOtbrError(aErrorCode));
+    UpdateServiceInstanceResolutionLatency(aInstanceName, aType, DnsErrorToOtbrError(aErrorCode));
     OnServiceResolveFailedImpl(aType, aInstanceName, aErrorCode);
 }
 
 void Publisher::OnHostResolveFailed(std::string aHostName, int32_t aErrorCode)
 {
+    RecordBackendError(aErrorCode);
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, DnsErrorToOtbrError(aErrorCode));
-    UpdateHostResolutionEmaLatency(aHostName, DnsErrorToOtbrError(aErrorCode));
+    UpdateHostResolutionLatency(aHostName, DnsErrorToOtbrError(aErrorCode));
     OnHostResolveFailedImpl(aHostName, aErrorCode);
 }
 
-otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t> &aTxtData)
+bool Publisher::TxtEntryView::KeyEquals(const char *aKey) const
 {
-    otbrError error = OTBR_ERROR_NONE;
+    return strlen(aKey) == mKeyLength && strncasecmp(mKey, aKey, mKeyLength) == 0;
+}
 
-    aTxtData.clear();
+otbrError Publisher::TxtDataIterator::GetNextEntry(TxtEntryView &aEntry)
+{
+    otbrError error = OTBR_ERROR_NOT_FOUND;
 
-    for (const TxtEntry &txtEntry : aTxtList)
+    while (mOffset < mTxtLength)
     {
-        size_t entryLength = txtEntry.mKey.length();
+        uint16_t entrySize = mTxtData[mOffset];
+        uint16_t keyStart  = mOffset + 1;
+        uint16_t entryEnd  = keyStart + entrySize;
+        uint16_t keyEnd    = keyStart;
+
+        VerifyOrExit(entryEnd <= mTxtLength, error = OTBR_ERROR_PARSE);
+        mOffset = entryEnd;
 
-        if (!txtEntry.mIsBooleanAttribute)
+        while (keyEnd < entryEnd && mTxtData[keyEnd] != '=')
         {
-            entryLength += txtEntry.mValue.size() + sizeof(uint8_t); // for `=` char.
+            keyEnd++;
         }
 
-        VerifyOrExit(entryLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
+        if (keyEnd == keyStart && keyEnd == entryEnd)
+        {
+            // Skip empty strings.
+            continue;
+        }
 
-        aTxtData.push_back(static_cast<uint8_t>(entryLength));
-        aTxtData.insert(aTxtData.end(), txtEntry.mKey.begin(), txtEntry.mKey.end());
+        aEntry.mKey                = reinterpret_cast<const char *>(&mTxtData[keyStart]);
+        aEntry.mKeyLength          = static_cast<uint8_t>(keyEnd - keyStart);
+        aEntry.mIsBooleanAttribute = (keyEnd == entryEnd);
 
-        if (!txtEntry.mIsBooleanAttribute)
+        if (aEntry.mIsBooleanAttribute)
+        {
+            aEntry.mValue       = nullptr;
+            aEntry.mValueLength = 0;
+        }
+        else
         {
-            aTxtData.push_back('=');
-            aTxtData.insert(aTxtData.end(), txtEntry.mValue.begin(), txtEntry.mValue.end());
+            aEntry.mValue       = &mTxtData[keyEnd + 1]; // To skip over `=`
+            aEntry.mValueLength = static_cast<uint8_t>(entryEnd - keyEnd - 1);
         }
+
+        ExitNow(error = OTBR_ERROR_NONE);
+    }
+
+exit:
+    return error;
+}
+
+otbrError Publisher::TxtDataEncoder::AppendEntry(const char *aKey, const uint8_t *aValue, size_t aValueLength)
+{
+    return Append(aKey, strlen(aKey), aValue, aValueLength, /* aIsBooleanAttribute */ false);
+}
+
+otbrError Publisher::TxtDataEncoder::AppendBooleanAttribute(const char *aKey)
+{
+    return Append(aKey, strlen(aKey), nullptr, 0, /* aIsBooleanAttribute */ true);
+}
+
+otbrError Publisher::TxtDataEncoder::Append(const char    *aKey,
+                                            size_t         aKeyLength,
+                                            const uint8_t *aValue,
+                                            size_t         aValueLength,
+                                            bool           aIsBooleanAttribute)
+{
+    otbrError error       = OTBR_ERROR_NONE;
+    size_t    entryLength = aKeyLength;
+
+    if (!aIsBooleanAttribute)
+    {
+        entryLength += aValueLength + sizeof(uint8_t); // for `=` char.
+    }
+
+    VerifyOrExit(entryLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
+
+    mTxtData.push_back(static_cast<uint8_t>(entryLength));
+    mTxtData.insert(mTxtData.end(), aKey, aKey + aKeyLength);
+
+    if (!aIsBooleanAttribute)
+    {
+        mTxtData.push_back('=');
+        mTxtData.insert(mTxtData.end(), aValue, aValue + aValueLength);
+    }
+
+exit:
+    return error;
+}
+
+void Publisher::TxtDataEncoder::Finish(void)
+{
+    if (mTxtData.empty())
+    {
+        mTxtData.push_back(0);
+    }
+}
+
+otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t> &aTxtData)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    TxtDataEncoder encoder(aTxtData);
+    size_t         length = 0;
+
+    for (const TxtEntry &txtEntry : aTxtList)
+    {
+        length += sizeof(uint8_t) + txtEntry.mKey.length() + txtEntry.mValue.size() + sizeof(uint8_t);
     }
 
-    if (aTxtData.empty())
+    aTxtData.reserve(length);
+
+    for (const TxtEntry &txtEntry : aTxtList)
     {
-        aTxtData.push_back(0);
+        SuccessOrExit(error = encoder.Append(txtEntry.mKey.data(), txtEntry.mKey.length(), txtEntry.mValue.data(),
+                                             txtEntry.mValue.size(), txtEntry.mIsBooleanAttribute));
     }
 
+    encoder.Finish();
+
 exit:
     return error;
 }
 
 otbrError Publisher::DecodeTxtData(Publisher::TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError       error;
+    TxtDataIterator iterator(aTxtData, aTxtLength);
+    TxtEntryView    entry;
 
     aTxtList.clear();
 
-    for (uint16_t r = 0; r < aTxtLength;)
+    while ((error = iterator.GetNextEntry(entry)) == OTBR_ERROR_NONE)
     {
-        uint16_t entrySize = aTxtData[r];
-        uint16_t keyStart  = r + 1;
-        uint16_t entryEnd  = keyStart + entrySize;
-        uint16_t keyEnd    = keyStart;
+        if (entry.mIsBooleanAttribute)
+        {
+            aTxtList.emplace_back(entry.mKey, entry.mKeyLength);
+        }
+        else
+        {
+            aTxtList.emplace_back(entry.mKey, entry.mKeyLength, entry.mValue, entry.mValueLength);
+        }
+    }
 
-        VerifyOrExit(entryEnd <= aTxtLength, error = OTBR_ERROR_PARSE);
+    if (error == OTBR_ERROR_NOT_FOUND)
+    {
+        error = OTBR_ERROR_NONE;
+    }
 
-        while (keyEnd < entryEnd && aTxtData[keyEnd] != '=')
+    return error;
+}
+
+Publisher::~Publisher(void)
+{
+    if (mReplayTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mReplayTimerId);
+    }
+
+    AbortPendingUpdates();
+}
+
+void Publisher::SubscribeService(const std::string &aType, const std::string &aInstanceName, uint64_t aSubscriberId)
+{
+    Subscription &subscription = mServiceSubscriptions[std::make_pair(aType, aInstanceName)];
+
+    PurgeExpiredCache();
+    subscription.mCount++;
+
+    if (!subscription.mIsActive)
+    {
+        subscription.mIsActive = (SubscribeServiceImpl(aType, aInstanceName) == OTBR_ERROR_NONE);
+    }
+    else if (aSubscriberId != 0 && HasCachedServiceInstances(aType, aInstanceName))
+    {
+        ScheduleReplay(aSubscriberId, aType, aInstanceName, "");
+    }
+    else
+    {
+        // The mDNS implementation has reported its answers to the earlier subscribers only.
+        RequeryService(aType, aInstanceName);
+    }
+}
+
+void Publisher::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    auto it = mServiceSubscriptions.find(std::make_pair(aType, aInstanceName));
+
+    VerifyOrExit(it != mServiceSubscriptions.end(),
+                 otbrLogWarning("The service %s.%s is not subscribed", aInstanceName.c_str(), aType.c_str()));
+
+    if (--it->second.mCount == 0)
+    {
+        bool isActive = it->second.mIsActive;
+
+        mServiceSubscriptions.erase(it);
+
+        if (isActive)
         {
-            keyEnd++;
+            UnsubscribeServiceImpl(aType, aInstanceName);
         }
+    }
+
+exit:
+    return;
+}
+
+void Publisher::RequeryService(const std::string &aType, const std::string &aInstanceName)
+{
+    auto it = mServiceSubscriptions.find(std::make_pair(aType, aInstanceName));
+
+    VerifyOrExit(it != mServiceSubscriptions.end(),
+                 otbrLogWarning("The service %s.%s is not subscribed", aInstanceName.c_str(), aType.c_str()));
+
+    otbrLogInfo("Requery service %s.%s", aInstanceName.c_str(), aType.c_str());
+
+    if (it->second.mIsActive)
+    {
+        UnsubscribeServiceImpl(aType, aInstanceName);
+    }
+    it->second.mIsActive = (SubscribeServiceImpl(aType, aInstanceName) == OTBR_ERROR_NONE);
+
+exit:
+    return;
+}
+
+void Publisher::SubscribeHost(const std::string &aHostName, uint64_t aSubscriberId)
+{
+    Subscription &subscription = mHostSubscriptions[aHostName];
+
+    PurgeExpiredCache();
+    subscription.mCount++;
+
+    if (!subscription.mIsActive)
+    {
+        subscription.mIsActive = (SubscribeHostImpl(aHostName) == OTBR_ERROR_NONE);
+    }
+    else if (aSubscriberId != 0 && HasCachedHost(aHostName))
+    {
+        ScheduleReplay(aSubscriberId, "", "", aHostName);
+    }
+    else
+    {
+        // The mDNS implementation has reported its answer to the earlier subscribers only.
+        RequeryHost(aHostName);
+    }
+}
+
+void Publisher::UnsubscribeHost(const std::string &aHostName)
+{
+    auto it = mHostSubscriptions.find(aHostName);
 
-        if (keyEnd == entryEnd)
+    VerifyOrExit(it != mHostSubscriptions.end(), otbrLogWarning("The host %s is not subscribed", aHostName.c_str()));
+
+    if (--it->second.mCount == 0)
+    {
+        bool isActive = it->second.mIsActive;
+
+        mHostSubscriptions.erase(it);
+
+        if (isActive)
         {
-            if (keyEnd > keyStart)
-            {
-                // No `=`, treat as a boolean attribute.
-                aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart);
-            }
+            UnsubscribeHostImpl(aHostName);
+        }
+    }
+
+exit:
+    return;
+}
+
+void Publisher::RequeryHost(const std::string &aHostName)
+{
+    auto it = mHostSubscriptions.find(aHostName);
+
+    VerifyOrExit(it != mHostSubscriptions.end(), otbrLogWarning("The host %s is not subscribed", aHostName.c_str()));
+
+    otbrLogInfo("Requery host %s", aHostName.c_str());
+
+    if (it->second.mIsActive)
+    {
+        UnsubscribeHostImpl(aHostName);
+    }
+    it->second.mIsActive = (SubscribeHostImpl(aHostName) == OTBR_ERROR_NONE);
+
+exit:
+    return;
+}
+
+bool Publisher::IsServiceSubscribed(const std::string &aType, const std::string &aInstanceName) const
+{
+    return mServiceSubscriptions.find(std::make_pair(aType, aInstanceName)) != mServiceSubscriptions.end();
+}
+
+bool Publisher::IsHostSubscribed(const std::string &aHostName) const
+{
+    return mHostSubscriptions.find(aHostName) != mHostSubscriptions.end();
+}
+
+void Publisher::ClearSubscriptions(void)
+{
+    mServiceSubscriptions.clear();
+    mHostSubscriptions.clear();
+    mInstanceCache.clear();
+    mHostCache.clear();
+    mPendingReplays.clear();
+}
+
+void Publisher::UpdateInstanceCache(const std::string &aType, const DiscoveredInstanceInfoPtr &aInstanceInfo)
+{
+    auto key = std::make_pair(StringUtils::ToLowercase(aType), StringUtils::ToLowercase(aInstanceInfo->mName));
+
+    if (aInstanceInfo->mRemoved || aInstanceInfo->mTtl == 0)
+    {
+        mInstanceCache.erase(key);
+    }
+    else
+    {
+        CacheEntry<DiscoveredInstanceInfo> &entry = mInstanceCache[key];
+
+        entry.mInfo       = aInstanceInfo;
+        entry.mExpireTime = Clock::now() + Seconds(aInstanceInfo->mTtl);
+    }
+}
+
+void Publisher::UpdateHostCache(const std::string &aHostName, const DiscoveredHostInfoPtr &aHostInfo)
+{
+    std::string key = StringUtils::ToLowercase(aHostName);
+
+    if (aHostInfo->mAddresses.empty() || aHostInfo->mTtl == 0)
+    {
+        mHostCache.erase(key);
+    }
+    else
+    {
+        CacheEntry<DiscoveredHostInfo> &entry = mHostCache[key];
+
+        entry.mInfo       = aHostInfo;
+        entry.mExpireTime = Clock::now() + Seconds(aHostInfo->mTtl);
+    }
+}
+
+void Publisher::PurgeExpiredCache(void)
+{
+    Timepoint now = Clock::now();
+
+    for (auto it = mInstanceCache.begin(); it != mInstanceCache.end();)
+    {
+        it = (it->second.mExpireTime <= now) ? mInstanceCache.erase(it) : std::next(it);
+    }
+
+    for (auto it = mHostCache.begin(); it != mHostCache.end();)
+    {
+        it = (it->second.mExpireTime <= now) ? mHostCache.erase(it) : std::next(it);
+    }
+}
+
+uint32_t Publisher::GetRemainingTtl(Timepoint aExpireTime, Timepoint aNow)
+{
+    return static_cast<uint32_t>(std::chrono::duration_cast<Seconds>(aExpireTime - aNow).count());
+}
+
+bool Publisher::HasCachedServiceInstances(const std::string &aType, const std::string &aInstanceName) const
+{
+    std::string type      = StringUtils::ToLowercase(aType);
+    Timepoint   now       = Clock::now();
+    bool        hasCached = false;
+
+    for (auto it = mInstanceCache.lower_bound(std::make_pair(type, StringUtils::ToLowercase(aInstanceName)));
+         it != mInstanceCache.end() && it->first.first == type; ++it)
+    {
+        if (!aInstanceName.empty() && !StringUtils::EqualCaseInsensitive(it->first.second, aInstanceName))
+        {
+            break;
+        }
+
+        if (it->second.mExpireTime > now)
+        {
+            hasCached = true;
+            break;
+        }
+    }
+
+    return hasCached;
+}
+
+bool Publisher::HasCachedHost(const std::string &aHostName) const
+{
+    auto it = mHostCache.find(StringUtils::ToLowercase(aHostName));
+
+    return it != mHostCache.end() && it->second.mExpireTime > Clock::now();
+}
+
+void Publisher::ScheduleReplay(uint64_t           aSubscriberId,
+                               const std::string &aType,
+                               const std::string &aInstanceName,
+                               const std::string &aHostName)
+{
+    mPendingReplays.push_back({aSubscriberId, aType, aInstanceName, aHostName});
+
+    if (mReplayTimerId == 0)
+    {
+        mReplayTimerId = MainloopManager::GetInstance().AddTimer(Microseconds::zero(), [this]() {
+            mReplayTimerId = 0;
+            HandleReplayTimer();
+        });
+    }
+}
+
+void Publisher::HandleReplayTimer(void)
+{
+    std::vector<PendingReplay> replays = std::move(mPendingReplays);
+
+    mPendingReplays.clear();
+
+    for (const PendingReplay &replay : replays)
+    {
+        if (replay.mHostName.empty())
+        {
+            ReplayServiceInstances(replay.mSubscriberId, replay.mType, replay.mInstanceName);
         }
         else
         {
-            uint16_t valStart = keyEnd + 1; // To skip over `=`
+            ReplayHost(replay.mSubscriberId, replay.mHostName);
+        }
+    }
+}
+
+void Publisher::ReplayServiceInstances(uint64_t           aSubscriberId,
+                                       const std::string &aType,
+                                       const std::string &aInstanceName)
+{
+    std::string                                     type = StringUtils::ToLowercase(aType);
+    Timepoint                                       now  = Clock::now();
+    std::vector<CacheEntry<DiscoveredInstanceInfo>> instances;
+
+    // Subscriptions which have been cancelled meanwhile are not replayed.
+    VerifyOrExit(mServiceSubscriptions.count(std::make_pair(aType, aInstanceName)) > 0);
+
+    // Collect the results before notifying, because the callbacks may change the cache.
+    for (auto it = mInstanceCache.lower_bound(std::make_pair(type, StringUtils::ToLowercase(aInstanceName)));
+         it != mInstanceCache.end() && it->first.first == type; ++it)
+    {
+        if (!aInstanceName.empty() && !StringUtils::EqualCaseInsensitive(it->first.second, aInstanceName))
+        {
+            break;
+        }
 
-            aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart,
-                                  &aTxtData[valStart], entryEnd - valStart);
+        if (it->second.mExpireTime > now)
+        {
+            instances.push_back(it->second);
         }
+    }
+
+    for (const CacheEntry<DiscoveredInstanceInfo> &entry : instances)
+    {
+        // Reports the remaining TTL so that subscribers don't extend the lifetime of the cached result.
+        std::shared_ptr<DiscoveredInstanceInfo> instanceInfo = std::make_shared<DiscoveredInstanceInfo>(*entry.mInfo);
 
-        r += entrySize + 1;
+        instanceInfo->mTtl = GetRemainingTtl(entry.mExpireTime, now);
+        otbrLogInfo("Replay cached service instance %s.%s to subscriber %" PRIu64, instanceInfo->mName.c_str(),
+                    aType.c_str(), aSubscriberId);
+        NotifyServiceInstance(aType, instanceInfo, aSubscriberId);
     }
 
 exit:
-    return error;
+    return;
+}
+
+void Publisher::ReplayHost(uint64_t aSubscriberId, const std::string &aHostName)
+{
+    auto                                it  = mHostCache.find(StringUtils::ToLowercase(aHostName));
+    Timepoint                           now = Clock::now();
+    std::shared_ptr<DiscoveredHostInfo> hostInfo;
+
+    VerifyOrExit(mHostSubscriptions.count(aHostName) > 0);
+    VerifyOrExit(it != mHostCache.end() && it->second.mExpireTime > now);
+
+    // Reports the remaining TTL in a copy of the snapshot, which also keeps it valid if the callbacks change the cache.
+    hostInfo       = std::make_shared<DiscoveredHostInfo>(*it->second.mInfo);
+    hostInfo->mTtl = GetRemainingTtl(it->second.mExpireTime, now);
+    otbrLogInfo("Replay cached host %s to subscriber %" PRIu64, aHostName.c_str(), aSubscriberId);
+    NotifyHost(aHostName, hostInfo, aSubscriberId);
+
+exit:
+    return;
 }
 
 void Publisher::RemoveSubscriptionCallbacks(uint64_t aSubscriberId)
@@ -194,19 +1021,20 @@ void Publisher::RemoveSubscriptionCallbacks(uint64_t aSubscriberId)
 }
 
 uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanceCallback aInstanceCallback,
-                                             Publisher::DiscoveredHostCallback            aHostCallback)
+                                             Publisher::DiscoveredHostCallback            aHostCallback,
+                                             const std::string                           &aServiceType)
 {
     uint64_t id = mNextSubscriberId++;
 
     assert(id > 0);
-    mDiscoverCallbacks.emplace_back(id, aInstanceCallback, aHostCallback);
+    mDiscoverCallbacks.emplace_back(id, std::move(aInstanceCallback), std::move(aHostCallback), aServiceType);
 
     return id;
 }
 
 void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
 {
-    bool checkToInvoke = false;
+    DiscoveredInstanceInfoPtr instanceInfo;
 
     otbrLogInfo("Service %s is resolved successfully: %s %s host %s addresses %zu", aType.c_str(),
                 aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
@@ -237,7 +1065,19 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, OTBR_ERROR_NONE);
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
+    UpdateServiceInstanceResolutionLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
+
+    // The result is moved into a single snapshot shared by the cache and all the subscribers.
+    instanceInfo = std::make_shared<const DiscoveredInstanceInfo>(std::move(aInstanceInfo));
+    UpdateInstanceCache(aType, instanceInfo);
+    NotifyServiceInstance(aType, instanceInfo);
+}
+
+void Publisher::NotifyServiceInstance(const std::string               &aType,
+                                      const DiscoveredInstanceInfoPtr &aInstanceInfo,
+                                      uint64_t                         aSubscriberId)
+{
+    bool checkToInvoke = false;
 
     // The `mDiscoverCallbacks` list can get updated as the callbacks
     // are invoked. We first mark `mShouldInvoke` on all non-null
@@ -247,7 +1087,8 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
 
     for (DiscoverCallback &callback : mDiscoverCallbacks)
     {
-        if (callback.mServiceCallback != nullptr)
+        if (callback.mServiceCallback != nullptr && (aSubscriberId == 0 || callback.mId == aSubscriberId) &&
+            (callback.mServiceType.empty() || StringUtils::EqualCaseInsensitive(callback.mServiceType, aType)))
         {
             callback.mShouldInvoke = true;
             checkToInvoke          = true;
@@ -286,7 +1127,7 @@ void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::s
 
 void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfo aHostInfo)
 {
-    bool checkToInvoke = false;
+    DiscoveredHostInfoPtr hostInfo;
 
     otbrLogInfo("Host %s is resolved successfully: host %s addresses %zu ttl %u", aHostName.c_str(),
                 aHostInfo.mHostName.c_str(), aHostInfo.mAddresses.size(), aHostInfo.mTtl);
@@ -297,7 +1138,16 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, OTBR_ERROR_NONE);
-    UpdateHostResolutionEmaLatency(aHostName, OTBR_ERROR_NONE);
+    UpdateHostResolutionLatency(aHostName, OTBR_ERROR_NONE);
+
+    hostInfo = std::make_shared<const DiscoveredHostInfo>(std::move(aHostInfo));
+    UpdateHostCache(aHostName, hostInfo);
+    NotifyHost(aHostName, hostInfo);
+}
+
+void Publisher::NotifyHost(const std::string &aHostName, const DiscoveredHostInfoPtr &aHostInfo, uint64_t aSubscriberId)
+{
+    bool checkToInvoke = false;
 
     // The `mDiscoverCallbacks` list can get updated as the callbacks
     // are invoked. We first mark `mShouldInvoke` on all non-null
@@ -307,7 +1157,7 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
 
     for (DiscoverCallback &callback : mDiscoverCallbacks)
     {
-        if (callback.mHostCallback != nullptr)
+        if (callback.mHostCallback != nullptr && (aSubscriberId == 0 || callback.mId == aSubscriberId))
         {
             callback.mShouldInvoke = true;
             checkToInvoke          = true;
@@ -353,14 +1203,79 @@ std::string Publisher::MakeFullName(const std::string &aName)
     return aName + ".local";
 }
 
+bool Publisher::NameKey::operator==(const NameKey &aOther) const
+{
+    bool   isEqual = false;
+    size_t length  = GetLength();
+
+    VerifyOrExit(length == aOther.GetLength());
+
+    for (size_t i = 0; i < length; i++)
+    {
+        VerifyOrExit(GetCharAt(i) == aOther.GetCharAt(i));
+    }
+    isEqual = true;
+
+exit:
+    return isEqual;
+}
+
+char Publisher::NameKey::GetCharAt(size_t aIndex) const
+{
+    char c;
+
+    if (aIndex < mName->size())
+    {
+        c = (*mName)[aIndex];
+    }
+    else if (aIndex == mName->size())
+    {
+        c = '.';
+    }
+    else
+    {
+        c = (*mType)[aIndex - mName->size() - 1];
+    }
+
+    return c;
+}
+
+size_t Publisher::NameKey::Hash::operator()(const NameKey &aKey) const
+{
+    // FNV-1a over the full name, so that the two forms of the same name have the same hash.
+    static constexpr uint64_t kOffsetBasis = 14695981039346656037ULL;
+    static constexpr uint64_t kPrime       = 1099511628211ULL;
+
+    uint64_t hash = kOffsetBasis;
+
+    for (char c : *aKey.mName)
+    {
+        hash = (hash ^ static_cast<uint8_t>(c)) * kPrime;
+    }
+
+    if (aKey.mType != nullptr)
+    {
+        hash = (hash ^ static_cast<uint8_t>('.')) * kPrime;
+
+        for (char c : *aKey.mType)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * kPrime;
+        }
+    }
+
+    return static_cast<size_t>(hash);
+}
+
 void Publisher::AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg)
 {
-    mServiceRegistrations.emplace(MakeFullServiceName(aServiceReg->mName, aServiceReg->mType), std::move(aServiceReg));
+    NameKey key(aServiceReg->mName, aServiceReg->mType);
+
+    mServiceRegistrations.emplace(key, std::move(aServiceReg));
 }
 
 void Publisher::RemoveServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError)
 {
-    auto                   it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    auto                   it = mServiceRegistrations.find(NameKey(aName, aType));
     ServiceRegistrationPtr serviceReg;
 
     otbrLogInfo("Removing service %s.%s", aName.c_str(), aType.c_str());
@@ -377,16 +1292,26 @@ exit:
     return;
 }
 
+bool Publisher::IsServiceRegistered(const std::string &aName, const std::string &aType) const
+{
+    return mServiceRegistrations.find(NameKey(aName, aType)) != mServiceRegistrations.end();
+}
+
+bool Publisher::IsHostRegistered(const std::string &aName) const
+{
+    return mHostRegistrations.find(NameKey(aName)) != mHostRegistrations.end();
+}
+
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    auto it = mServiceRegistrations.find(NameKey(aName, aType));
 
     return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
 }
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aNameAndType)
 {
-    auto it = mServiceRegistrations.find(MakeFullName(aNameAndType));
+    auto it = mServiceRegistrations.find(NameKey(aNameAndType));
 
     return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -471,12 +1396,14 @@ exit:
 
 void Publisher::AddHostRegistration(HostRegistrationPtr &&aHostReg)
 {
-    mHostRegistrations.emplace(MakeFullHostName(aHostReg->mName), std::move(aHostReg));
+    NameKey key(aHostReg->mName);
+
+    mHostRegistrations.emplace(key, std::move(aHostReg));
 }
 
 void Publisher::RemoveHostRegistration(const std::string &aName, otbrError aError)
 {
-    auto                it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto                it = mHostRegistrations.find(NameKey(aName));
     HostRegistrationPtr hostReg;
 
     otbrLogInfo("Removing host %s", aName.c_str());
@@ -496,7 +1423,7 @@ exit:
 
 Publisher::HostRegistration *Publisher::FindHostRegistration(const std::string &aName)
 {
-    auto it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto it = mHostRegistrations.find(NameKey(aName));
 
     return it != mHostRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -540,12 +1467,14 @@ exit:
 
 void Publisher::AddKeyRegistration(KeyRegistrationPtr &&aKeyReg)
 {
-    mKeyRegistrations.emplace(MakeFullKeyName(aKeyReg->mName), std::move(aKeyReg));
+    NameKey key(aKeyReg->mName);
+
+    mKeyRegistrations.emplace(key, std::move(aKeyReg));
 }
 
 void Publisher::RemoveKeyRegistration(const std::string &aName, otbrError aError)
 {
-    auto               it = mKeyRegistrations.find(MakeFullKeyName(aName));
+    auto               it = mKeyRegistrations.find(NameKey(aName));
     KeyRegistrationPtr keyReg;
 
     otbrLogInfo("Removing key %s", aName.c_str());
@@ -565,14 +1494,14 @@ exit:
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName)
 {
-    auto it = mKeyRegistrations.find(MakeFullKeyName(aName));
+    auto it = mKeyRegistrations.find(NameKey(aName));
 
     return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
 }
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mKeyRegistrations.find(MakeFullServiceName(aName, aType));
+    auto it = mKeyRegistrations.find(NameKey(aName, aType));
 
     return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -604,7 +1533,8 @@ void Publisher::ServiceRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mServiceRegistrations, aError);
-        mPublisher->UpdateServiceRegistrationEmaLatency(mName, mType, aError);
+        UpdateLatency(mPublisher->mTelemetryInfo.mServiceRegistrationEmaLatency,
+                      mPublisher->mOperationStats.mServiceRegistrationLatency, mBeginTime, aError);
     }
 }
 
@@ -624,7 +1554,8 @@ void Publisher::HostRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mHostRegistrations, aError);
-        mPublisher->UpdateHostRegistrationEmaLatency(mName, aError);
+        UpdateLatency(mPublisher->mTelemetryInfo.mHostRegistrationEmaLatency,
+                      mPublisher->mOperationStats.mHostRegistrationLatency, mBeginTime, aError);
     }
 }
 
@@ -644,7 +1575,8 @@ void Publisher::KeyRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mKeyRegistrations, aError);
-        mPublisher->UpdateKeyRegistrationEmaLatency(mName, aError);
+        UpdateLatency(mPublisher->mTelemetryInfo.mKeyRegistrationEmaLatency,
+                      mPublisher->mOperationStats.mKeyRegistrationLatency, mBeginTime, aError);
     }
 }
 
@@ -700,70 +1632,67 @@ exit:
     return;
 }
 
-void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
-                                                    const std::string &aType,
-                                                    otbrError          aError)
-{
-    auto it = mServiceRegistrationBeginTime.find(std::make_pair(aInstanceName, aType));
-
-    if (it != mServiceRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceRegistrationEmaLatency, latency, aError);
-        mServiceRegistrationBeginTime.erase(it);
-    }
-}
-
-void Publisher::UpdateHostRegistrationEmaLatency(const std::string &aHostName, otbrError aError)
+void Publisher::UpdateLatency(uint32_t         &aEmaLatency,
+                              LatencyHistogram &aHistogram,
+                              Timepoint         aBeginTime,
+                              otbrError         aError)
 {
-    auto it = mHostRegistrationBeginTime.find(aHostName);
+    Microseconds latency = std::chrono::duration_cast<Microseconds>(Clock::now() - aBeginTime);
 
-    if (it != mHostRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostRegistrationEmaLatency, latency, aError);
-        mHostRegistrationBeginTime.erase(it);
-    }
-}
+    // Aborted operations are excluded, since their latencies depend on when they were aborted.
+    VerifyOrExit(aError != OTBR_ERROR_ABORTED);
 
-void Publisher::UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otbrError aError)
-{
-    auto it = mKeyRegistrationBeginTime.find(aKeyName);
+    UpdateEmaLatency(aEmaLatency, static_cast<uint32_t>(std::chrono::duration_cast<Milliseconds>(latency).count()),
+                     aError);
+    aHistogram.Record(static_cast<uint64_t>(std::max(latency, Microseconds::zero()).count()));
 
-    if (it != mKeyRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mKeyRegistrationEmaLatency, latency, aError);
-        mKeyRegistrationBeginTime.erase(it);
-    }
+exit:
+    return;
 }
 
-void Publisher::UpdateServiceInstanceResolutionEmaLatency(const std::string &aInstanceName,
-                                                          const std::string &aType,
-                                                          otbrError          aError)
+void Publisher::UpdateServiceInstanceResolutionLatency(const std::string &aInstanceName,
+                                                       const std::string &aType,
+                                                       otbrError          aError)
 {
     auto it = mServiceInstanceResolutionBeginTime.find(std::make_pair(aInstanceName, aType));
 
     if (it != mServiceInstanceResolutionBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceResolutionEmaLatency, latency, aError);
+        UpdateLatency(mTelemetryInfo.mServiceResolutionEmaLatency, mOperationStats.mServiceResolutionLatency,
+                      it->second, aError);
         mServiceInstanceResolutionBeginTime.erase(it);
     }
 }
 
-void Publisher::UpdateHostResolutionEmaLatency(const std::string &aHostName, otbrError aError)
+void Publisher::UpdateHostResolutionLatency(const std::string &aHostName, otbrError aError)
 {
     auto it = mHostResolutionBeginTime.find(aHostName);
 
     if (it != mHostResolutionBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostResolutionEmaLatency, latency, aError);
+        UpdateLatency(mTelemetryInfo.mHostResolutionEmaLatency, mOperationStats.mHostResolutionLatency, it->second,
+                      aError);
         mHostResolutionBeginTime.erase(it);
     }
 }
 
+void Publisher::RecordBackendError(int32_t aErrorCode)
+{
+    for (MdnsBackendErrorCounter &counter : mOperationStats.mBackendErrors)
+    {
+        if (counter.mErrorCode == aErrorCode)
+        {
+            ++counter.mCount;
+            ExitNow();
+        }
+    }
+
+    mOperationStats.mBackendErrors.push_back({aErrorCode, 1});
+
+exit:
+    return;
+}
+
 void Publisher::AddAddress(AddressList &aAddressList, const Ip6Address &aAddress)
 {
     aAddressList.push_back(aAddress);
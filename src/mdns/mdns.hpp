@@ -37,7 +37,7 @@
 #include "openthread-br/config.h"
 
 #ifndef OTBR_ENABLE_MDNS
-#define OTBR_ENABLE_MDNS (OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD)
+#define OTBR_ENABLE_MDNS (OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_NATIVE)
 #endif
 
 #include <functional>
@@ -45,12 +45,14 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sys/select.h>
 
 #include "common/callback.hpp"
 #include "common/code_utils.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/time.hpp"
 #include "common/types.hpp"
 
@@ -123,6 +125,146 @@ public:
     typedef std::vector<Ip6Address>  AddressList;
     typedef std::vector<uint8_t>     KeyData;
 
+    /**
+     * This structure represents a non-owning view of a key/value pair inside TXT data.
+     *
+     * The key and the value point into the TXT data, which must outlive the view.
+     */
+    struct TxtEntryView
+    {
+        const char    *mKey;                ///< The key of the TXT entry, not null-terminated.
+        uint8_t        mKeyLength;          ///< The key length.
+        const uint8_t *mValue;              ///< The value of the TXT entry. Can be empty.
+        uint8_t        mValueLength;        ///< The value length.
+        bool           mIsBooleanAttribute; ///< This entry is boolean attribute (encoded as `key` without `=`).
+
+        /**
+         * This method indicates whether the key of this entry matches a given key.
+         *
+         * Keys are compared case-insensitively as required by RFC 6763 section 6.4.
+         *
+         * @param[in] aKey  A null-terminated key.
+         *
+         * @retval TRUE   The keys match.
+         * @retval FALSE  The keys do not match.
+         */
+        bool KeyEquals(const char *aKey) const;
+    };
+
+    /**
+     * This class iterates over the TXT entries in TXT data without copying them.
+     */
+    class TxtDataIterator
+    {
+    public:
+        /**
+         * This constructor initializes the iterator to the first TXT entry.
+         *
+         * @param[in] aTxtData    A pointer to TXT data, which must outlive the iterator.
+         * @param[in] aTxtLength  The TXT data length.
+         */
+        TxtDataIterator(const uint8_t *aTxtData, uint16_t aTxtLength)
+            : mTxtData(aTxtData)
+            , mTxtLength(aTxtLength)
+            , mOffset(0)
+        {
+        }
+
+        /**
+         * This method reads the next TXT entry.
+         *
+         * Empty strings, which are used to encode empty TXT data, are skipped.
+         *
+         * @param[out] aEntry  A reference to the entry view to output the entry.
+         *
+         * @retval OTBR_ERROR_NONE       Successfully read the next entry.
+         * @retval OTBR_ERROR_NOT_FOUND  There are no more entries.
+         * @retval OTBR_ERROR_PARSE      The TXT data is malformed.
+         */
+        otbrError GetNextEntry(TxtEntryView &aEntry);
+
+    private:
+        const uint8_t *mTxtData;
+        uint16_t       mTxtLength;
+        uint16_t       mOffset;
+    };
+
+    /**
+     * This class writes TXT entries directly into a TXT data buffer.
+     *
+     * The output data is in standard DNS-SD TXT data format and the entries are written in the order
+     * they are appended.
+     */
+    class TxtDataEncoder
+    {
+    public:
+        /**
+         * This constructor initializes the encoder.
+         *
+         * @param[in] aTxtData  A reference to the TXT data buffer to write to. Will be cleared, but its
+         *                      capacity is kept so that the buffer can be reused.
+         */
+        explicit TxtDataEncoder(TxtData &aTxtData)
+            : mTxtData(aTxtData)
+        {
+            mTxtData.clear();
+        }
+
+        /**
+         * This method appends a key/value TXT entry.
+         *
+         * @param[in] aKey          A null-terminated key.
+         * @param[in] aValue        A pointer to the value.
+         * @param[in] aValueLength  The value length.
+         *
+         * @retval OTBR_ERROR_NONE          Successfully appended the entry.
+         * @retval OTBR_ERROR_INVALID_ARGS  The entry is too long.
+         */
+        otbrError AppendEntry(const char *aKey, const uint8_t *aValue, size_t aValueLength);
+
+        /**
+         * This method appends a key/value TXT entry with a null-terminated string value.
+         *
+         * @param[in] aKey    A null-terminated key.
+         * @param[in] aValue  A null-terminated value.
+         *
+         * @retval OTBR_ERROR_NONE          Successfully appended the entry.
+         * @retval OTBR_ERROR_INVALID_ARGS  The entry is too long.
+         */
+        otbrError AppendEntry(const char *aKey, const char *aValue)
+        {
+            return AppendEntry(aKey, reinterpret_cast<const uint8_t *>(aValue), strlen(aValue));
+        }
+
+        /**
+         * This method appends a boolean attribute TXT entry.
+         *
+         * @param[in] aKey  A null-terminated key.
+         *
+         * @retval OTBR_ERROR_NONE          Successfully appended the entry.
+         * @retval OTBR_ERROR_INVALID_ARGS  The key is too long.
+         */
+        otbrError AppendBooleanAttribute(const char *aKey);
+
+        /**
+         * This method completes the TXT data.
+         *
+         * An empty string is written if no entry has been appended, since TXT data must not be empty.
+         */
+        void Finish(void);
+
+    private:
+        friend class Publisher;
+
+        otbrError Append(const char    *aKey,
+                         size_t         aKeyLength,
+                         const uint8_t *aValue,
+                         size_t         aValueLength,
+                         bool           aIsBooleanAttribute);
+
+        TxtData &mTxtData;
+    };
+
     /**
      * This structure represents information of a discovered service instance.
      */
@@ -157,17 +299,33 @@ public:
         void RemoveAddress(const Ip6Address &aAddress) { Publisher::RemoveAddress(mAddresses, aAddress); }
     };
 
+    /**
+     * This type represents an immutable snapshot of a discovered service instance, which is shared by the cache and
+     * all the subscribers notified of it.
+     */
+    using DiscoveredInstanceInfoPtr = std::shared_ptr<const DiscoveredInstanceInfo>;
+
+    /**
+     * This type represents an immutable snapshot of a discovered host, which is shared by the cache and all the
+     * subscribers notified of it.
+     */
+    using DiscoveredHostInfoPtr = std::shared_ptr<const DiscoveredHostInfo>;
+
     /**
      * This function is called to notify a discovered service instance.
+     *
+     * The subscriber may keep @p aInstanceInfo instead of copying the fields it needs.
      */
     using DiscoveredServiceInstanceCallback =
-        std::function<void(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)>;
+        std::function<void(const std::string &aType, const DiscoveredInstanceInfoPtr &aInstanceInfo)>;
 
     /**
      * This function is called to notify a discovered host.
+     *
+     * The subscriber may keep @p aHostInfo instead of copying the fields it needs.
      */
     using DiscoveredHostCallback =
-        std::function<void(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)>;
+        std::function<void(const std::string &aHostName, const DiscoveredHostInfoPtr &aHostInfo)>;
 
     /**
      * mDNS state values.
@@ -184,6 +342,89 @@ public:
     /** The callback for receiving the result of a operation. */
     using ResultCallback = OnceCallback<void(otbrError aError)>;
 
+    /**
+     * This class represents a batch of publishing operations.
+     *
+     * The operations are applied in the order they were added to the batch. Each method
+     * takes the same arguments as the corresponding single-entity method of `Publisher`.
+     */
+    class Batch
+    {
+    public:
+        void PublishService(std::string aHostName,
+                            std::string aName,
+                            std::string aType,
+                            SubTypeList aSubTypeList,
+                            uint16_t    aPort,
+                            TxtData     aTxtData);
+        void UnpublishService(std::string aName, std::string aType);
+        void PublishHost(std::string aName, AddressList aAddresses);
+        void UnpublishHost(std::string aName);
+        void PublishKey(std::string aName, KeyData aKeyData);
+        void UnpublishKey(std::string aName);
+
+        /**
+         * This method appends the operations of another batch to this batch.
+         *
+         * @param[in] aOther  The batch whose operations to append.
+         */
+        void Append(Batch &&aOther);
+
+        /**
+         * This method returns the number of operations in the batch.
+         *
+         * @returns The number of operations.
+         */
+        size_t GetSize(void) const { return mOperations.size(); }
+
+    private:
+        friend class Publisher;
+
+        enum class Action : uint8_t
+        {
+            kPublishService,
+            kUnpublishService,
+            kPublishHost,
+            kUnpublishHost,
+            kPublishKey,
+            kUnpublishKey,
+        };
+
+        struct Operation
+        {
+            explicit Operation(Action aAction)
+                : mAction(aAction)
+            {
+            }
+
+            bool IsUnpublish(void) const
+            {
+                return mAction == Action::kUnpublishService || mAction == Action::kUnpublishHost ||
+                       mAction == Action::kUnpublishKey;
+            }
+
+            Action      mAction;
+            std::string mHostName;
+            std::string mName;
+            std::string mType;
+            SubTypeList mSubTypeList;
+            uint16_t    mPort = 0;
+            TxtData     mTxtData;
+            AddressList mAddresses;
+            KeyData     mKeyData;
+        };
+
+        std::vector<Operation> mOperations;
+    };
+
+    /**
+     * The callback for receiving the results of a batch.
+     *
+     * @p aErrors holds the result of each operation in the order they were added to the batch,
+     * and @p aError is the first failure among them or `OTBR_ERROR_NONE`.
+     */
+    using BatchResultCallback = OnceCallback<void(otbrError aError, const std::vector<otbrError> &aErrors)>;
+
     /**
      * This method starts the mDNS publisher.
      *
@@ -239,7 +480,7 @@ public:
      * @param[in] aType      The type of this service, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aCallback  The callback for receiving the publishing result.
      */
-    virtual void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) = 0;
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback);
 
     /**
      * This method publishes or updates a host.
@@ -263,7 +504,7 @@ public:
      * @param[in] aName      A host name (MUST not end with dot).
      * @param[in] aCallback  The callback for receiving the publishing result.
      */
-    virtual void UnpublishHost(const std::string &aName, ResultCallback &&aCallback) = 0;
+    void UnpublishHost(const std::string &aName, ResultCallback &&aCallback);
 
     /**
      * This method publishes or updates a key record for a name.
@@ -284,22 +525,80 @@ public:
      * @param[in] aName      The name associated with key record.
      * @param[in] aCallback  The callback for receiving the publishing result.
      */
-    virtual void UnpublishKey(const std::string &aName, ResultCallback &&aCallback) = 0;
+    void UnpublishKey(const std::string &aName, ResultCallback &&aCallback);
+
+    /**
+     * This method tells whether a service is registered with the mDNS implementation.
+     *
+     * A service is registered from when it's published until it's un-published, its publishing fails or
+     * the mDNS implementation drops it, e.g. on a name conflict after it was established.
+     *
+     * @param[in] aName  The name of the service.
+     * @param[in] aType  The type of the service, e.g., "_srv._udp" (MUST NOT end with dot).
+     *
+     * @retval TRUE   The service is registered.
+     * @retval FALSE  The service is not registered.
+     */
+    bool IsServiceRegistered(const std::string &aName, const std::string &aType) const;
+
+    /**
+     * This method tells whether a host is registered with the mDNS implementation.
+     *
+     * @param[in] aName  The name of the host.
+     *
+     * @retval TRUE   The host is registered.
+     * @retval FALSE  The host is not registered.
+     *
+     * @sa IsServiceRegistered
+     */
+    bool IsHostRegistered(const std::string &aName) const;
+
+    /**
+     * This method applies a batch of publishing operations.
+     *
+     * @p aCallback is invoked exactly once, after every operation of the batch has completed. Un-publishing
+     * a host, service or key which is not published is considered successful.
+     *
+     * Consecutive operations which publish the records of one name, i.e. a host or a service instance and
+     * its key, are passed to the mDNS implementation as one group, which may register them together. The
+     * records of a host and of its services are not grouped, so that they can be updated separately.
+     *
+     * @param[in] aBatch     The batch of operations.
+     * @param[in] aCallback  The callback for receiving the aggregated result.
+     */
+    void PublishBatch(Batch aBatch, BatchResultCallback &&aCallback);
+
+    /**
+     * This method sets the window for coalescing the updates of a registration.
+     *
+     * If a service, host or key is updated within @p aWindow since its current registration began, the update
+     * is deferred until the window elapses, and later updates of the same name within the window supersede it.
+     * Only the last update is applied by the mDNS implementation, and the callbacks of the superseded updates
+     * receive its result. Un-publishing a name aborts its deferred update with `OTBR_ERROR_ABORTED`.
+     *
+     * The window is zero by default, which applies every update immediately.
+     *
+     * @param[in] aWindow  The coalescing window.
+     */
+    void SetUpdateCoalescingWindow(Milliseconds aWindow) { mUpdateCoalescingWindow = aWindow; }
 
     /**
      * This method subscribes a given service or service instance.
      *
      * If @p aInstanceName is not empty, this method subscribes the service instance. Otherwise, this method subscribes
-     * the service. mDNS implementations should use the `DiscoveredServiceInstanceCallback` function to notify
-     * discovered service instances.
+     * the service. Discovered service instances are notified with the `DiscoveredServiceInstanceCallback` functions.
      *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same service or service
-     * instance.
+     * Subscriptions are reference-counted, and each call must be balanced by a call to `UnsubscribeService`. If the
+     * service or service instance is already subscribed and unexpired answers of it have been cached, they are
+     * notified to @p aSubscriberId only on the next mainloop iteration. Otherwise, the mDNS implementation is
+     * queried again so that the new subscriber receives its answers.
      *
      * @param[in] aType          The service type, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aInstanceName  The service instance to subscribe, or empty to subscribe the service.
+     * @param[in] aSubscriberId  The Subscriber ID returned by `AddSubscriptionCallbacks` to receive cached answers,
+     *                           or 0 to always query the mDNS implementation.
      */
-    virtual void SubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void SubscribeService(const std::string &aType, const std::string &aInstanceName, uint64_t aSubscriberId = 0);
 
     /**
      * This method unsubscribes a given service or service instance.
@@ -307,43 +606,96 @@ public:
      * If @p aInstanceName is not empty, this method unsubscribes the service instance. Otherwise, this method
      * unsubscribes the service.
      *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a service or service instance.
-     *
      * @param[in] aType          The service type, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aInstanceName  The service instance to unsubscribe, or empty to unsubscribe the service.
      */
-    virtual void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method subscribes a given host.
      *
-     * mDNS implementations should use the `DiscoveredHostCallback` function to notify discovered hosts.
+     * Discovered hosts are notified with the `DiscoveredHostCallback` functions. Subscriptions are reference-counted,
+     * and each call must be balanced by a call to `UnsubscribeHost`. If the host is already subscribed and an
+     * unexpired answer of it has been cached, it's notified to @p aSubscriberId only on the next mainloop iteration.
+     * Otherwise, the mDNS implementation is queried again so that the new subscriber receives the answer.
      *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same host.
+     * @param[in] aHostName      The host name (without domain).
+     * @param[in] aSubscriberId  The Subscriber ID returned by `AddSubscriptionCallbacks` to receive the cached answer,
+     *                           or 0 to always query the mDNS implementation.
+     */
+    void SubscribeHost(const std::string &aHostName, uint64_t aSubscriberId = 0);
+
+    /**
+     * This method unsubscribes a given host.
      *
      * @param[in] aHostName  The host name (without domain).
      */
-    virtual void SubscribeHost(const std::string &aHostName) = 0;
+    void UnsubscribeHost(const std::string &aHostName);
 
     /**
-     * This method unsubscribes a given host.
+     * This method queries a subscribed service or service instance again.
+     *
+     * The mDNS implementation restarts its query without changing the references of the subscription, and the
+     * responses are notified to all the subscribers. This method does nothing if the service or service instance
+     * is not subscribed.
+     *
+     * @param[in] aType          The service type, e.g., "_srv._udp" (MUST NOT end with dot).
+     * @param[in] aInstanceName  The service instance to query, or empty to query the service.
+     */
+    void RequeryService(const std::string &aType, const std::string &aInstanceName);
+
+    /**
+     * This method queries a subscribed host again.
+     *
+     * The mDNS implementation restarts its query without changing the references of the subscription, and the
+     * response is notified to all the subscribers. This method does nothing if the host is not subscribed.
+     *
+     * @param[in] aHostName  The host name (without domain).
+     */
+    void RequeryHost(const std::string &aHostName);
+
+    /**
+     * This method tells whether a service or service instance is subscribed.
+     *
+     * A subscription is kept until it's balanced by the unsubscriptions or the mDNS implementation is stopped,
+     * even while the mDNS implementation hasn't started it.
      *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a host.
+     * @param[in] aType          The service type, e.g., "_srv._udp" (MUST NOT end with dot).
+     * @param[in] aInstanceName  The service instance, or empty for the service.
+     *
+     * @retval TRUE   The service or service instance is subscribed.
+     * @retval FALSE  The service or service instance is not subscribed.
+     */
+    bool IsServiceSubscribed(const std::string &aType, const std::string &aInstanceName) const;
+
+    /**
+     * This method tells whether a host is subscribed.
      *
      * @param[in] aHostName  The host name (without domain).
+     *
+     * @retval TRUE   The host is subscribed.
+     * @retval FALSE  The host is not subscribed.
+     *
+     * @sa IsServiceSubscribed
      */
-    virtual void UnsubscribeHost(const std::string &aHostName) = 0;
+    bool IsHostSubscribed(const std::string &aHostName) const;
 
     /**
      * This method sets the callbacks for subscriptions.
      *
+     * The discovered results are immutable snapshots shared by all the subscribers, which the callbacks may keep
+     * after returning instead of copying them.
+     *
      * @param[in] aInstanceCallback  The callback function to receive discovered service instances.
      * @param[in] aHostCallback      The callback function to receive discovered hosts.
+     * @param[in] aServiceType       The service type, e.g., "_srv._udp", @p aInstanceCallback is invoked for, or empty
+     *                               to invoke it for all service types.
      *
      * @returns  The Subscriber ID for the callbacks.
      */
     uint64_t AddSubscriptionCallbacks(DiscoveredServiceInstanceCallback aInstanceCallback,
-                                      DiscoveredHostCallback            aHostCallback);
+                                      DiscoveredHostCallback            aHostCallback,
+                                      const std::string                &aServiceType = "");
 
     /**
      * This method cancels callbacks for subscriptions.
@@ -359,7 +711,14 @@ public:
      */
     const MdnsTelemetryInfo &GetMdnsTelemetryInfo(void) const { return mTelemetryInfo; }
 
-    virtual ~Publisher(void) = default;
+    /**
+     * This method returns the latency histograms and backend errors of the publisher.
+     *
+     * @returns  The MdnsOperationStats of the publisher.
+     */
+    const MdnsOperationStats &GetMdnsOperationStats(void) const { return mOperationStats; }
+
+    virtual ~Publisher(void);
 
     /**
      * This function creates a mDNS publisher.
@@ -419,10 +778,12 @@ protected:
     public:
         ResultCallback mCallback;
         Publisher     *mPublisher;
+        Timepoint      mBeginTime; // The time when the publishing of this registration began.
 
         Registration(ResultCallback &&aCallback, Publisher *aPublisher)
             : mCallback(std::move(aCallback))
             , mPublisher(aPublisher)
+            , mBeginTime(aPublisher->mPublishBeginTime)
         {
         }
         virtual ~Registration(void);
@@ -534,12 +895,67 @@ protected:
         void OnComplete(otbrError aError);
     };
 
+    // A non-owning key of the registration maps, which represents the name `aName` or `aName.aType`.
+    //
+    // The key of a registration refers to the names owned by the registration itself, so the names
+    // aren't duplicated in the maps, and a lookup doesn't need to build a full name string. A key
+    // which is made of a single name is equal to a key which is made of a name and a type if their
+    // full names are the same, e.g. `{"ins._srv._udp"}` equals to `{"ins", "_srv._udp"}`.
+    class NameKey
+    {
+    public:
+        explicit NameKey(const std::string &aName)
+            : mName(&aName)
+            , mType(nullptr)
+        {
+        }
+
+        NameKey(const std::string &aName, const std::string &aType)
+            : mName(&aName)
+            , mType(&aType)
+        {
+        }
+
+        bool operator==(const NameKey &aOther) const;
+
+        struct Hash
+        {
+            size_t operator()(const NameKey &aKey) const;
+        };
+
+    private:
+        size_t GetLength(void) const { return mName->size() + (mType != nullptr ? mType->size() + 1 : 0); }
+        char   GetCharAt(size_t aIndex) const;
+
+        const std::string *mName;
+        const std::string *mType;
+    };
+
     using ServiceRegistrationPtr = std::unique_ptr<ServiceRegistration>;
-    using ServiceRegistrationMap = std::map<std::string, ServiceRegistrationPtr>;
+    using ServiceRegistrationMap = std::unordered_map<NameKey, ServiceRegistrationPtr, NameKey::Hash>;
     using HostRegistrationPtr    = std::unique_ptr<HostRegistration>;
-    using HostRegistrationMap    = std::map<std::string, HostRegistrationPtr>;
+    using HostRegistrationMap    = std::unordered_map<NameKey, HostRegistrationPtr, NameKey::Hash>;
     using KeyRegistrationPtr     = std::unique_ptr<KeyRegistration>;
-    using KeyRegistrationMap     = std::map<std::string, KeyRegistrationPtr>;
+    using KeyRegistrationMap     = std::unordered_map<NameKey, KeyRegistrationPtr, NameKey::Hash>;
+
+    // An update of a registration which is deferred by the coalescing window. The key of the
+    // pending update refers to the names owned by `mOperation`.
+    struct PendingUpdate
+    {
+        PendingUpdate(Batch::Operation &&aOperation, ResultCallback &&aCallback)
+            : mOperation(std::move(aOperation))
+            , mCallback(std::move(aCallback))
+            , mTimerId(0)
+        {
+        }
+
+        Batch::Operation         mOperation;
+        ResultCallback           mCallback;
+        MainloopManager::TimerId mTimerId;
+    };
+
+    using PendingUpdatePtr = std::unique_ptr<PendingUpdate>;
+    using PendingUpdateMap = std::unordered_map<NameKey, PendingUpdatePtr, NameKey::Hash>;
 
     static SubTypeList SortSubTypeList(SubTypeList aSubTypeList);
     static AddressList SortAddressList(AddressList aAddressList);
@@ -562,6 +978,47 @@ protected:
 
     virtual otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) = 0;
 
+    virtual void UnpublishServiceImpl(const std::string &aName,
+                                      const std::string &aType,
+                                      ResultCallback   &&aCallback) = 0;
+
+    virtual void UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) = 0;
+    virtual void UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)  = 0;
+
+    // Bracket the publishing operations of the records of one name in a batch. Groups may nest
+    // when a callback invoked during a group publishes another batch. `Publish*Impl()` should call
+    // `TakePublishGroup()` on entry to know whether its records belong to the innermost group.
+    virtual void BeginPublishGroup(void) {}
+    virtual void EndPublishGroup(void) {}
+
+    bool TakePublishGroup(void)
+    {
+        bool grouped = mPublishGroupArmed;
+
+        mPublishGroupArmed = false;
+        return grouped;
+    }
+
+    // Subscribes and unsubscribes in the mDNS implementation. `Publisher` guarantees that there are
+    // no duplicate subscriptions and no redundant unsubscriptions. mDNS implementations should use
+    // `OnServiceResolved`, `OnServiceRemoved` and `OnHostResolved` to notify discovered results.
+    //
+    // `Subscribe*Impl()` returns an error if the subscription is not started, e.g. when the mDNS
+    // implementation is not ready, in which case it's retried for the next subscriber.
+    virtual otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) = 0;
+    virtual void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) = 0;
+    virtual otbrError SubscribeHostImpl(const std::string &aHostName)                                    = 0;
+    virtual void      UnsubscribeHostImpl(const std::string &aHostName)                                  = 0;
+
+    // Forgets all subscriptions and cached results. mDNS implementations should call
+    // this method when they drop their subscriptions, e.g. when they are stopped.
+    void ClearSubscriptions(void);
+
+    // Aborts the updates deferred by the coalescing window, so that they are not applied after a
+    // restart. mDNS implementations should call this method when they are stopped, after leaving
+    // the ready state so that the aborted callbacks can't publish again.
+    void AbortPendingUpdates(void);
+
     virtual void OnServiceResolveFailedImpl(const std::string &aType,
                                             const std::string &aInstanceName,
                                             int32_t            aErrorCode) = 0;
@@ -581,6 +1038,25 @@ protected:
     void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo);
     void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode);
 
+    void NotifyServiceInstance(const std::string               &aType,
+                               const DiscoveredInstanceInfoPtr &aInstanceInfo,
+                               uint64_t                         aSubscriberId = 0);
+    void NotifyHost(const std::string &aHostName, const DiscoveredHostInfoPtr &aHostInfo, uint64_t aSubscriberId = 0);
+    void UpdateInstanceCache(const std::string &aType, const DiscoveredInstanceInfoPtr &aInstanceInfo);
+    void UpdateHostCache(const std::string &aHostName, const DiscoveredHostInfoPtr &aHostInfo);
+    void PurgeExpiredCache(void);
+    bool HasCachedServiceInstances(const std::string &aType, const std::string &aInstanceName) const;
+    bool HasCachedHost(const std::string &aHostName) const;
+    void ScheduleReplay(uint64_t           aSubscriberId,
+                        const std::string &aType,
+                        const std::string &aInstanceName,
+                        const std::string &aHostName);
+    void HandleReplayTimer(void);
+    void ReplayServiceInstances(uint64_t aSubscriberId, const std::string &aType, const std::string &aInstanceName);
+    void ReplayHost(uint64_t aSubscriberId, const std::string &aHostName);
+
+    static uint32_t GetRemainingTtl(Timepoint aExpireTime, Timepoint aNow);
+
     // Handles the cases that there is already a registration for the same service.
     // If the returned callback is completed, current registration should be considered
     // success and no further action should be performed.
@@ -609,18 +1085,41 @@ protected:
     KeyRegistration *FindKeyRegistration(const std::string &aName);
     KeyRegistration *FindKeyRegistration(const std::string &aName, const std::string &aType);
 
+    // Tells whether an update should be deferred by the coalescing window. @p aOutdatedReg is the
+    // registration which is outdated by the update, or `nullptr` if there is no such registration.
+    bool ShouldDeferUpdate(const PendingUpdateMap &aPendingUpdates,
+                           const NameKey          &aKey,
+                           const Registration     *aOutdatedReg) const;
+    void DeferUpdate(PendingUpdateMap   &aPendingUpdates,
+                     const Registration *aOutdatedReg,
+                     Batch::Operation  &&aOperation,
+                     ResultCallback    &&aCallback);
+    void HandlePendingUpdateTimer(PendingUpdateMap &aPendingUpdates, const PendingUpdate &aUpdate);
+    void AbortPendingUpdate(PendingUpdateMap &aPendingUpdates, const NameKey &aKey);
+    void AbortPendingUpdates(PendingUpdateMap &aPendingUpdates);
+    void DispatchOperation(Batch::Operation &aOperation, ResultCallback &&aCallback);
+
+    static NameKey     MakeNameKey(const Batch::Operation &aOperation);
+    static std::string GetPublishGroupName(const Batch &aBatch, const Batch::Operation &aOperation);
+
     static void UpdateMdnsResponseCounters(MdnsResponseCounters &aCounters, otbrError aError);
     static void UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError);
 
-    void UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
-                                             const std::string &aType,
-                                             otbrError          aError);
-    void UpdateHostRegistrationEmaLatency(const std::string &aHostName, otbrError aError);
-    void UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otbrError aError);
-    void UpdateServiceInstanceResolutionEmaLatency(const std::string &aInstanceName,
-                                                   const std::string &aType,
-                                                   otbrError          aError);
-    void UpdateHostResolutionEmaLatency(const std::string &aHostName, otbrError aError);
+    static void UpdateLatency(uint32_t         &aEmaLatency,
+                              LatencyHistogram &aHistogram,
+                              Timepoint         aBeginTime,
+                              otbrError         aError);
+    void UpdateServiceInstanceResolutionLatency(const std::string &aInstanceName,
+                                                const std::string &aType,
+                                                otbrError          aError);
+    void UpdateHostResolutionLatency(const std::string &aHostName, otbrError aError);
+
+    /**
+     * This method counts a failure reported by the mDNS backend with its backend-specific error code.
+     *
+     * @param[in] aErrorCode  The backend-specific error code.
+     */
+    void RecordBackendError(int32_t aErrorCode);
 
     static void AddAddress(AddressList &aAddressList, const Ip6Address &aAddress);
     static void RemoveAddress(AddressList &aAddressList, const Ip6Address &aAddress);
@@ -629,14 +1128,22 @@ protected:
     HostRegistrationMap    mHostRegistrations;
     KeyRegistrationMap     mKeyRegistrations;
 
+    PendingUpdateMap mPendingServiceUpdates;
+    PendingUpdateMap mPendingHostUpdates;
+    PendingUpdateMap mPendingKeyUpdates;
+    Milliseconds     mUpdateCoalescingWindow{0};
+    bool             mPublishGroupArmed = false;
+
     struct DiscoverCallback
     {
         DiscoverCallback(uint64_t                          aId,
                          DiscoveredServiceInstanceCallback aServiceCallback,
-                         DiscoveredHostCallback            aHostCallback)
+                         DiscoveredHostCallback            aHostCallback,
+                         const std::string                &aServiceType)
             : mId(aId)
             , mServiceCallback(std::move(aServiceCallback))
             , mHostCallback(std::move(aHostCallback))
+            , mServiceType(aServiceType)
             , mShouldInvoke(false)
         {
         }
@@ -644,6 +1151,7 @@ protected:
         uint64_t                          mId;
         DiscoveredServiceInstanceCallback mServiceCallback;
         DiscoveredHostCallback            mHostCallback;
+        std::string                       mServiceType; // Empty for all service types.
         bool                              mShouldInvoke;
     };
 
@@ -651,18 +1159,50 @@ protected:
 
     std::list<DiscoverCallback> mDiscoverCallbacks;
 
-    // {instance name, service type} -> the timepoint to begin service registration
-    std::map<std::pair<std::string, std::string>, Timepoint> mServiceRegistrationBeginTime;
-    // host name -> the timepoint to begin host registration
-    std::map<std::string, Timepoint> mHostRegistrationBeginTime;
-    // key name -> the timepoint to begin key registration
-    std::map<std::string, Timepoint> mKeyRegistrationBeginTime;
+    template <class Info> struct CacheEntry
+    {
+        std::shared_ptr<const Info> mInfo;
+        Timepoint                   mExpireTime;
+    };
+
+    // A subscription whose cached results are waiting to be replayed to a new subscriber.
+    // Exactly one of `mType` and `mHostName` is non-empty.
+    struct PendingReplay
+    {
+        uint64_t    mSubscriberId;
+        std::string mType;
+        std::string mInstanceName;
+        std::string mHostName;
+    };
+
+    struct Subscription
+    {
+        uint32_t mCount    = 0;     // The number of subscriptions.
+        bool     mIsActive = false; // Whether the mDNS implementation has started the subscription.
+    };
+
+    // {service type, instance name} -> the subscription
+    std::map<std::pair<std::string, std::string>, Subscription> mServiceSubscriptions;
+    // host name -> the subscription
+    std::map<std::string, Subscription> mHostSubscriptions;
+    // {lowercase service type, lowercase instance name} -> the discovered instance
+    std::map<std::pair<std::string, std::string>, CacheEntry<DiscoveredInstanceInfo>> mInstanceCache;
+    // lowercase host name -> the discovered host
+    std::map<std::string, CacheEntry<DiscoveredHostInfo>> mHostCache;
+
+    std::vector<PendingReplay> mPendingReplays;
+    MainloopManager::TimerId   mReplayTimerId = 0;
+
+    // The timepoint to begin the ongoing `Publish*()` call, which is adopted
+    // by the registration created by `Publish*Impl()`.
+    Timepoint mPublishBeginTime;
     // {instance name, service type} -> the timepoint to begin service resolution
     std::map<std::pair<std::string, std::string>, Timepoint> mServiceInstanceResolutionBeginTime;
     // host name -> the timepoint to begin host resolution
     std::map<std::string, Timepoint> mHostResolutionBeginTime;
 
-    MdnsTelemetryInfo mTelemetryInfo{};
+    MdnsTelemetryInfo  mTelemetryInfo{};
+    MdnsOperationStats mOperationStats;
 };
 
 /**
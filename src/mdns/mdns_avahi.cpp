@@ -36,6 +36,7 @@
 #include "mdns/mdns_avahi.hpp"
 
 #include <algorithm>
+#include <map>
 
 #include <avahi-client/client.h>
 #include <avahi-common/alternative.h>
@@ -73,6 +74,8 @@ struct AvahiWatch
     bool               mShouldReport; ///< Whether or not we need to report events (invoking callback).
     AvahiPoller       &mPoller;       ///< The poller owning this watch.
 
+    std::multimap<int, AvahiWatch *>::iterator mTableIterator; ///< The entry of this watch in the poller's fd table.
+
     /**
      * The constructor to initialize an Avahi watch.
      *
@@ -106,6 +109,9 @@ struct AvahiTimeout
     bool                 mShouldReport; ///< Whether or not timeout occurred and need to reported (invoking callback).
     AvahiPoller         &mPoller;       ///< The poller created this timer.
 
+    std::multimap<otbr::Timepoint, AvahiTimeout *>::iterator mQueueIterator; ///< The entry of this timer in the
+                                                                             ///< poller's timer queue.
+
     /**
      * The constructor to initialize an AvahiTimeout.
      *
@@ -178,14 +184,20 @@ public:
 
     // Implementation of MainloopProcessor.
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "AvahiPoller"; }
 
     const AvahiPoll *GetAvahiPoll(void) const { return &mAvahiPoll; }
 
 private:
-    typedef std::vector<AvahiWatch *>   Watches;
-    typedef std::vector<AvahiTimeout *> Timers;
+    // Watches indexed by fd. Avahi may register more than one watch on the
+    // same fd (e.g. separate read and write watches of a D-Bus connection).
+    typedef std::multimap<int, AvahiWatch *> Watches;
+
+    // Armed timers ordered by their expiration time. Disarmed timers are
+    // not present in the queue.
+    typedef std::multimap<Timepoint, AvahiTimeout *> TimerQueue;
 
     static AvahiWatch     *WatchNew(const struct AvahiPoll *aPoll,
                                     int                     aFd,
@@ -205,13 +217,19 @@ private:
     static void            TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout);
     static void            TimeoutFree(AvahiTimeout *aTimer);
     void                   TimeoutFree(AvahiTimeout &aTimer);
-
-    Watches   mWatches;
-    Timers    mTimers;
-    AvahiPoll mAvahiPoll;
+    void                   ArmTimer(AvahiTimeout &aTimer, const struct timeval *aTimeout);
+    void                   DisarmTimer(AvahiTimeout &aTimer);
+
+    Watches                     mWatches;
+    TimerQueue                  mTimerQueue;
+    bool                        mIsProcessing;
+    std::vector<AvahiWatch *>   mFreedWatches;
+    std::vector<AvahiTimeout *> mFreedTimers;
+    AvahiPoll                   mAvahiPoll;
 };
 
 AvahiPoller::AvahiPoller(void)
+    : mIsProcessing(false)
 {
     mAvahiPoll.userdata         = this;
     mAvahiPoll.watch_new        = WatchNew;
@@ -235,11 +253,14 @@ AvahiWatch *AvahiPoller::WatchNew(const struct AvahiPoll *aPoll,
 
 AvahiWatch *AvahiPoller::WatchNew(int aFd, AvahiWatchEvent aEvent, AvahiWatchCallback aCallback, void *aContext)
 {
+    AvahiWatch *watch;
+
     assert(aEvent && aCallback && aFd >= 0);
 
-    mWatches.push_back(new AvahiWatch(aFd, aEvent, aCallback, aContext, *this));
+    watch                 = new AvahiWatch(aFd, aEvent, aCallback, aContext, *this);
+    watch->mTableIterator = mWatches.emplace(aFd, watch);
 
-    return mWatches.back();
+    return watch;
 }
 
 void AvahiPoller::WatchUpdate(AvahiWatch *aWatch, AvahiWatchEvent aEvent)
@@ -259,14 +280,18 @@ void AvahiPoller::WatchFree(AvahiWatch *aWatch)
 
 void AvahiPoller::WatchFree(AvahiWatch &aWatch)
 {
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    mWatches.erase(aWatch.mTableIterator);
+
+    if (mIsProcessing)
     {
-        if (*it == &aWatch)
-        {
-            mWatches.erase(it);
-            delete &aWatch;
-            break;
-        }
+        // `Process()` may still hold a pointer to this watch, so defer the
+        // deletion until it finishes reporting.
+        aWatch.mShouldReport = false;
+        mFreedWatches.push_back(&aWatch);
+    }
+    else
+    {
+        delete &aWatch;
     }
 }
 
@@ -281,46 +306,74 @@ AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll      *aPoll,
 
 AvahiTimeout *AvahiPoller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
 {
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, *this));
-    return mTimers.back();
+    AvahiTimeout *timer = new AvahiTimeout(aTimeout, aCallback, aContext, *this);
+
+    timer->mQueueIterator = mTimerQueue.end();
+
+    if (aTimeout != nullptr)
+    {
+        timer->mQueueIterator = mTimerQueue.emplace(timer->mTimeout, timer);
+    }
+
+    return timer;
 }
 
 void AvahiPoller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
 {
-    if (aTimeout == nullptr)
+    aTimer->mPoller.ArmTimer(*aTimer, aTimeout);
+}
+
+void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
+{
+    aTimer->mPoller.TimeoutFree(*aTimer);
+}
+
+void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
+{
+    DisarmTimer(aTimer);
+
+    if (mIsProcessing)
     {
-        aTimer->mTimeout = Timepoint::min();
+        mFreedTimers.push_back(&aTimer);
     }
     else
     {
-        aTimer->mTimeout = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+        delete &aTimer;
     }
 }
 
-void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
+void AvahiPoller::ArmTimer(AvahiTimeout &aTimer, const struct timeval *aTimeout)
 {
-    aTimer->mPoller.TimeoutFree(*aTimer);
+    DisarmTimer(aTimer);
+
+    if (aTimeout == nullptr)
+    {
+        aTimer.mTimeout = Timepoint::min();
+    }
+    else
+    {
+        aTimer.mTimeout       = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+        aTimer.mQueueIterator = mTimerQueue.emplace(aTimer.mTimeout, &aTimer);
+    }
 }
 
-void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
+void AvahiPoller::DisarmTimer(AvahiTimeout &aTimer)
 {
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+    // An updated or freed timer must not fire for its previous expiration.
+    aTimer.mShouldReport = false;
+
+    if (aTimer.mQueueIterator != mTimerQueue.end())
     {
-        if (*it == &aTimer)
-        {
-            mTimers.erase(it);
-            delete &aTimer;
-            break;
-        }
+        mTimerQueue.erase(aTimer.mQueueIterator);
+        aTimer.mQueueIterator = mTimerQueue.end();
     }
 }
 
 void AvahiPoller::Update(MainloopContext &aMainloop)
 {
-    Timepoint now = Clock::now();
-
-    for (AvahiWatch *watch : mWatches)
+    for (const auto &entry : mWatches)
     {
+        AvahiWatch     *watch  = entry.second;
         int             fd     = watch->mFd;
         AvahiWatchEvent events = watch->mEvents;
 
@@ -349,19 +402,14 @@ void AvahiPoller::Update(MainloopContext &aMainloop)
         watch->mHappened = 0;
     }
 
-    for (AvahiTimeout *timer : mTimers)
+    if (!mTimerQueue.empty())
     {
-        Timepoint timeout = timer->mTimeout;
-
-        if (timeout == Timepoint::min())
-        {
-            continue;
-        }
+        Timepoint now     = Clock::now();
+        Timepoint timeout = mTimerQueue.begin()->first;
 
         if (timeout <= now)
         {
             aMainloop.mTimeout = ToTimeval(Microseconds::zero());
-            break;
         }
         else
         {
@@ -377,11 +425,13 @@ void AvahiPoller::Update(MainloopContext &aMainloop)
 
 void AvahiPoller::Process(const MainloopContext &aMainloop)
 {
-    Timepoint now          = Clock::now();
-    bool      shouldReport = false;
+    Timepoint                   now = Clock::now();
+    std::vector<AvahiWatch *>   readyWatches;
+    std::vector<AvahiTimeout *> expiredTimers;
 
-    for (AvahiWatch *watch : mWatches)
+    for (const auto &entry : mWatches)
     {
+        AvahiWatch     *watch  = entry.second;
         int             fd     = watch->mFd;
         AvahiWatchEvent events = watch->mEvents;
 
@@ -405,65 +455,61 @@ void AvahiPoller::Process(const MainloopContext &aMainloop)
         if (watch->mHappened != 0)
         {
             watch->mShouldReport = true;
-            shouldReport         = true;
+            readyWatches.push_back(watch);
         }
     }
 
+    // Expired timers are taken off the queue before any callback is invoked,
+    // so that a timer re-armed from a callback fires in a later iteration.
+    while (!mTimerQueue.empty() && mTimerQueue.begin()->first <= now)
+    {
+        AvahiTimeout *timer = mTimerQueue.begin()->second;
+
+        mTimerQueue.erase(mTimerQueue.begin());
+        timer->mQueueIterator = mTimerQueue.end();
+        timer->mShouldReport  = true;
+        expiredTimers.push_back(timer);
+    }
+
     // When we invoke the callback for an `AvahiWatch` or `AvahiTimeout`,
     // the Avahi module can call any of `mAvahiPoll` APIs we provided to
     // it. For example, it can update or free any of `AvahiWatch/Timeout`
-    // entries, which in turn, modifies our `mWatches` or `mTimers` list.
-    // So, before invoking the callback, we update the entry's state and
-    // then restart the iteration over the `mWacthes` list to find the
-    // next entry to report, as the list may have changed.
+    // entries. Freed entries are kept alive until all callbacks are
+    // invoked and their `mShouldReport` is cleared, so they are skipped.
 
-    while (shouldReport)
-    {
-        shouldReport = false;
+    mIsProcessing = true;
 
-        for (AvahiWatch *watch : mWatches)
+    for (AvahiWatch *watch : readyWatches)
+    {
+        if (watch->mShouldReport)
         {
-            if (watch->mShouldReport)
-            {
-                shouldReport         = true;
-                watch->mShouldReport = false;
-                watch->mCallback(watch, watch->mFd, WatchGetEvents(watch), watch->mContext);
-
-                break;
-            }
+            watch->mShouldReport = false;
+            watch->mCallback(watch, watch->mFd, WatchGetEvents(watch), watch->mContext);
         }
     }
 
-    for (AvahiTimeout *timer : mTimers)
+    for (AvahiTimeout *timer : expiredTimers)
     {
-        if (timer->mTimeout == Timepoint::min())
-        {
-            continue;
-        }
-
-        if (timer->mTimeout <= now)
+        if (timer->mShouldReport)
         {
-            timer->mShouldReport = true;
-            shouldReport         = true;
+            timer->mShouldReport = false;
+            timer->mCallback(timer, timer->mContext);
         }
     }
 
-    while (shouldReport)
-    {
-        shouldReport = false;
+    mIsProcessing = false;
 
-        for (AvahiTimeout *timer : mTimers)
-        {
-            if (timer->mShouldReport)
-            {
-                shouldReport         = true;
-                timer->mShouldReport = false;
-                timer->mCallback(timer, timer->mContext);
+    for (AvahiWatch *watch : mFreedWatches)
+    {
+        delete watch;
+    }
+    mFreedWatches.clear();
 
-                break;
-            }
-        }
+    for (AvahiTimeout *timer : mFreedTimers)
+    {
+        delete timer;
     }
+    mFreedTimers.clear();
 }
 
 PublisherAvahi::PublisherAvahi(StateCallback aStateCallback)
@@ -471,6 +517,7 @@ PublisherAvahi::PublisherAvahi(StateCallback aStateCallback)
     , mPoller(MakeUnique<AvahiPoller>())
     , mState(State::kIdle)
     , mStateCallback(std::move(aStateCallback))
+    , mClearingRegistrations(false)
 {
 }
 
@@ -481,17 +528,17 @@ PublisherAvahi::~PublisherAvahi(void)
 
 PublisherAvahi::AvahiServiceRegistration::~AvahiServiceRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->LeaveGroup(mEntryGroup);
 }
 
 PublisherAvahi::AvahiHostRegistration::~AvahiHostRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->LeaveGroup(mEntryGroup);
 }
 
 PublisherAvahi::AvahiKeyRegistration::~AvahiKeyRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->LeaveGroup(mEntryGroup);
 }
 
 otbrError PublisherAvahi::Start(void)
@@ -519,11 +566,17 @@ bool PublisherAvahi::IsStarted(void) const
 
 void PublisherAvahi::Stop(void)
 {
-    mServiceRegistrations.clear();
-    mHostRegistrations.clear();
+    ClearRegistrations();
+
+    // Groups of an ongoing batch are released before the client frees them.
+    for (EntryGroupPtr &group : mOpenGroups)
+    {
+        group = nullptr;
+    }
 
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
+    ClearSubscriptions();
 
     if (mClient)
     {
@@ -532,6 +585,8 @@ void PublisherAvahi::Stop(void)
     }
 
     mState = Mdns::Publisher::State::kIdle;
+
+    AbortPendingUpdates();
 }
 
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext)
@@ -555,14 +610,19 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
 
     case AVAHI_ENTRY_GROUP_COLLISION:
         otbrLogInfo("Avahi group (@%p) name conflicted", aGroup);
+        RecordBackendError(AVAHI_ERR_COLLISION);
         CallHostOrServiceCallback(aGroup, OTBR_ERROR_DUPLICATED);
         break;
 
     case AVAHI_ENTRY_GROUP_FAILURE:
-        otbrLogErr("Avahi group (@%p) failed: %s!", aGroup,
-                   avahi_strerror(avahi_client_errno(avahi_entry_group_get_client(aGroup))));
+    {
+        int avahiError = avahi_client_errno(avahi_entry_group_get_client(aGroup));
+
+        otbrLogErr("Avahi group (@%p) failed: %s!", aGroup, avahi_strerror(avahiError));
+        RecordBackendError(avahiError);
         CallHostOrServiceCallback(aGroup, OTBR_ERROR_MDNS);
         break;
+    }
 
     case AVAHI_ENTRY_GROUP_UNCOMMITED:
     case AVAHI_ENTRY_GROUP_REGISTERING:
@@ -572,57 +632,91 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
 
 void PublisherAvahi::CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError)
 {
-    ServiceRegistration *serviceReg;
-    HostRegistration    *hostReg;
-    KeyRegistration     *keyReg;
+    std::vector<ServiceRegistration *> serviceRegs;
+    std::vector<HostRegistration *>    hostRegs;
+    std::vector<KeyRegistration *>     keyRegs;
+
+    VerifyOrExit(aError == OTBR_ERROR_NONE, FailGroup(aGroup, aError));
 
-    if ((serviceReg = FindServiceRegistration(aGroup)) != nullptr)
+    // A group may be shared by several registrations. They are collected first, since a
+    // callback invoked by `Complete()` may change the registrations.
+    for (const auto &entry : mServiceRegistrations)
     {
-        if (aError == OTBR_ERROR_NONE)
-        {
-            serviceReg->Complete(aError);
-        }
-        else
+        if (static_cast<const AvahiServiceRegistration &>(*entry.second).GetEntryGroup() == aGroup)
         {
-            RemoveServiceRegistration(serviceReg->mName, serviceReg->mType, aError);
+            serviceRegs.push_back(entry.second.get());
         }
     }
-    else if ((hostReg = FindHostRegistration(aGroup)) != nullptr)
+    for (const auto &entry : mHostRegistrations)
     {
-        if (aError == OTBR_ERROR_NONE)
+        if (static_cast<const AvahiHostRegistration &>(*entry.second).GetEntryGroup() == aGroup)
         {
-            hostReg->Complete(aError);
-        }
-        else
-        {
-            RemoveHostRegistration(hostReg->mName, aError);
+            hostRegs.push_back(entry.second.get());
         }
     }
-    else if ((keyReg = FindKeyRegistration(aGroup)) != nullptr)
+    for (const auto &entry : mKeyRegistrations)
     {
-        if (aError == OTBR_ERROR_NONE)
-        {
-            keyReg->Complete(aError);
-        }
-        else
+        if (static_cast<const AvahiKeyRegistration &>(*entry.second).GetEntryGroup() == aGroup)
         {
-            RemoveKeyRegistration(keyReg->mName, aError);
+            keyRegs.push_back(entry.second.get());
         }
     }
-    else
+
+    if (serviceRegs.empty() && hostRegs.empty() && keyRegs.empty())
     {
         otbrLogWarning("No registered service or host matches avahi group @%p", aGroup);
     }
+
+    for (ServiceRegistration *serviceReg : serviceRegs)
+    {
+        serviceReg->Complete(aError);
+    }
+    for (HostRegistration *hostReg : hostRegs)
+    {
+        hostReg->Complete(aError);
+    }
+    for (KeyRegistration *keyReg : keyRegs)
+    {
+        keyReg->Complete(aError);
+    }
+
+exit:
+    return;
 }
 
-AvahiEntryGroup *PublisherAvahi::CreateGroup(AvahiClient *aClient)
+PublisherAvahi::EntryGroupPtr PublisherAvahi::CreateGroup(AvahiClient *aClient)
 {
+    EntryGroupPtr    groupPtr;
     AvahiEntryGroup *group = avahi_entry_group_new(aClient, HandleGroupState, this);
 
     if (group == nullptr)
     {
         otbrLogErr("Failed to create entry avahi group: %s", avahi_strerror(avahi_client_errno(aClient)));
     }
+    else
+    {
+        groupPtr = EntryGroupPtr(group, ReleaseGroup);
+    }
+
+    return groupPtr;
+}
+
+PublisherAvahi::EntryGroupPtr PublisherAvahi::AcquireGroup(bool aGrouped)
+{
+    EntryGroupPtr group;
+
+    if (aGrouped && !mOpenGroups.empty())
+    {
+        if (mOpenGroups.back() == nullptr)
+        {
+            mOpenGroups.back() = CreateGroup(mClient);
+        }
+        group = mOpenGroups.back();
+    }
+    else
+    {
+        group = CreateGroup(mClient);
+    }
 
     return group;
 }
@@ -647,6 +741,202 @@ void PublisherAvahi::ReleaseGroup(AvahiEntryGroup *aGroup)
     }
 }
 
+otbrError PublisherAvahi::CommitGroup(AvahiEntryGroup *aGroup)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       avahiError = avahi_entry_group_commit(aGroup);
+
+    if (avahiError != AVAHI_OK)
+    {
+        otbrLogErr("Failed to commit avahi group (@%p): %s!", aGroup, avahi_strerror(avahiError));
+        error = OTBR_ERROR_MDNS;
+    }
+
+    return error;
+}
+
+bool PublisherAvahi::IsOpenGroup(const AvahiEntryGroup *aGroup) const
+{
+    bool isOpen = false;
+
+    for (const EntryGroupPtr &group : mOpenGroups)
+    {
+        if (group.get() == aGroup)
+        {
+            isOpen = true;
+            break;
+        }
+    }
+
+    return isOpen;
+}
+
+void PublisherAvahi::LeaveGroup(EntryGroupPtr &aGroup)
+{
+    AvahiEntryGroup *group  = aGroup.get();
+    bool             shared = aGroup.use_count() > 1;
+
+    // Releases the group if this is its last registration.
+    aGroup = nullptr;
+
+    // Avahi can only reset a whole group, so the records of the other registrations of a
+    // shared group are added again without the records of the leaving registration.
+    VerifyOrExit(shared && !mClearingRegistrations);
+    RebuildGroup(group);
+
+exit:
+    return;
+}
+
+void PublisherAvahi::RebuildGroup(AvahiEntryGroup *aGroup)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       avahiError = avahi_entry_group_reset(aGroup);
+    bool      hasEntries = false;
+
+    otbrLogInfo("Rebuilding avahi entry group @%p", aGroup);
+    VerifyOrExit(avahiError == AVAHI_OK, error = OTBR_ERROR_MDNS);
+
+    for (const auto &entry : mServiceRegistrations)
+    {
+        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*entry.second);
+
+        if (serviceReg.GetEntryGroup() == aGroup)
+        {
+            SuccessOrExit(error = AddServiceEntries(aGroup, serviceReg.mHostName, serviceReg.mName, serviceReg.mType,
+                                                    serviceReg.mSubTypeList, serviceReg.mPort, serviceReg.mTxtData));
+            hasEntries = true;
+        }
+    }
+    for (const auto &entry : mHostRegistrations)
+    {
+        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*entry.second);
+
+        if (hostReg.GetEntryGroup() == aGroup)
+        {
+            SuccessOrExit(error = AddHostEntries(aGroup, hostReg.mName, hostReg.mAddresses));
+            hasEntries = true;
+        }
+    }
+    for (const auto &entry : mKeyRegistrations)
+    {
+        const auto &keyReg = static_cast<const AvahiKeyRegistration &>(*entry.second);
+
+        if (keyReg.GetEntryGroup() == aGroup)
+        {
+            SuccessOrExit(error = AddKeyEntries(aGroup, keyReg.mName, keyReg.mKeyData));
+            hasEntries = true;
+        }
+    }
+
+    // An open group is committed when its publish group ends.
+    VerifyOrExit(hasEntries && !IsOpenGroup(aGroup));
+    error = CommitGroup(aGroup);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        if (avahiError != AVAHI_OK)
+        {
+            otbrLogErr("Failed to reset entry group for avahi error: %s", avahi_strerror(avahiError));
+        }
+        FailGroup(aGroup, error);
+    }
+}
+
+void PublisherAvahi::FailGroup(AvahiEntryGroup *aGroup, otbrError aError)
+{
+    std::vector<std::pair<std::string, std::string>> serviceNames;
+    std::vector<std::string>                         hostNames;
+    std::vector<std::string>                         keyNames;
+
+    if (IsOpenGroup(aGroup))
+    {
+        // Drops the records which are added so far, the group stays open for the rest of the batch.
+        avahi_entry_group_reset(aGroup);
+    }
+
+    // The registrations are detached before they are removed, so that removing one doesn't
+    // rebuild the group for the others. The last one releases the group.
+    for (const auto &entry : mServiceRegistrations)
+    {
+        auto &serviceReg = static_cast<AvahiServiceRegistration &>(*entry.second);
+
+        if (serviceReg.GetEntryGroup() == aGroup)
+        {
+            serviceNames.emplace_back(serviceReg.mName, serviceReg.mType);
+            serviceReg.DetachEntryGroup();
+        }
+    }
+    for (const auto &entry : mHostRegistrations)
+    {
+        auto &hostReg = static_cast<AvahiHostRegistration &>(*entry.second);
+
+        if (hostReg.GetEntryGroup() == aGroup)
+        {
+            hostNames.push_back(hostReg.mName);
+            hostReg.DetachEntryGroup();
+        }
+    }
+    for (const auto &entry : mKeyRegistrations)
+    {
+        auto &keyReg = static_cast<AvahiKeyRegistration &>(*entry.second);
+
+        if (keyReg.GetEntryGroup() == aGroup)
+        {
+            keyNames.push_back(keyReg.mName);
+            keyReg.DetachEntryGroup();
+        }
+    }
+
+    for (const auto &serviceName : serviceNames)
+    {
+        RemoveServiceRegistration(serviceName.first, serviceName.second, aError);
+    }
+    for (const std::string &hostName : hostNames)
+    {
+        RemoveHostRegistration(hostName, aError);
+    }
+    for (const std::string &keyName : keyNames)
+    {
+        RemoveKeyRegistration(keyName, aError);
+    }
+}
+
+void PublisherAvahi::ClearRegistrations(void)
+{
+    // The groups are released as a whole, without rebuilding the shared ones.
+    mClearingRegistrations = true;
+    mServiceRegistrations.clear();
+    mHostRegistrations.clear();
+    mKeyRegistrations.clear();
+    mClearingRegistrations = false;
+}
+
+void PublisherAvahi::BeginPublishGroup(void)
+{
+    mOpenGroups.emplace_back();
+}
+
+void PublisherAvahi::EndPublishGroup(void)
+{
+    EntryGroupPtr group = std::move(mOpenGroups.back());
+
+    mOpenGroups.pop_back();
+
+    // The group is also owned by the registrations of its records, if any of them succeeded.
+    VerifyOrExit(group != nullptr && group.use_count() > 1);
+
+    otbrLogInfo("Commit avahi group @%p of %ld registrations", group.get(), group.use_count() - 1);
+    if (CommitGroup(group.get()) != OTBR_ERROR_NONE)
+    {
+        FailGroup(group.get(), OTBR_ERROR_MDNS);
+    }
+
+exit:
+    return;
+}
+
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState)
 {
     otbrLogInfo("Avahi client state changed to %d", aState);
@@ -682,8 +972,7 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
         // The server records are now being established. This might be
         // caused by a host name change. We need to wait for our own
         // records to register until the host name is properly established.
-        mServiceRegistrations.clear();
-        mHostRegistrations.clear();
+        ClearRegistrations();
         break;
 
     case AVAHI_CLIENT_CONNECTING:
@@ -700,25 +989,15 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
                                              const TxtData     &aTxtData,
                                              ResultCallback   &&aCallback)
 {
-    otbrError         error             = OTBR_ERROR_NONE;
-    int               avahiError        = AVAHI_OK;
-    SubTypeList       sortedSubTypeList = SortSubTypeList(aSubTypeList);
-    const std::string logHostName       = !aHostName.empty() ? aHostName : "localhost";
-    std::string       fullHostName;
-    std::string       serviceName = aName;
-    AvahiEntryGroup  *group       = nullptr;
-
-    // Aligned with AvahiStringList
-    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
-    AvahiStringList *txtHead = nullptr;
+    otbrError     error             = OTBR_ERROR_NONE;
+    bool          grouped           = TakePublishGroup();
+    SubTypeList   sortedSubTypeList = SortSubTypeList(aSubTypeList);
+    std::string   serviceName       = aName;
+    EntryGroupPtr group;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
 
-    if (!aHostName.empty())
-    {
-        fullHostName = MakeFullHostName(aHostName);
-    }
     if (serviceName.empty())
     {
         serviceName = avahi_client_get_host_name(mClient);
@@ -728,49 +1007,82 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
                                                    std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
 
+    VerifyOrExit((group = AcquireGroup(grouped)) != nullptr, error = OTBR_ERROR_MDNS);
+    SuccessOrExit(error = AddServiceEntries(group.get(), aHostName, serviceName, aType, aSubTypeList, aPort, aTxtData));
+
+    if (!grouped)
+    {
+        otbrLogInfo("Commit avahi service %s.%s", serviceName.c_str(), aType.c_str());
+        SuccessOrExit(error = CommitGroup(group.get()));
+    }
+
+    AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(new AvahiServiceRegistration(
+        aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData, std::move(aCallback), group, this)));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        if (grouped && group != nullptr)
+        {
+            // Removes the records of this service which are already added to the shared group.
+            RebuildGroup(group.get());
+        }
+        std::move(aCallback)(error);
+    }
+    return error;
+}
+
+otbrError PublisherAvahi::AddServiceEntries(AvahiEntryGroup   *aGroup,
+                                            const std::string &aHostName,
+                                            const std::string &aName,
+                                            const std::string &aType,
+                                            const SubTypeList &aSubTypeList,
+                                            uint16_t           aPort,
+                                            const TxtData     &aTxtData)
+{
+    otbrError         error       = OTBR_ERROR_NONE;
+    int               avahiError  = AVAHI_OK;
+    const std::string logHostName = !aHostName.empty() ? aHostName : "localhost";
+    std::string       fullHostName;
+
+    // Aligned with AvahiStringList
+    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    if (!aHostName.empty())
+    {
+        fullHostName = MakeFullHostName(aHostName);
+    }
+
     SuccessOrExit(error = TxtDataToAvahiStringList(aTxtData, txtBuffer, sizeof(txtBuffer), txtHead));
-    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
-    avahiError = avahi_entry_group_add_service_strlst(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
-                                                      serviceName.c_str(), aType.c_str(),
+    avahiError = avahi_entry_group_add_service_strlst(aGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
+                                                      aName.c_str(), aType.c_str(),
                                                       /* domain */ nullptr, fullHostName.c_str(), aPort, txtHead);
     VerifyOrExit(avahiError == AVAHI_OK);
 
     for (const std::string &subType : aSubTypeList)
     {
-        otbrLogInfo("Add subtype %s for service %s.%s", subType.c_str(), serviceName.c_str(), aType.c_str());
+        otbrLogInfo("Add subtype %s for service %s.%s", subType.c_str(), aName.c_str(), aType.c_str());
         std::string fullSubType = subType + "._sub." + aType;
-        avahiError              = avahi_entry_group_add_service_subtype(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
-                                                                        AvahiPublishFlags{}, serviceName.c_str(), aType.c_str(),
+        avahiError              = avahi_entry_group_add_service_subtype(aGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+                                                                        AvahiPublishFlags{}, aName.c_str(), aType.c_str(),
                                                                         /* domain */ nullptr, fullSubType.c_str());
         VerifyOrExit(avahiError == AVAHI_OK);
     }
 
-    otbrLogInfo("Commit avahi service %s.%s", serviceName.c_str(), aType.c_str());
-    avahiError = avahi_entry_group_commit(group);
-    VerifyOrExit(avahiError == AVAHI_OK);
-
-    AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(new AvahiServiceRegistration(
-        aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData, std::move(aCallback), group, this)));
-
 exit:
-    if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
+    if (avahiError != AVAHI_OK)
     {
-        if (avahiError != AVAHI_OK)
-        {
-            error = OTBR_ERROR_MDNS;
-            otbrLogErr("Failed to publish service for avahi error: %s!", avahi_strerror(avahiError));
-        }
-
-        if (group != nullptr)
-        {
-            ReleaseGroup(group);
-        }
-        std::move(aCallback)(error);
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to publish service %s.%s on %s for avahi error: %s!", aName.c_str(), aType.c_str(),
+                   logHostName.c_str(), avahi_strerror(avahiError));
     }
     return error;
 }
 
-void PublisherAvahi::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+void PublisherAvahi::UnpublishServiceImpl(const std::string &aName,
+                                          const std::string &aType,
+                                          ResultCallback   &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -785,10 +1097,9 @@ otbrError PublisherAvahi::PublishHostImpl(const std::string &aName,
                                           const AddressList &aAddresses,
                                           ResultCallback   &&aCallback)
 {
-    otbrError        error      = OTBR_ERROR_NONE;
-    int              avahiError = AVAHI_OK;
-    std::string      fullHostName;
-    AvahiEntryGroup *group = nullptr;
+    otbrError     error   = OTBR_ERROR_NONE;
+    bool          grouped = TakePublishGroup();
+    EntryGroupPtr group;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
@@ -797,46 +1108,60 @@ otbrError PublisherAvahi::PublishHostImpl(const std::string &aName,
     VerifyOrExit(!aCallback.IsNull());
     VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
 
-    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
+    VerifyOrExit((group = AcquireGroup(grouped)) != nullptr, error = OTBR_ERROR_MDNS);
+    SuccessOrExit(error = AddHostEntries(group.get(), aName, aAddresses));
 
-    fullHostName = MakeFullHostName(aName);
-    for (const auto &address : aAddresses)
+    if (!grouped)
     {
-        AvahiAddress avahiAddress;
-
-        avahiAddress.proto = AVAHI_PROTO_INET6;
-        memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(address.m8));
-        avahiError = avahi_entry_group_add_address(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_NO_REVERSE,
-                                                   fullHostName.c_str(), &avahiAddress);
-        VerifyOrExit(avahiError == AVAHI_OK);
+        otbrLogInfo("Commit avahi host %s", aName.c_str());
+        SuccessOrExit(error = CommitGroup(group.get()));
     }
 
-    otbrLogInfo("Commit avahi host %s", aName.c_str());
-    avahiError = avahi_entry_group_commit(group);
-    VerifyOrExit(avahiError == AVAHI_OK);
-
     AddHostRegistration(std::unique_ptr<AvahiHostRegistration>(
         new AvahiHostRegistration(aName, aAddresses, std::move(aCallback), group, this)));
 
 exit:
-    if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
+    if (error != OTBR_ERROR_NONE)
     {
-        if (avahiError != AVAHI_OK)
+        if (grouped && group != nullptr)
         {
-            error = OTBR_ERROR_MDNS;
-            otbrLogErr("Failed to publish host for avahi error: %s!", avahi_strerror(avahiError));
-        }
-
-        if (group != nullptr)
-        {
-            ReleaseGroup(group);
+            // Removes the records of this host which are already added to the shared group.
+            RebuildGroup(group.get());
         }
         std::move(aCallback)(error);
     }
     return error;
 }
 
-void PublisherAvahi::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+otbrError PublisherAvahi::AddHostEntries(AvahiEntryGroup   *aGroup,
+                                         const std::string &aName,
+                                         const AddressList &aAddresses)
+{
+    otbrError   error        = OTBR_ERROR_NONE;
+    int         avahiError   = AVAHI_OK;
+    std::string fullHostName = MakeFullHostName(aName);
+
+    for (const auto &address : aAddresses)
+    {
+        AvahiAddress avahiAddress;
+
+        avahiAddress.proto = AVAHI_PROTO_INET6;
+        memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(address.m8));
+        avahiError = avahi_entry_group_add_address(aGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+                                                   AVAHI_PUBLISH_NO_REVERSE, fullHostName.c_str(), &avahiAddress);
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to publish host %s for avahi error: %s!", aName.c_str(), avahi_strerror(avahiError));
+    }
+    return error;
+}
+
+void PublisherAvahi::UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -849,10 +1174,9 @@ exit:
 
 otbrError PublisherAvahi::PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
 {
-    otbrError        error      = OTBR_ERROR_NONE;
-    int              avahiError = AVAHI_OK;
-    std::string      fullKeyName;
-    AvahiEntryGroup *group = nullptr;
+    otbrError     error   = OTBR_ERROR_NONE;
+    bool          grouped = TakePublishGroup();
+    EntryGroupPtr group;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
@@ -860,41 +1184,50 @@ otbrError PublisherAvahi::PublishKeyImpl(const std::string &aName, const KeyData
     aCallback = HandleDuplicateKeyRegistration(aName, aKeyData, std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
 
-    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
-
-    fullKeyName = MakeFullKeyName(aName);
-
-    avahiError = avahi_entry_group_add_record(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_UNIQUE,
-                                              fullKeyName.c_str(), AVAHI_DNS_CLASS_IN, kDnsKeyRecordType, kDefaultTtl,
-                                              aKeyData.data(), aKeyData.size());
-    VerifyOrExit(avahiError == AVAHI_OK);
+    VerifyOrExit((group = AcquireGroup(grouped)) != nullptr, error = OTBR_ERROR_MDNS);
+    SuccessOrExit(error = AddKeyEntries(group.get(), aName, aKeyData));
 
-    otbrLogInfo("Commit avahi key record for %s", aName.c_str());
-    avahiError = avahi_entry_group_commit(group);
-    VerifyOrExit(avahiError == AVAHI_OK);
+    if (!grouped)
+    {
+        otbrLogInfo("Commit avahi key record for %s", aName.c_str());
+        SuccessOrExit(error = CommitGroup(group.get()));
+    }
 
     AddKeyRegistration(std::unique_ptr<AvahiKeyRegistration>(
         new AvahiKeyRegistration(aName, aKeyData, std::move(aCallback), group, this)));
 
 exit:
-    if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
+    if (error != OTBR_ERROR_NONE)
     {
-        if (avahiError != AVAHI_OK)
-        {
-            error = OTBR_ERROR_MDNS;
-            otbrLogErr("Failed to publish key record - avahi error: %s!", avahi_strerror(avahiError));
-        }
-
-        if (group != nullptr)
+        if (grouped && group != nullptr)
         {
-            ReleaseGroup(group);
+            // Removes the key record which may be already added to the shared group.
+            RebuildGroup(group.get());
         }
         std::move(aCallback)(error);
     }
     return error;
 }
 
-void PublisherAvahi::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+otbrError PublisherAvahi::AddKeyEntries(AvahiEntryGroup *aGroup, const std::string &aName, const KeyData &aKeyData)
+{
+    otbrError   error       = OTBR_ERROR_NONE;
+    std::string fullKeyName = MakeFullKeyName(aName);
+    int         avahiError;
+
+    avahiError = avahi_entry_group_add_record(aGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_UNIQUE,
+                                              fullKeyName.c_str(), AVAHI_DNS_CLASS_IN, kDnsKeyRecordType, kDefaultTtl,
+                                              aKeyData.data(), aKeyData.size());
+    if (avahiError != AVAHI_OK)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to publish key record - avahi error: %s!", avahi_strerror(avahiError));
+    }
+
+    return error;
+}
+
+void PublisherAvahi::UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -952,62 +1285,12 @@ exit:
     return error;
 }
 
-Publisher::ServiceRegistration *PublisherAvahi::FindServiceRegistration(const AvahiEntryGroup *aEntryGroup)
-{
-    ServiceRegistration *result = nullptr;
-
-    for (const auto &kv : mServiceRegistrations)
-    {
-        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
-        if (serviceReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
-
-Publisher::HostRegistration *PublisherAvahi::FindHostRegistration(const AvahiEntryGroup *aEntryGroup)
-{
-    HostRegistration *result = nullptr;
-
-    for (const auto &kv : mHostRegistrations)
-    {
-        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
-        if (hostReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
-
-Publisher::KeyRegistration *PublisherAvahi::FindKeyRegistration(const AvahiEntryGroup *aEntryGroup)
+otbrError PublisherAvahi::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
-    KeyRegistration *result = nullptr;
-
-    for (const auto &entry : mKeyRegistrations)
-    {
-        const auto &keyReg = static_cast<const AvahiKeyRegistration &>(*entry.second);
-        if (keyReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = entry.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
+    otbrError error   = OTBR_ERROR_NONE;
+    auto      service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
 
-void PublisherAvahi::SubscribeService(const std::string &aType, const std::string &aInstanceName)
-{
-    auto service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
-
-    VerifyOrExit(mState == Publisher::State::kReady);
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedServices.push_back(std::move(service));
 
     otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
@@ -1023,10 +1306,10 @@ void PublisherAvahi::SubscribeService(const std::string &aType, const std::strin
     }
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherAvahi::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -1070,11 +1353,12 @@ otbrError PublisherAvahi::DnsErrorToOtbrError(int32_t aErrorCode)
     return otbr::Mdns::DnsErrorToOtbrError(aErrorCode);
 }
 
-void PublisherAvahi::SubscribeHost(const std::string &aHostName)
+otbrError PublisherAvahi::SubscribeHostImpl(const std::string &aHostName)
 {
-    auto host = MakeUnique<HostSubscription>(*this, aHostName);
+    otbrError error = OTBR_ERROR_NONE;
+    auto      host  = MakeUnique<HostSubscription>(*this, aHostName);
 
-    VerifyOrExit(mState == Publisher::State::kReady);
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
 
     mSubscribedHosts.push_back(std::move(host));
 
@@ -1083,10 +1367,10 @@ void PublisherAvahi::SubscribeHost(const std::string &aHostName)
     mSubscribedHosts.back()->Resolve();
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherAvahi::UnsubscribeHost(const std::string &aHostName)
+void PublisherAvahi::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList::iterator it;
 
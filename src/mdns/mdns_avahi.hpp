@@ -75,13 +75,6 @@ public:
     PublisherAvahi(StateCallback aStateCallback);
     ~PublisherAvahi(void) override;
 
-    void      UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
-    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-    void      UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
-    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      SubscribeHost(const std::string &aHostName) override;
-    void      UnsubscribeHost(const std::string &aHostName) override;
     otbrError Start(void) override;
     bool      IsStarted(void) const override;
     void      Stop(void) override;
@@ -98,17 +91,33 @@ protected:
                               const AddressList &aAddresses,
                               ResultCallback   &&aCallback) override;
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      UnpublishServiceImpl(const std::string &aName,
+                                   const std::string &aType,
+                                   ResultCallback   &&aCallback) override;
+    void      UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    otbrError SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
     void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
     otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+    void      BeginPublishGroup(void) override;
+    void      EndPublishGroup(void) override;
 
 private:
     static constexpr size_t   kMaxSizeOfTxtRecord = 1024;
     static constexpr uint32_t kDefaultTtl         = 10; // In seconds.
     static constexpr uint16_t kDnsKeyRecordType   = 25;
 
+    // An entry group may be shared by the registrations of the records of one name, i.e. a host
+    // or a service instance and its key, which are published together in a batch. The group is
+    // released with its last registration.
+    using EntryGroupPtr = std::shared_ptr<AvahiEntryGroup>;
+
     class AvahiServiceRegistration : public ServiceRegistration
     {
     public:
@@ -119,7 +128,7 @@ private:
                                  uint16_t           aPort,
                                  const TxtData     &aTxtData,
                                  ResultCallback   &&aCallback,
-                                 AvahiEntryGroup   *aEntryGroup,
+                                 EntryGroupPtr      aEntryGroup,
                                  PublisherAvahi    *aPublisher)
             : ServiceRegistration(aHostName,
                                   aName,
@@ -129,15 +138,16 @@ private:
                                   aTxtData,
                                   std::move(aCallback),
                                   aPublisher)
-            , mEntryGroup(aEntryGroup)
+            , mEntryGroup(std::move(aEntryGroup))
         {
         }
 
         ~AvahiServiceRegistration(void) override;
-        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup.get(); }
+        void                   DetachEntryGroup(void) { mEntryGroup = nullptr; }
 
     private:
-        AvahiEntryGroup *mEntryGroup;
+        EntryGroupPtr mEntryGroup;
     };
 
     class AvahiHostRegistration : public HostRegistration
@@ -146,18 +156,19 @@ private:
         AvahiHostRegistration(const std::string &aName,
                               const AddressList &aAddresses,
                               ResultCallback   &&aCallback,
-                              AvahiEntryGroup   *aEntryGroup,
+                              EntryGroupPtr      aEntryGroup,
                               PublisherAvahi    *aPublisher)
             : HostRegistration(aName, aAddresses, std::move(aCallback), aPublisher)
-            , mEntryGroup(aEntryGroup)
+            , mEntryGroup(std::move(aEntryGroup))
         {
         }
 
         ~AvahiHostRegistration(void) override;
-        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup.get(); }
+        void                   DetachEntryGroup(void) { mEntryGroup = nullptr; }
 
     private:
-        AvahiEntryGroup *mEntryGroup;
+        EntryGroupPtr mEntryGroup;
     };
 
     class AvahiKeyRegistration : public KeyRegistration
@@ -166,18 +177,19 @@ private:
         AvahiKeyRegistration(const std::string &aName,
                              const KeyData     &aKeyData,
                              ResultCallback   &&aCallback,
-                             AvahiEntryGroup   *aEntryGroup,
+                             EntryGroupPtr      aEntryGroup,
                              PublisherAvahi    *aPublisher)
             : KeyRegistration(aName, aKeyData, std::move(aCallback), aPublisher)
-            , mEntryGroup(aEntryGroup)
+            , mEntryGroup(std::move(aEntryGroup))
         {
         }
 
         ~AvahiKeyRegistration(void) override;
-        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup.get(); }
+        void                   DetachEntryGroup(void) { mEntryGroup = nullptr; }
 
     private:
-        AvahiEntryGroup *mEntryGroup;
+        EntryGroupPtr mEntryGroup;
     };
 
     struct Subscription : private ::NonCopyable
@@ -355,8 +367,25 @@ private:
     static void HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext);
     void        HandleClientState(AvahiClient *aClient, AvahiClientState aState);
 
-    AvahiEntryGroup *CreateGroup(AvahiClient *aClient);
+    EntryGroupPtr    CreateGroup(AvahiClient *aClient);
+    EntryGroupPtr    AcquireGroup(bool aGrouped);
     static void      ReleaseGroup(AvahiEntryGroup *aGroup);
+    static otbrError CommitGroup(AvahiEntryGroup *aGroup);
+    bool             IsOpenGroup(const AvahiEntryGroup *aGroup) const;
+    void             LeaveGroup(EntryGroupPtr &aGroup);
+    void             RebuildGroup(AvahiEntryGroup *aGroup);
+    void             FailGroup(AvahiEntryGroup *aGroup, otbrError aError);
+    void             ClearRegistrations(void);
+
+    otbrError AddServiceEntries(AvahiEntryGroup   *aGroup,
+                                const std::string &aHostName,
+                                const std::string &aName,
+                                const std::string &aType,
+                                const SubTypeList &aSubTypeList,
+                                uint16_t           aPort,
+                                const TxtData     &aTxtData);
+    otbrError AddHostEntries(AvahiEntryGroup *aGroup, const std::string &aName, const AddressList &aAddresses);
+    otbrError AddKeyEntries(AvahiEntryGroup *aGroup, const std::string &aName, const KeyData &aKeyData);
 
     static void HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState, void *aContext);
     void        HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState);
@@ -367,10 +396,6 @@ private:
                                               size_t            aBufferSize,
                                               AvahiStringList *&aHead);
 
-    ServiceRegistration *FindServiceRegistration(const AvahiEntryGroup *aEntryGroup);
-    HostRegistration    *FindHostRegistration(const AvahiEntryGroup *aEntryGroup);
-    KeyRegistration     *FindKeyRegistration(const AvahiEntryGroup *aEntryGroup);
-
     AvahiClient                 *mClient;
     std::unique_ptr<AvahiPoller> mPoller;
     State                        mState;
@@ -378,6 +403,10 @@ private:
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
+
+    // The groups of the ongoing publish groups, innermost last. A group is created with its first record.
+    std::vector<EntryGroupPtr> mOpenGroups;
+    bool                       mClearingRegistrations;
 };
 
 } // namespace Mdns
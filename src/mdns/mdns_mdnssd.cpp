@@ -49,6 +49,7 @@
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/time.hpp"
 
 namespace otbr {
@@ -215,8 +216,10 @@ static const char *DNSErrorToString(DNSServiceErrorType aError)
 
 PublisherMDnsSd::PublisherMDnsSd(StateCallback aCallback)
     : mHostsRef(nullptr)
+    , mConnectionLost(false)
     , mState(State::kIdle)
     , mStateCallback(std::move(aCallback))
+    , mPollGeneration(0)
 {
 }
 
@@ -247,12 +250,21 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
     // list so that `DnssdHostRegisteration` destructor gets the chance
     // to update registered records if needed.
 
+    // When the connection is shared, deallocating `mHostsRef` also frees
+    // all the other `ServiceRef`. On a normal stop it's deallocated last.
+    // On `kDNSServiceErr_ServiceNotRunning` the connection is dead, so all
+    // `ServiceRef` are freed with it first and `mConnectionLost` tells the
+    // registrations and subscriptions not to deallocate or update them.
+
     switch (aStopMode)
     {
     case kNormalStop:
         break;
 
     case kStopOnServiceNotRunningError:
+#if OTBR_ENABLE_MDNS_SHARE_CONNECTION
+        mConnectionLost = true;
+#endif
         DeallocateHostsRef();
         break;
     }
@@ -260,12 +272,17 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
     mKeyRegistrations.clear();
-    DeallocateHostsRef();
 
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
+    ClearSubscriptions();
+
+    DeallocateHostsRef();
+
+    mConnectionLost = false;
+    mState          = State::kIdle;
 
-    mState = State::kIdle;
+    AbortPendingUpdates();
 
 exit:
     return;
@@ -279,6 +296,7 @@ DNSServiceErrorType PublisherMDnsSd::CreateSharedHostsRef(void)
 
     dnsError = DNSServiceCreateConnection(&mHostsRef);
     otbrLogDebug("Created new shared DNSServiceRef: %p", mHostsRef);
+    HandleServiceRefCreated(mHostsRef, dnsError);
 
 exit:
     return dnsError;
@@ -299,142 +317,133 @@ exit:
 
 void PublisherMDnsSd::Update(MainloopContext &aMainloop)
 {
-    for (auto &kv : mServiceRegistrations)
-    {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
+    OTBR_UNUSED_VARIABLE(aMainloop);
 
-        serviceReg.Update(aMainloop);
-    }
+    // The sockets of all `DNSServiceRef` are registered to the `MainloopManager`
+    // when they are created, we only need to start a new poll generation here.
+    mPollGeneration++;
+}
 
-    if (mHostsRef != nullptr)
-    {
-        int fd = DNSServiceRefSockFD(mHostsRef);
+void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+}
 
-        assert(fd != -1);
+DNSServiceErrorType PublisherMDnsSd::PrepareServiceRef(DNSServiceRef &aServiceRef, DNSServiceFlags &aFlags)
+{
+    DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
 
-        aMainloop.AddFdToReadSet(fd);
-    }
+#if OTBR_ENABLE_MDNS_SHARE_CONNECTION
+    // A `DNSServiceRef` sharing a connection is initialized with the
+    // `DNSServiceRef` of the connection, which is `mHostsRef`.
+    dnsError = CreateSharedHostsRef();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
-    for (const auto &service : mSubscribedServices)
-    {
-        service->UpdateAll(aMainloop);
-    }
+    aServiceRef = mHostsRef;
+    aFlags |= kDNSServiceFlagsShareConnection;
 
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Update(aMainloop);
-    }
+exit:
+#else
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aFlags);
+#endif
+    return dnsError;
 }
 
-void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
+void PublisherMDnsSd::HandleServiceRefCreated(DNSServiceRef &aServiceRef, DNSServiceErrorType aError)
 {
-    mServiceRefsToProcess.clear();
-
-    for (auto &kv : mServiceRegistrations)
+    if (aError == kDNSServiceErr_NoError)
     {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        serviceReg.Process(aMainloop, mServiceRefsToProcess);
+        HandleServiceRefAllocated(aServiceRef);
     }
-
-    if (mHostsRef != nullptr)
+    else
     {
-        int fd = DNSServiceRefSockFD(mHostsRef);
-
-        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
-        {
-            mServiceRefsToProcess.push_back(mHostsRef);
-        }
+        // Nothing is allocated on failure, but `aServiceRef` may still
+        // hold the `DNSServiceRef` of the shared connection.
+        aServiceRef = nullptr;
     }
+}
 
-    for (const auto &service : mSubscribedServices)
-    {
-        service->ProcessAll(aMainloop, mServiceRefsToProcess);
-    }
+void PublisherMDnsSd::HandleServiceRefAllocated(DNSServiceRef aServiceRef)
+{
+    int       fd;
+    otbrError error;
 
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Process(aMainloop, mServiceRefsToProcess);
-    }
+#if OTBR_ENABLE_MDNS_SHARE_CONNECTION
+    // Only the shared connection owns a socket, the results of other
+    // `DNSServiceRef` are delivered when it's processed.
+    VerifyOrExit(aServiceRef == mHostsRef);
+#endif
 
-    for (DNSServiceRef serviceRef : mServiceRefsToProcess)
-    {
-        DNSServiceErrorType error;
-
-        // As we go through the list of `mServiceRefsToProcess` the call
-        // to `DNSServiceProcessResult()` can itself invoke callbacks
-        // into `PublisherMDnsSd` and OT, which in turn, may change the
-        // state of `Publisher` and potentially trigger a previously
-        // valid `ServiceRef` in the list to be deallocated. We use
-        // `HandleServiceRefDeallocating()` which is called whenever a
-        // `ServiceRef` is being deallocated and from this we update
-        // the entry in `mServiceRefsToProcess` list to `nullptr` so to
-        // avoid calling `DNSServiceProcessResult()` on an already
-        // freed `ServiceRef`.
-
-        if (serviceRef == nullptr)
-        {
-            continue;
-        }
+    fd = DNSServiceRefSockFD(aServiceRef);
+    VerifyOrExit(fd != -1);
 
-        error = DNSServiceProcessResult(serviceRef);
+    mServiceRefs[fd] = ServiceRefEntry{aServiceRef, mPollGeneration};
 
-        if (error != kDNSServiceErr_NoError)
-        {
-            otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
-            otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
-                    DNSErrorToString(error), serviceRef);
-        }
-        if (error == kDNSServiceErr_ServiceNotRunning)
-        {
-            otbrLogWarning("Need to reconnect to mdnsd");
-            Stop(kStopOnServiceNotRunningError);
-            Start();
-            ExitNow();
-        }
+    error = MainloopManager::GetInstance().AddFd(fd, MainloopContext::kReadFdSet,
+                                                 [this, fd](uint8_t) { HandleServiceRefReadable(fd); });
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to watch DNSServiceRef %p (fd = %d): %s", aServiceRef, fd, otbrErrorString(error));
     }
+
 exit:
     return;
 }
 
 void PublisherMDnsSd::HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef)
 {
-    for (DNSServiceRef &entry : mServiceRefsToProcess)
-    {
-        if (entry == aServiceRef)
-        {
-            entry = nullptr;
-        }
-    }
-}
+    int                                                fd;
+    std::unordered_map<int, ServiceRefEntry>::iterator it;
 
-void PublisherMDnsSd::DnssdServiceRegistration::Update(MainloopContext &aMainloop) const
-{
-    int fd;
-
-    VerifyOrExit(mServiceRef != nullptr);
+#if OTBR_ENABLE_MDNS_SHARE_CONNECTION
+    VerifyOrExit(aServiceRef == mHostsRef);
+#endif
 
-    fd = DNSServiceRefSockFD(mServiceRef);
+    fd = DNSServiceRefSockFD(aServiceRef);
     VerifyOrExit(fd != -1);
 
-    aMainloop.AddFdToReadSet(fd);
+    it = mServiceRefs.find(fd);
+    VerifyOrExit(it != mServiceRefs.end() && it->second.mServiceRef == aServiceRef);
+
+    MainloopManager::GetInstance().RemoveFd(fd);
+    mServiceRefs.erase(it);
 
 exit:
     return;
 }
 
-void PublisherMDnsSd::DnssdServiceRegistration::Process(const MainloopContext      &aMainloop,
-                                                        std::vector<DNSServiceRef> &aReadyServices) const
+void PublisherMDnsSd::HandleServiceRefReadable(int aFd)
 {
-    int fd;
+    auto                it = mServiceRefs.find(aFd);
+    DNSServiceRef       serviceRef;
+    DNSServiceErrorType error;
 
-    VerifyOrExit(mServiceRef != nullptr);
+    VerifyOrExit(it != mServiceRefs.end());
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
+    // A `DNSServiceRef` created after the poll may have reused the fd of a
+    // `DNSServiceRef` deallocated by a previous callback, the readiness
+    // belongs to the old one and `DNSServiceProcessResult()` would block.
+    VerifyOrExit(it->second.mPollGeneration != mPollGeneration);
+
+    // The call to `DNSServiceProcessResult()` can itself invoke callbacks
+    // into `PublisherMDnsSd` and OT, which may deallocate `serviceRef`
+    // and invalidate `it`, so neither is accessed afterwards.
+    serviceRef = it->second.mServiceRef;
+    error      = DNSServiceProcessResult(serviceRef);
 
-    VerifyOrExit(FD_ISSET(fd, &aMainloop.mReadFdSet));
-    aReadyServices.push_back(mServiceRef);
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
+        otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
+                DNSErrorToString(error), serviceRef);
+    }
+    if (error == kDNSServiceErr_ServiceNotRunning)
+    {
+        otbrLogWarning("Need to reconnect to mdnsd");
+        Stop(kStopOnServiceNotRunningError);
+        Start();
+    }
 
 exit:
     return;
@@ -447,6 +456,7 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
     const char           *hostNameCString    = nullptr;
     const char           *serviceNameCString = nullptr;
     DnssdKeyRegistration *keyReg;
+    DNSServiceFlags       flags = kDNSServiceFlagsNoAutoRename;
     DNSServiceErrorType   dnsError;
 
     if (!mHostName.empty())
@@ -471,10 +481,17 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
 
     VerifyOrExit(GetPublisher().IsStarted(), dnsError = kDNSServiceErr_ServiceNotRunning);
 
-    dnsError = DNSServiceRegister(&mServiceRef, kDNSServiceFlagsNoAutoRename, kDNSServiceInterfaceIndexAny,
-                                  serviceNameCString, regType.c_str(),
-                                  /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(), mTxtData.data(),
-                                  HandleRegisterResult, this);
+    dnsError = GetPublisher().PrepareServiceRef(mServiceRef, flags);
+
+    if (dnsError == kDNSServiceErr_NoError)
+    {
+        dnsError = DNSServiceRegister(&mServiceRef, flags, kDNSServiceInterfaceIndexAny, serviceNameCString,
+                                      regType.c_str(),
+                                      /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(),
+                                      mTxtData.data(), HandleRegisterResult, this);
+    }
+
+    GetPublisher().HandleServiceRefCreated(mServiceRef, dnsError);
 
     if (dnsError != kDNSServiceErr_NoError)
     {
@@ -510,6 +527,10 @@ void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
         keyReg->Unregister();
     }
 
+    // The `mServiceRef` has been freed with the lost shared connection,
+    // and the key can't be registered again on it.
+    VerifyOrExit(!GetPublisher().mConnectionLost, mServiceRef = nullptr);
+
     GetPublisher().HandleServiceRefDeallocating(mServiceRef);
     DNSServiceRefDeallocate(mServiceRef);
     mServiceRef = nullptr;
@@ -554,6 +575,7 @@ void PublisherMDnsSd::DnssdServiceRegistration::HandleRegisterResult(DNSServiceF
     else
     {
         otbrLogErr("Failed to register service %s.%s: %s", mName.c_str(), mType.c_str(), DNSErrorToString(aError));
+        GetPublisher().RecordBackendError(aError);
         GetPublisher().RemoveServiceRegistration(mName, mType, DNSErrorToOtbrError(aError));
     }
 }
@@ -597,6 +619,7 @@ void PublisherMDnsSd::DnssdHostRegistration::Unregister(void)
     DNSServiceErrorType dnsError;
 
     VerifyOrExit(GetPublisher().IsStarted());
+    // The records are freed with `mHostsRef`, which is deallocated first when the connection is lost.
     VerifyOrExit(GetPublisher().mHostsRef != nullptr);
 
     for (size_t index = 0; index < mAddrRecordRefs.size(); index++)
@@ -645,6 +668,7 @@ void PublisherMDnsSd::DnssdHostRegistration::HandleRegisterResult(DNSRecordRef a
     if (aError != kDNSServiceErr_NoError)
     {
         otbrLogErr("Failed to register host %s: %s", mName.c_str(), DNSErrorToString(aError));
+        GetPublisher().RecordBackendError(aError);
         GetPublisher().RemoveHostRegistration(mName, DNSErrorToOtbrError(aError));
     }
     else
@@ -754,6 +778,8 @@ void PublisherMDnsSd::DnssdKeyRegistration::Unregister(void)
 
     VerifyOrExit(GetPublisher().IsStarted(), dnsError = kDNSServiceErr_ServiceNotRunning);
 
+    // The record has been freed with the lost shared connection.
+    VerifyOrExit(!GetPublisher().mConnectionLost);
     VerifyOrExit(serviceRef != nullptr);
 
     dnsError = DNSServiceRemoveRecord(serviceRef, mRecordRef, /* flags */ 0);
@@ -782,6 +808,7 @@ void PublisherMDnsSd::DnssdKeyRegistration::HandleRegisterResult(DNSServiceError
     if (aError != kDNSServiceErr_NoError)
     {
         otbrLogErr("Failed to register key %s: %s", mName.c_str(), DNSErrorToString(aError));
+        GetPublisher().RecordBackendError(aError);
         GetPublisher().RemoveKeyRegistration(mName, DNSErrorToOtbrError(aError));
     }
     else
@@ -825,7 +852,9 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+void PublisherMDnsSd::UnpublishServiceImpl(const std::string &aName,
+                                           const std::string &aType,
+                                           ResultCallback   &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -862,7 +891,7 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+void PublisherMDnsSd::UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -900,7 +929,7 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+void PublisherMDnsSd::UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -926,9 +955,11 @@ std::string PublisherMDnsSd::MakeRegType(const std::string &aType, SubTypeList a
     return regType;
 }
 
-void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+otbrError PublisherMDnsSd::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
-    VerifyOrExit(mState == Publisher::State::kReady);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedServices.push_back(MakeUnique<ServiceSubscription>(*this, aType, aInstanceName));
 
     otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
@@ -944,10 +975,10 @@ void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::stri
     }
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherMDnsSd::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -984,9 +1015,11 @@ otbrError PublisherMDnsSd::DnsErrorToOtbrError(int32_t aErrorCode)
     return otbr::Mdns::DNSErrorToOtbrError(aErrorCode);
 }
 
-void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
+otbrError PublisherMDnsSd::SubscribeHostImpl(const std::string &aHostName)
 {
-    VerifyOrExit(mState == State::kReady);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedHosts.push_back(MakeUnique<HostSubscription>(*this, aHostName));
 
     otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
@@ -994,10 +1027,10 @@ void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
     mSubscribedHosts.back()->Resolve();
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherMDnsSd::UnsubscribeHost(const std::string &aHostName)
+void PublisherMDnsSd::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList ::iterator it;
 
@@ -1035,49 +1068,34 @@ void PublisherMDnsSd::ServiceRef::DeallocateServiceRef(void)
 {
     if (mServiceRef != nullptr)
     {
-        mPublisher.HandleServiceRefDeallocating(mServiceRef);
-        DNSServiceRefDeallocate(mServiceRef);
+        // A `DNSServiceRef` sharing a lost connection has been freed with it.
+        if (!mPublisher.mConnectionLost)
+        {
+            mPublisher.HandleServiceRefDeallocating(mServiceRef);
+            DNSServiceRefDeallocate(mServiceRef);
+        }
+
         mServiceRef = nullptr;
     }
 }
 
-void PublisherMDnsSd::ServiceRef::Update(MainloopContext &aMainloop) const
+void PublisherMDnsSd::ServiceSubscription::Browse(void)
 {
-    int fd;
+    DNSServiceFlags     flags = 0;
+    DNSServiceErrorType dnsError;
 
-    VerifyOrExit(mServiceRef != nullptr);
+    assert(mServiceRef == nullptr);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    aMainloop.AddFdToReadSet(fd);
-exit:
-    return;
-}
+    otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
 
-void PublisherMDnsSd::ServiceRef::Process(const MainloopContext      &aMainloop,
-                                          std::vector<DNSServiceRef> &aReadyServices) const
-{
-    int fd;
+    dnsError = mPublisher.PrepareServiceRef(mServiceRef, flags);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
-    VerifyOrExit(mServiceRef != nullptr);
+    dnsError = DNSServiceBrowse(&mServiceRef, flags, kDNSServiceInterfaceIndexAny, mType.c_str(),
+                                /* domain */ nullptr, HandleBrowseResult, this);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    if (FD_ISSET(fd, &aMainloop.mReadFdSet))
-    {
-        aReadyServices.push_back(mServiceRef);
-    }
 exit:
-    return;
-}
-
-void PublisherMDnsSd::ServiceSubscription::Browse(void)
-{
-    assert(mServiceRef == nullptr);
-
-    otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
-    DNSServiceBrowse(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, mType.c_str(),
-                     /* domain */ nullptr, HandleBrowseResult, this);
+    mPublisher.HandleServiceRefCreated(mServiceRef, dnsError);
 }
 
 void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef       aServiceRef,
@@ -1137,36 +1155,25 @@ void PublisherMDnsSd::ServiceSubscription::Resolve(uint32_t           aInterface
     mResolvingInstances.back()->Resolve();
 }
 
-void PublisherMDnsSd::ServiceSubscription::UpdateAll(MainloopContext &aMainloop) const
-{
-    Update(aMainloop);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Update(aMainloop);
-    }
-}
-
-void PublisherMDnsSd::ServiceSubscription::ProcessAll(const MainloopContext      &aMainloop,
-                                                      std::vector<DNSServiceRef> &aReadyServices) const
-{
-    Process(aMainloop, aReadyServices);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Process(aMainloop, aReadyServices);
-    }
-}
-
 void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
 {
+    DNSServiceFlags     flags = kDNSServiceFlagsTimeout;
+    DNSServiceErrorType dnsError;
+
     assert(mServiceRef == nullptr);
 
     mSubscription->mPublisher.mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mType)] = Clock::now();
 
     otbrLogInfo("DNSServiceResolve %s %s inf %u", mInstanceName.c_str(), mType.c_str(), mNetifIndex);
-    DNSServiceResolve(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mNetifIndex, mInstanceName.c_str(),
-                      mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+
+    dnsError = mPublisher.PrepareServiceRef(mServiceRef, flags);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    dnsError = DNSServiceResolve(&mServiceRef, flags, mNetifIndex, mInstanceName.c_str(), mType.c_str(),
+                                 mDomain.c_str(), HandleResolveResult, this);
+
+exit:
+    mPublisher.HandleServiceRefCreated(mServiceRef, dnsError);
 }
 
 void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceRef        aServiceRef,
@@ -1233,15 +1240,23 @@ exit:
 
 otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInterfaceIndex)
 {
+    DNSServiceFlags     flags = 0;
     DNSServiceErrorType dnsError;
 
     assert(mServiceRef == nullptr);
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
 
-    dnsError = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
-                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
-                                     mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
+    dnsError = mPublisher.PrepareServiceRef(mServiceRef, flags);
+
+    if (dnsError == kDNSServiceErr_NoError)
+    {
+        dnsError = DNSServiceGetAddrInfo(&mServiceRef, flags, aInterfaceIndex,
+                                         kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
+                                         mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
+    }
+
+    mPublisher.HandleServiceRefCreated(mServiceRef, dnsError);
 
     if (dnsError != kDNSServiceErr_NoError)
     {
@@ -1317,12 +1332,14 @@ void PublisherMDnsSd::ServiceInstanceResolution::FinishResolution(void)
     DiscoveredInstanceInfo instanceInfo = mInstanceInfo;
 
     // NOTE: The `ServiceSubscription` object may be freed in `OnServiceResolved`.
-    subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo);
+    subscription->mPublisher.OnServiceResolved(std::move(serviceName), std::move(instanceInfo));
 }
 
 void PublisherMDnsSd::HostSubscription::Resolve(void)
 {
-    std::string fullHostName = MakeFullHostName(mHostName);
+    std::string         fullHostName = MakeFullHostName(mHostName);
+    DNSServiceFlags     flags        = 0;
+    DNSServiceErrorType dnsError;
 
     assert(mServiceRef == nullptr);
 
@@ -1330,9 +1347,15 @@ void PublisherMDnsSd::HostSubscription::Resolve(void)
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", fullHostName.c_str(), kDNSServiceInterfaceIndexAny);
 
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
-                          HandleResolveResult, this);
+    dnsError = mPublisher.PrepareServiceRef(mServiceRef, flags);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    dnsError = DNSServiceGetAddrInfo(&mServiceRef, flags, kDNSServiceInterfaceIndexAny,
+                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
+                                     HandleResolveResult, this);
+
+exit:
+    mPublisher.HandleServiceRefCreated(mServiceRef, dnsError);
 }
 
 void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef          aServiceRef,
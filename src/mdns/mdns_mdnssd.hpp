@@ -39,6 +39,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -50,6 +51,10 @@
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
 
+#ifndef OTBR_ENABLE_MDNS_SHARE_CONNECTION
+#define OTBR_ENABLE_MDNS_SHARE_CONNECTION 0
+#endif
+
 namespace otbr {
 
 namespace Mdns {
@@ -66,22 +71,15 @@ public:
 
     // Implementation of Mdns::Publisher.
 
-    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
-
-    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-    void      UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
-    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      SubscribeHost(const std::string &aHostName) override;
-    void      UnsubscribeHost(const std::string &aHostName) override;
     otbrError Start(void) override;
     bool      IsStarted(void) const override;
     void      Stop(void) override { Stop(kNormalStop); }
 
     // Implementation of MainloopProcessor.
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "PublisherMDnsSd"; }
 
 protected:
     otbrError PublishServiceImpl(const std::string &aHostName,
@@ -95,6 +93,15 @@ protected:
                               const AddressList &aAddress,
                               ResultCallback   &&aCallback) override;
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      UnpublishServiceImpl(const std::string &aName,
+                                   const std::string &aType,
+                                   ResultCallback   &&aCallback) override;
+    void      UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    otbrError SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
@@ -121,8 +128,6 @@ private:
 
         ~DnssdServiceRegistration(void) override { Unregister(); }
 
-        void      Update(MainloopContext &aMainloop) const;
-        void      Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         otbrError Register(void);
 
     private:
@@ -202,8 +207,6 @@ private:
 
         ~ServiceRef() { Release(); }
 
-        void Update(MainloopContext &aMainloop) const;
-        void Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         void Release(void);
         void DeallocateServiceRef(void);
     };
@@ -287,8 +290,6 @@ private:
                      const std::string &aInstanceName,
                      const std::string &aType,
                      const std::string &aDomain);
-        void UpdateAll(MainloopContext &aMainloop) const;
-        void ProcessAll(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
 
         static void HandleBrowseResult(DNSServiceRef       aServiceRef,
                                        DNSServiceFlags     aFlags,
@@ -346,19 +347,33 @@ private:
 
     static std::string MakeRegType(const std::string &aType, SubTypeList aSubTypeList);
 
+    struct ServiceRefEntry
+    {
+        DNSServiceRef mServiceRef;
+        uint64_t      mPollGeneration; // The `mPollGeneration` when the `DNSServiceRef` was created.
+    };
+
     void                Stop(StopMode aStopMode);
     DNSServiceErrorType CreateSharedHostsRef(void);
     void                DeallocateHostsRef(void);
+    DNSServiceErrorType PrepareServiceRef(DNSServiceRef &aServiceRef, DNSServiceFlags &aFlags);
+    void                HandleServiceRefCreated(DNSServiceRef &aServiceRef, DNSServiceErrorType aError);
+    void                HandleServiceRefAllocated(DNSServiceRef aServiceRef);
     void                HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef);
+    void                HandleServiceRefReadable(int aFd);
 
     DNSServiceRef mHostsRef;
+    bool          mConnectionLost; // Whether the shared connection died and took all `DNSServiceRef` with it.
     State         mState;
     StateCallback mStateCallback;
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
 
-    std::vector<DNSServiceRef> mServiceRefsToProcess;
+    // The `DNSServiceRef`s which own a socket, indexed by the socket fd. The fds are
+    // registered to the `MainloopManager` so only the ready ones are processed.
+    std::unordered_map<int, ServiceRefEntry> mServiceRefs;
+    uint64_t                                 mPollGeneration;
 };
 
 /**
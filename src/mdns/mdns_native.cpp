@@ -0,0 +1,2306 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the built-in mDNS publisher.
+ */
+
+#define OTBR_LOG_TAG "MDNS"
+
+#include "mdns/mdns_native.hpp"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <limits.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+namespace {
+
+constexpr uint16_t kMdnsPort = 5353;
+
+constexpr uint16_t kTypeA    = 1;
+constexpr uint16_t kTypePtr  = 12;
+constexpr uint16_t kTypeTxt  = 16;
+constexpr uint16_t kTypeKey  = 25;
+constexpr uint16_t kTypeAaaa = 28;
+constexpr uint16_t kTypeSrv  = 33;
+constexpr uint16_t kTypeAny  = 255;
+
+constexpr uint16_t kClassIn             = 1;
+constexpr uint16_t kClassMask           = 0x7fff;
+constexpr uint16_t kCacheFlushFlag      = 0x8000; // The cache-flush bit of the class of a record.
+constexpr uint16_t kUnicastResponseFlag = 0x8000; // The unicast-response bit of the class of a question.
+
+constexpr uint16_t kResponseFlag  = 0x8000;
+constexpr uint16_t kOpcodeMask    = 0x7800;
+constexpr uint16_t kResponseFlags = 0x8400; // A response with the Authoritative Answer bit.
+
+constexpr size_t  kHeaderSize      = 12;
+constexpr size_t  kMaxLabelLength  = 63;
+constexpr size_t  kMaxNameLength   = 255;
+constexpr uint8_t kMaxPointerHops  = 16;
+constexpr size_t  kMaxMessageSize  = 9000; // RFC 6762 section 17.
+constexpr size_t  kMaxPacketSize   = 1440; // Messages larger than this are split when possible.
+constexpr size_t  kSrvHeaderLength = 6;    // Priority, weight and port.
+
+// The TTLs recommended by RFC 6762 section 10.
+constexpr uint32_t kHostRecordTtl    = 120;
+constexpr uint32_t kDefaultRecordTtl = 4500;
+constexpr uint32_t kLegacyUnicastTtl = 10;
+
+constexpr uint8_t      kProbeCount    = 3;
+constexpr uint8_t      kAnnounceCount = 2;
+constexpr Milliseconds kProbeInterval(250);
+constexpr Milliseconds kProbeDeferral(1000);
+constexpr Milliseconds kAnnounceInterval(1000);
+constexpr Milliseconds kMinMulticastInterval(1000);
+constexpr Milliseconds kMinQueryDelay(20);
+constexpr Milliseconds kMaxQueryDelay(120);
+constexpr Milliseconds kMinQueryInterval(1000);
+constexpr Milliseconds kMaxQueryInterval(60000);
+constexpr Milliseconds kCacheFlushDelay(1000);
+
+const char kServicesName[] = "_services._dns-sd._udp";
+const char kLocalLabel[]   = "local";
+
+const uint8_t kMdnsAddress6[16] = {0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xfb};
+const uint8_t kMdnsAddress4[4]  = {224, 0, 0, 251};
+
+void AppendUint16(std::vector<uint8_t> &aBuffer, uint16_t aValue)
+{
+    aBuffer.push_back(static_cast<uint8_t>(aValue >> 8));
+    aBuffer.push_back(static_cast<uint8_t>(aValue & 0xff));
+}
+
+void AppendUint32(std::vector<uint8_t> &aBuffer, uint32_t aValue)
+{
+    AppendUint16(aBuffer, static_cast<uint16_t>(aValue >> 16));
+    AppendUint16(aBuffer, static_cast<uint16_t>(aValue & 0xffff));
+}
+
+uint16_t ReadUint16(const uint8_t *aBuffer)
+{
+    return static_cast<uint16_t>((aBuffer[0] << 8) | aBuffer[1]);
+}
+
+uint32_t ReadUint32(const uint8_t *aBuffer)
+{
+    return (static_cast<uint32_t>(ReadUint16(aBuffer)) << 16) | ReadUint16(aBuffer + 2);
+}
+
+void AppendLabel(std::string &aName, const char *aLabel, size_t aLength)
+{
+    aLength = std::min(aLength, kMaxLabelLength);
+    aName.push_back(static_cast<char>(aLength));
+    aName.append(aLabel, aLength);
+}
+
+bool LabelEquals(const char *aLabel, size_t aLength, const char *aOther)
+{
+    return strlen(aOther) == aLength && strncasecmp(aLabel, aOther, aLength) == 0;
+}
+
+// Appends the dot-separated labels of @p aLabels, and returns whether the last one is "local".
+bool AppendLabels(std::string &aName, const std::string &aLabels)
+{
+    size_t begin   = 0;
+    bool   isLocal = false;
+
+    while (begin < aLabels.size())
+    {
+        size_t end = aLabels.find('.', begin);
+
+        if (end == std::string::npos)
+        {
+            end = aLabels.size();
+        }
+
+        if (end > begin)
+        {
+            AppendLabel(aName, aLabels.data() + begin, end - begin);
+            isLocal = LabelEquals(aLabels.data() + begin, end - begin, kLocalLabel);
+        }
+
+        begin = end + 1;
+    }
+
+    return isLocal;
+}
+
+// Reads a possibly compressed name at @p aOffset and advances @p aOffset past it.
+bool ReadName(const uint8_t *aBuffer, size_t aLength, size_t &aOffset, std::string &aName)
+{
+    bool    found  = false;
+    bool    jumped = false;
+    size_t  offset = aOffset;
+    uint8_t hops   = 0;
+
+    aName.clear();
+
+    while (true)
+    {
+        uint8_t length;
+
+        VerifyOrExit(offset < aLength);
+        length = aBuffer[offset];
+
+        if ((length & 0xc0) == 0xc0)
+        {
+            size_t pointer;
+
+            VerifyOrExit(offset + 1 < aLength && ++hops <= kMaxPointerHops);
+            pointer = static_cast<size_t>((length & 0x3f) << 8) | aBuffer[offset + 1];
+
+            if (!jumped)
+            {
+                aOffset = offset + 2;
+                jumped  = true;
+            }
+
+            // A pointer must point backwards, so that the name can't loop forever.
+            VerifyOrExit(pointer < offset);
+            offset = pointer;
+            continue;
+        }
+
+        VerifyOrExit((length & 0xc0) == 0);
+        VerifyOrExit(offset + 1 + length <= aLength && aName.size() + 1 + length <= kMaxNameLength);
+        aName.append(reinterpret_cast<const char *>(aBuffer + offset), length + 1u);
+        offset += length + 1u;
+
+        if (length == 0)
+        {
+            break;
+        }
+    }
+
+    if (!jumped)
+    {
+        aOffset = offset;
+    }
+
+    found = true;
+
+exit:
+    return found;
+}
+
+std::string NameToString(const std::string &aName)
+{
+    std::string name;
+    size_t      offset = 0;
+
+    while (offset < aName.size() && aName[offset] != 0)
+    {
+        uint8_t length = static_cast<uint8_t>(aName[offset]);
+
+        name.append(aName, offset + 1, length);
+        name.push_back('.');
+        offset += length + 1u;
+    }
+
+    return name;
+}
+
+std::string GetFirstLabel(const std::string &aName)
+{
+    return aName.empty() ? std::string() : aName.substr(1, static_cast<uint8_t>(aName[0]));
+}
+
+std::vector<uint8_t> ToData(const std::string &aName)
+{
+    return std::vector<uint8_t>(aName.begin(), aName.end());
+}
+
+bool IsSameInstanceInfo(const Publisher::DiscoveredInstanceInfo &aInfo1,
+                        const Publisher::DiscoveredInstanceInfo &aInfo2)
+{
+    return aInfo1.mNetifIndex == aInfo2.mNetifIndex && aInfo1.mName == aInfo2.mName &&
+           aInfo1.mHostName == aInfo2.mHostName && aInfo1.mAddresses == aInfo2.mAddresses &&
+           aInfo1.mPort == aInfo2.mPort && aInfo1.mPriority == aInfo2.mPriority &&
+           aInfo1.mWeight == aInfo2.mWeight && aInfo1.mTxtData == aInfo2.mTxtData;
+}
+
+otbrError SetSocketOption(int aSocket, int aLevel, int aOption, int aValue)
+{
+    return setsockopt(aSocket, aLevel, aOption, &aValue, sizeof(aValue)) == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO;
+}
+
+int OpenSocket(int aFamily, const std::vector<uint32_t> &aNetifIndexes)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       fd    = socket(aFamily, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_UDP);
+
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+    SuccessOrExit(error = SetSocketOption(fd, SOL_SOCKET, SO_REUSEADDR, 1));
+#ifdef SO_REUSEPORT
+    SuccessOrExit(error = SetSocketOption(fd, SOL_SOCKET, SO_REUSEPORT, 1));
+#endif
+
+    if (aFamily == AF_INET6)
+    {
+        sockaddr_in6 address;
+
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IPV6, IPV6_V6ONLY, 1));
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IPV6, IPV6_RECVPKTINFO, 1));
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, 255));
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IPV6, IPV6_UNICAST_HOPS, 255));
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, 1));
+
+        memset(&address, 0, sizeof(address));
+        address.sin6_family = AF_INET6;
+        address.sin6_addr   = in6addr_any;
+        address.sin6_port   = htons(kMdnsPort);
+        VerifyOrExit(bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0,
+                     error = OTBR_ERROR_ERRNO);
+
+        for (uint32_t netifIndex : aNetifIndexes)
+        {
+            ipv6_mreq request;
+
+            memcpy(&request.ipv6mr_multiaddr, kMdnsAddress6, sizeof(kMdnsAddress6));
+            request.ipv6mr_interface = netifIndex;
+
+            if (setsockopt(fd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &request, sizeof(request)) != 0)
+            {
+                otbrLogWarning("Failed to join the IPv6 mDNS group on netif %u: %s", netifIndex, strerror(errno));
+            }
+        }
+    }
+    else
+    {
+        sockaddr_in address;
+
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IP, IP_PKTINFO, 1));
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IP, IP_MULTICAST_TTL, 255));
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IP, IP_TTL, 255));
+        SuccessOrExit(error = SetSocketOption(fd, IPPROTO_IP, IP_MULTICAST_LOOP, 1));
+
+        memset(&address, 0, sizeof(address));
+        address.sin_family      = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port        = htons(kMdnsPort);
+        VerifyOrExit(bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0,
+                     error = OTBR_ERROR_ERRNO);
+
+        for (uint32_t netifIndex : aNetifIndexes)
+        {
+            ip_mreqn request;
+
+            memset(&request, 0, sizeof(request));
+            memcpy(&request.imr_multiaddr, kMdnsAddress4, sizeof(kMdnsAddress4));
+            request.imr_ifindex = static_cast<int>(netifIndex);
+
+            if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &request, sizeof(request)) != 0)
+            {
+                otbrLogWarning("Failed to join the IPv4 mDNS group on netif %u: %s", netifIndex, strerror(errno));
+            }
+        }
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to open the %s mDNS socket: %s", aFamily == AF_INET6 ? "IPv6" : "IPv4",
+                       strerror(errno));
+
+        if (fd >= 0)
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    return fd;
+}
+
+} // namespace
+
+PublisherNative::Entry::Entry(PublisherNative &aPublisher)
+    : mPublisherNative(aPublisher)
+    , mState(State::kProbing)
+    , mTxCount(0)
+    , mResultPending(false)
+    , mResult(OTBR_ERROR_NONE)
+{
+}
+
+PublisherNative::Entry::~Entry(void)
+{
+    mPublisherNative.RemoveEntry(*this);
+}
+
+void PublisherNative::Entry::AddRecord(const Name &aName,
+                                       uint16_t    aType,
+                                       bool        aUnique,
+                                       uint32_t    aTtl,
+                                       std::vector<uint8_t> aData)
+{
+    Record record;
+
+    record.mName   = aName;
+    record.mType   = aType;
+    record.mUnique = aUnique;
+    record.mTtl    = aTtl;
+    record.mData   = std::move(aData);
+    mRecords.push_back(std::move(record));
+}
+
+bool PublisherNative::Entry::HasUniqueRecord(void) const
+{
+    return std::any_of(mRecords.begin(), mRecords.end(), [](const Record &aRecord) { return aRecord.mUnique; });
+}
+
+void PublisherNative::Entry::Start(void)
+{
+    Timepoint now = Clock::now();
+
+    mState         = State::kProbing;
+    mResultPending = false;
+
+    if (HasUniqueRecord())
+    {
+        // RFC 6762 section 8.1: wait for a random delay of 0-250ms before the first probe.
+        mTxCount = 0;
+        mTxTime  = mPublisherNative.RandomTime(now, Milliseconds::zero(), kProbeInterval);
+    }
+    else
+    {
+        // Shared records don't need probing.
+        mTxCount = kProbeCount;
+        mTxTime  = now;
+    }
+
+    mPublisherNative.AddEntry(*this);
+}
+
+void PublisherNative::NativeServiceRegistration::HandleProbeResult(otbrError aError)
+{
+    if (aError == OTBR_ERROR_NONE)
+    {
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        mPublisherNative.RemoveServiceRegistration(mName, mType, aError);
+    }
+}
+
+void PublisherNative::NativeHostRegistration::HandleProbeResult(otbrError aError)
+{
+    if (aError == OTBR_ERROR_NONE)
+    {
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        mPublisherNative.RemoveHostRegistration(mName, aError);
+    }
+}
+
+void PublisherNative::NativeKeyRegistration::HandleProbeResult(otbrError aError)
+{
+    if (aError == OTBR_ERROR_NONE)
+    {
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        mPublisherNative.RemoveKeyRegistration(mName, aError);
+    }
+}
+
+void PublisherNative::LocalHostEntry::HandleProbeResult(otbrError aError)
+{
+    VerifyOrExit(aError != OTBR_ERROR_NONE);
+
+    otbrLogWarning("Host name %s is used by another host, its addresses are not published",
+                   mPublisherNative.mHostName.c_str());
+    mPublisherNative.RemoveEntry(*this);
+
+exit:
+    return;
+}
+
+PublisherNative::ServiceSubscription::ServiceSubscription(std::string aType, std::string aInstanceName)
+    : mType(std::move(aType))
+    , mInstanceName(std::move(aInstanceName))
+    , mName(mInstanceName.empty() ? MakeName(mType) : MakeServiceName(mInstanceName, mType))
+    , mQueryInterval(kMinQueryInterval)
+{
+}
+
+PublisherNative::HostSubscription::HostSubscription(std::string aHostName)
+    : mHostName(std::move(aHostName))
+    , mName(MakeName(mHostName))
+    , mQueryInterval(kMinQueryInterval)
+{
+    mHostInfo.mHostName = NameToString(mName);
+}
+
+PublisherNative::PublisherNative(StateCallback aStateCallback)
+    : mState(State::kIdle)
+    , mStateCallback(std::move(aStateCallback))
+    , mSocket4(-1)
+    , mSocket6(-1)
+    , mEvaluationPending(false)
+    , mTimerId(0)
+    , mStateTimerId(0)
+    , mRandom(std::random_device()())
+{
+}
+
+PublisherNative::~PublisherNative(void)
+{
+    Stop();
+}
+
+otbrError PublisherNative::Start(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == State::kIdle, error = OTBR_ERROR_INVALID_STATE);
+    SuccessOrExit(error = LoadNetifs());
+    SuccessOrExit(error = OpenSockets());
+
+    mState = State::kReady;
+    UpdateLocalHost();
+
+    // Report the state asynchronously like the other publishers do.
+    mStateTimerId = MainloopManager::GetInstance().AddTimer(Microseconds::zero(), [this]() {
+        mStateTimerId = 0;
+        mStateCallback(mState);
+    });
+
+    otbrLogInfo("Started the native mDNS publisher on %zu netifs as %s", mNetifIndexes.size(), mHostName.c_str());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to start the native mDNS publisher: %s", otbrErrorString(error));
+        CloseSockets();
+    }
+
+    return error;
+}
+
+bool PublisherNative::IsStarted(void) const
+{
+    return mSocket6 >= 0 || mSocket4 >= 0;
+}
+
+void PublisherNative::Stop(void)
+{
+    // The registrations send goodbyes when they are destroyed, so they must be
+    // cleared before the sockets are closed.
+    mServiceRegistrations.clear();
+    mHostRegistrations.clear();
+    mKeyRegistrations.clear();
+    mLocalHost.reset();
+
+    mSubscribedServices.clear();
+    mSubscribedHosts.clear();
+    ClearSubscriptions();
+    mCache.clear();
+    mEvaluationPending = false;
+
+    if (mTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mTimerId);
+        mTimerId = 0;
+    }
+
+    if (mStateTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mStateTimerId);
+        mStateTimerId = 0;
+    }
+
+    CloseSockets();
+    mNetifIndexes.clear();
+    mLocalAddresses6.clear();
+    mLocalAddresses4.clear();
+
+    mState = State::kIdle;
+
+    AbortPendingUpdates();
+}
+
+otbrError PublisherNative::LoadNetifs(void)
+{
+    otbrError error   = OTBR_ERROR_NONE;
+    ifaddrs  *ifAddrs = nullptr;
+    char      hostName[HOST_NAME_MAX + 1];
+
+    VerifyOrExit(gethostname(hostName, sizeof(hostName)) == 0, error = OTBR_ERROR_ERRNO);
+    hostName[HOST_NAME_MAX] = '\0';
+    mHostName               = hostName;
+    mHostName               = mHostName.substr(0, mHostName.find('.'));
+    VerifyOrExit(!mHostName.empty(), error = OTBR_ERROR_INVALID_STATE);
+
+    VerifyOrExit(getifaddrs(&ifAddrs) == 0, error = OTBR_ERROR_ERRNO);
+
+    for (ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr; ifAddr = ifAddr->ifa_next)
+    {
+        uint32_t netifIndex;
+
+        if (ifAddr->ifa_addr == nullptr || !(ifAddr->ifa_flags & IFF_UP) || !(ifAddr->ifa_flags & IFF_MULTICAST))
+        {
+            continue;
+        }
+
+        netifIndex = if_nametoindex(ifAddr->ifa_name);
+
+        if (netifIndex == 0)
+        {
+            continue;
+        }
+
+        if (std::find(mNetifIndexes.begin(), mNetifIndexes.end(), netifIndex) == mNetifIndexes.end())
+        {
+            mNetifIndexes.push_back(netifIndex);
+        }
+
+        if (ifAddr->ifa_flags & IFF_LOOPBACK)
+        {
+            continue;
+        }
+
+        if (ifAddr->ifa_addr->sa_family == AF_INET6)
+        {
+            AddAddress(mLocalAddresses6,
+                       Ip6Address(reinterpret_cast<const sockaddr_in6 *>(ifAddr->ifa_addr)->sin6_addr.s6_addr));
+        }
+        else if (ifAddr->ifa_addr->sa_family == AF_INET)
+        {
+            mLocalAddresses4.push_back(reinterpret_cast<const sockaddr_in *>(ifAddr->ifa_addr)->sin_addr);
+        }
+    }
+
+    VerifyOrExit(!mNetifIndexes.empty(), error = OTBR_ERROR_NOT_FOUND);
+
+exit:
+    if (ifAddrs != nullptr)
+    {
+        freeifaddrs(ifAddrs);
+    }
+
+    return error;
+}
+
+otbrError PublisherNative::OpenSockets(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mSocket6 = OpenSocket(AF_INET6, mNetifIndexes);
+    mSocket4 = OpenSocket(AF_INET, mNetifIndexes);
+    VerifyOrExit(mSocket6 >= 0 || mSocket4 >= 0, error = OTBR_ERROR_ERRNO);
+
+    for (int fd : {mSocket6, mSocket4})
+    {
+        if (fd >= 0)
+        {
+            SuccessOrExit(error = MainloopManager::GetInstance().AddFd(
+                              fd, MainloopContext::kReadFdSet, [this, fd](uint8_t) { HandleSocketReadable(fd); }));
+        }
+    }
+
+exit:
+    return error;
+}
+
+void PublisherNative::CloseSockets(void)
+{
+    for (int *fd : {&mSocket6, &mSocket4})
+    {
+        if (*fd >= 0)
+        {
+            MainloopManager::GetInstance().RemoveFd(*fd);
+            close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+void PublisherNative::UpdateLocalHost(void)
+{
+    Name name = MakeName(mHostName);
+
+    mLocalHost.reset(new LocalHostEntry(*this));
+
+    for (const Ip6Address &address : mLocalAddresses6)
+    {
+        mLocalHost->AddRecord(name, kTypeAaaa, /* aUnique */ true, kHostRecordTtl,
+                              std::vector<uint8_t>(address.m8, address.m8 + sizeof(address.m8)));
+    }
+
+    for (const in_addr &address : mLocalAddresses4)
+    {
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&address.s_addr);
+
+        mLocalHost->AddRecord(name, kTypeA, /* aUnique */ true, kHostRecordTtl,
+                              std::vector<uint8_t>(bytes, bytes + sizeof(address.s_addr)));
+    }
+
+    if (!mLocalHost->mRecords.empty())
+    {
+        mLocalHost->Start();
+    }
+}
+
+otbrError PublisherNative::PublishServiceImpl(const std::string &aHostName,
+                                              const std::string &aName,
+                                              const std::string &aType,
+                                              const SubTypeList &aSubTypeList,
+                                              uint16_t           aPort,
+                                              const TxtData     &aTxtData,
+                                              ResultCallback   &&aCallback)
+{
+    otbrError                  error             = OTBR_ERROR_NONE;
+    SubTypeList                sortedSubTypeList = SortSubTypeList(aSubTypeList);
+    std::string                serviceName       = aName.empty() ? mHostName : aName;
+    NativeServiceRegistration *serviceReg;
+    Name                       typeName;
+    Name                       instanceName;
+    std::vector<uint8_t>       srvData;
+    std::string                hostName;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    aCallback = HandleDuplicateServiceRegistration(aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData,
+                                                   std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    typeName     = MakeName(aType);
+    instanceName = MakeServiceName(serviceName, aType);
+    hostName     = MakeName(aHostName.empty() ? mHostName : aHostName);
+
+    AppendUint16(srvData, 0); // Priority
+    AppendUint16(srvData, 0); // Weight
+    AppendUint16(srvData, aPort);
+    srvData.insert(srvData.end(), hostName.begin(), hostName.end());
+
+    serviceReg = new NativeServiceRegistration(aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData,
+                                               std::move(aCallback), this);
+    serviceReg->AddRecord(instanceName, kTypeSrv, /* aUnique */ true, kHostRecordTtl, std::move(srvData));
+    serviceReg->AddRecord(instanceName, kTypeTxt, /* aUnique */ true, kDefaultRecordTtl,
+                          aTxtData.empty() ? TxtData(1, 0) : aTxtData);
+    serviceReg->AddRecord(typeName, kTypePtr, /* aUnique */ false, kDefaultRecordTtl, ToData(instanceName));
+
+    for (const std::string &subType : sortedSubTypeList)
+    {
+        serviceReg->AddRecord(MakeName(subType + "._sub." + aType), kTypePtr, /* aUnique */ false, kDefaultRecordTtl,
+                              ToData(instanceName));
+    }
+
+    serviceReg->AddRecord(MakeName(kServicesName), kTypePtr, /* aUnique */ false, kDefaultRecordTtl,
+                          ToData(typeName));
+
+    otbrLogInfo("Publish service %s.%s", serviceName.c_str(), aType.c_str());
+    AddServiceRegistration(ServiceRegistrationPtr(serviceReg));
+    serviceReg->Start();
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        std::move(aCallback)(error);
+    }
+    return error;
+}
+
+void PublisherNative::UnpublishServiceImpl(const std::string &aName,
+                                           const std::string &aType,
+                                           ResultCallback   &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+otbrError PublisherNative::PublishHostImpl(const std::string &aName,
+                                           const AddressList &aAddresses,
+                                           ResultCallback   &&aCallback)
+{
+    otbrError               error = OTBR_ERROR_NONE;
+    NativeHostRegistration *hostReg;
+    Name                    hostName;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+    VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
+
+    hostName = MakeName(aName);
+    hostReg  = new NativeHostRegistration(aName, aAddresses, std::move(aCallback), this);
+
+    for (const Ip6Address &address : hostReg->mAddresses)
+    {
+        hostReg->AddRecord(hostName, kTypeAaaa, /* aUnique */ true, kHostRecordTtl,
+                           std::vector<uint8_t>(address.m8, address.m8 + sizeof(address.m8)));
+    }
+
+    otbrLogInfo("Publish host %s", aName.c_str());
+    AddHostRegistration(HostRegistrationPtr(hostReg));
+    hostReg->Start();
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        std::move(aCallback)(error);
+    }
+    return error;
+}
+
+void PublisherNative::UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+otbrError PublisherNative::PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
+{
+    otbrError              error = OTBR_ERROR_NONE;
+    NativeKeyRegistration *keyReg;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    aCallback = HandleDuplicateKeyRegistration(aName, aKeyData, std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    keyReg = new NativeKeyRegistration(aName, aKeyData, std::move(aCallback), this);
+    keyReg->AddRecord(MakeKeyName(aName), kTypeKey, /* aUnique */ true, kHostRecordTtl, aKeyData);
+
+    otbrLogInfo("Publish key record for %s", aName.c_str());
+    AddKeyRegistration(KeyRegistrationPtr(keyReg));
+    keyReg->Start();
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        std::move(aCallback)(error);
+    }
+    return error;
+}
+
+void PublisherNative::UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveKeyRegistration(aName, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+otbrError PublisherNative::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    mSubscribedServices.push_back(MakeUnique<ServiceSubscription>(aType, aInstanceName));
+    mSubscribedServices.back()->mQueryTime = RandomTime(Clock::now(), kMinQueryDelay, kMaxQueryDelay);
+    mEvaluationPending                     = true;
+
+    if (!aInstanceName.empty())
+    {
+        mServiceInstanceResolutionBeginTime.emplace(std::make_pair(aInstanceName, aType), Clock::now());
+    }
+
+    otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.size());
+    ScheduleTimer();
+
+exit:
+    return error;
+}
+
+void PublisherNative::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
+{
+    ServiceSubscriptionList::iterator it;
+
+    VerifyOrExit(mState == Publisher::State::kReady);
+    it = std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
+                      [&aType, &aInstanceName](const std::unique_ptr<ServiceSubscription> &aService) {
+                          return aService->mType == aType && aService->mInstanceName == aInstanceName;
+                      });
+    VerifyOrExit(it != mSubscribedServices.end());
+
+    mSubscribedServices.erase(it);
+    otbrLogInfo("Unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.size());
+
+    if (mSubscribedServices.empty() && mSubscribedHosts.empty())
+    {
+        mCache.clear();
+    }
+
+exit:
+    return;
+}
+
+otbrError PublisherNative::SubscribeHostImpl(const std::string &aHostName)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    mSubscribedHosts.push_back(MakeUnique<HostSubscription>(aHostName));
+    mSubscribedHosts.back()->mQueryTime = RandomTime(Clock::now(), kMinQueryDelay, kMaxQueryDelay);
+    mEvaluationPending                  = true;
+    mHostResolutionBeginTime.emplace(aHostName, Clock::now());
+
+    otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
+    ScheduleTimer();
+
+exit:
+    return error;
+}
+
+void PublisherNative::UnsubscribeHostImpl(const std::string &aHostName)
+{
+    HostSubscriptionList::iterator it;
+
+    VerifyOrExit(mState == Publisher::State::kReady);
+    it = std::find_if(
+        mSubscribedHosts.begin(), mSubscribedHosts.end(),
+        [&aHostName](const std::unique_ptr<HostSubscription> &aHost) { return aHost->mHostName == aHostName; });
+    VerifyOrExit(it != mSubscribedHosts.end());
+
+    mSubscribedHosts.erase(it);
+    otbrLogInfo("Unsubscribe host %s (remaining %zu)", aHostName.c_str(), mSubscribedHosts.size());
+
+    if (mSubscribedServices.empty() && mSubscribedHosts.empty())
+    {
+        mCache.clear();
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::OnServiceResolveFailedImpl(const std::string &aType,
+                                                 const std::string &aInstanceName,
+                                                 int32_t            aErrorCode)
+{
+    otbrLogWarning("Resolve service %s.%s failed: %s", aInstanceName.c_str(), aType.c_str(),
+                   otbrErrorString(static_cast<otbrError>(aErrorCode)));
+}
+
+void PublisherNative::OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode)
+{
+    otbrLogWarning("Resolve host %s failed: %s", aHostName.c_str(),
+                   otbrErrorString(static_cast<otbrError>(aErrorCode)));
+}
+
+otbrError PublisherNative::DnsErrorToOtbrError(int32_t aErrorCode)
+{
+    // The native publisher reports its errors as `otbrError` values.
+    return static_cast<otbrError>(aErrorCode);
+}
+
+void PublisherNative::AddEntry(Entry &aEntry)
+{
+    if (std::find(mEntries.begin(), mEntries.end(), &aEntry) == mEntries.end())
+    {
+        mEntries.push_back(&aEntry);
+    }
+
+    ScheduleTimer();
+}
+
+void PublisherNative::RemoveEntry(Entry &aEntry)
+{
+    auto it = std::find(mEntries.begin(), mEntries.end(), &aEntry);
+
+    VerifyOrExit(it != mEntries.end());
+    mEntries.erase(it);
+
+    // The records have been announced unless the entry is still probing.
+    if (aEntry.mState != Entry::State::kProbing)
+    {
+        SendAnnouncement(aEntry, /* aGoodbye */ true);
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::ProcessEntryResults(void)
+{
+    bool found;
+
+    // Reporting a result may add or remove any entries, so the
+    // iteration restarts after each report.
+    do
+    {
+        found = false;
+
+        for (Entry *entry : mEntries)
+        {
+            if (entry->mResultPending)
+            {
+                entry->mResultPending = false;
+                found                 = true;
+                entry->HandleProbeResult(entry->mResult);
+                break;
+            }
+        }
+    } while (found);
+}
+
+Timepoint PublisherNative::RandomTime(Timepoint aBase, Milliseconds aMin, Milliseconds aMax)
+{
+    std::uniform_int_distribution<Milliseconds::rep> distribution(aMin.count(), aMax.count());
+
+    return aBase + Milliseconds(distribution(mRandom));
+}
+
+void PublisherNative::ScheduleTimer(void)
+{
+    Timepoint fireTime = Timepoint::max();
+
+    VerifyOrExit(mState == State::kReady);
+
+    if (mEvaluationPending)
+    {
+        fireTime = Clock::now();
+    }
+
+    for (const Entry *entry : mEntries)
+    {
+        if (entry->mState != Entry::State::kRegistered && !entry->mResultPending)
+        {
+            fireTime = std::min(fireTime, entry->mTxTime);
+        }
+    }
+
+    for (const auto &subscription : mSubscribedServices)
+    {
+        fireTime = std::min(fireTime, subscription->mQueryTime);
+    }
+
+    for (const auto &subscription : mSubscribedHosts)
+    {
+        fireTime = std::min(fireTime, subscription->mQueryTime);
+    }
+
+    for (const auto &records : mCache)
+    {
+        for (const CachedRecord &record : records.second)
+        {
+            fireTime = std::min(fireTime, record.mExpireTime);
+        }
+    }
+
+exit:
+    if (mTimerId != 0 && (mState != State::kReady || fireTime != mTimerFireTime))
+    {
+        MainloopManager::GetInstance().RemoveTimer(mTimerId);
+        mTimerId = 0;
+    }
+
+    if (mState == State::kReady && mTimerId == 0 && fireTime != Timepoint::max())
+    {
+        Microseconds delay =
+            std::max(Microseconds::zero(), std::chrono::duration_cast<Microseconds>(fireTime - Clock::now()));
+
+        mTimerFireTime = fireTime;
+        mTimerId       = MainloopManager::GetInstance().AddTimer(delay, [this]() {
+            mTimerId = 0;
+            HandleTimer();
+        });
+    }
+}
+
+void PublisherNative::HandleTimer(void)
+{
+    Timepoint now = Clock::now();
+
+    ProcessCacheExpiry(now);
+    ProcessEntries(now);
+    ProcessQueries(now);
+
+    if (mEvaluationPending)
+    {
+        EvaluateSubscriptions();
+    }
+
+    ProcessEntryResults();
+    ScheduleTimer();
+}
+
+void PublisherNative::ProcessEntries(Timepoint aNow)
+{
+    for (Entry *entry : mEntries)
+    {
+        if (entry->mState == Entry::State::kRegistered || entry->mResultPending || entry->mTxTime > aNow)
+        {
+            continue;
+        }
+
+        if (entry->mState == Entry::State::kProbing)
+        {
+            if (entry->mTxCount < kProbeCount)
+            {
+                SendProbe(*entry);
+                entry->mTxCount++;
+                entry->mTxTime = aNow + kProbeInterval;
+                continue;
+            }
+
+            // No conflict has been detected after the last probe, the records are ours now.
+            entry->mState         = Entry::State::kAnnouncing;
+            entry->mTxCount       = 0;
+            entry->mResultPending = true;
+            entry->mResult        = OTBR_ERROR_NONE;
+        }
+
+        SendAnnouncement(*entry, /* aGoodbye */ false);
+        entry->mTxTime = aNow + kAnnounceInterval;
+
+        if (++entry->mTxCount >= kAnnounceCount)
+        {
+            entry->mState = Entry::State::kRegistered;
+        }
+    }
+}
+
+void PublisherNative::ProcessQueries(Timepoint aNow)
+{
+    std::vector<Question> questions;
+
+    for (auto &subscription : mSubscribedServices)
+    {
+        if (subscription->mQueryTime <= aNow)
+        {
+            AddQuestions(*subscription, questions);
+            subscription->mQueryTime     = aNow + subscription->mQueryInterval;
+            subscription->mQueryInterval = std::min(subscription->mQueryInterval * 2, kMaxQueryInterval);
+        }
+    }
+
+    for (auto &subscription : mSubscribedHosts)
+    {
+        if (subscription->mQueryTime <= aNow)
+        {
+            questions.push_back({subscription->mName, kTypeAaaa, false});
+            subscription->mQueryTime     = aNow + subscription->mQueryInterval;
+            subscription->mQueryInterval = std::min(subscription->mQueryInterval * 2, kMaxQueryInterval);
+        }
+    }
+
+    if (!questions.empty())
+    {
+        SendQuery(questions, aNow);
+    }
+}
+
+void PublisherNative::ProcessCacheExpiry(Timepoint aNow)
+{
+    for (auto it = mCache.begin(); it != mCache.end();)
+    {
+        std::vector<CachedRecord> &records = it->second;
+        size_t                     count   = records.size();
+
+        records.erase(std::remove_if(records.begin(), records.end(),
+                                     [aNow](const CachedRecord &aRecord) { return aRecord.mExpireTime <= aNow; }),
+                      records.end());
+        mEvaluationPending |= (records.size() != count);
+
+        it = records.empty() ? mCache.erase(it) : std::next(it);
+    }
+}
+
+void PublisherNative::AddQuestions(const ServiceSubscription &aSubscription, std::vector<Question> &aQuestions) const
+{
+    if (aSubscription.IsBrowsing())
+    {
+        aQuestions.push_back({aSubscription.mName, kTypePtr, false});
+    }
+    else
+    {
+        aQuestions.push_back({aSubscription.mName, kTypeSrv, false});
+        aQuestions.push_back({aSubscription.mName, kTypeTxt, false});
+    }
+
+    // Ask for the missing records of the instances which are not resolved yet.
+    for (const Name &instanceName : aSubscription.mUnresolvedInstances)
+    {
+        const std::vector<CachedRecord> *srvRecords = FindCachedRecords(instanceName, kTypeSrv);
+
+        if (srvRecords == nullptr)
+        {
+            aQuestions.push_back({instanceName, kTypeSrv, false});
+            aQuestions.push_back({instanceName, kTypeTxt, false});
+        }
+        else if (srvRecords->front().mData.size() > kSrvHeaderLength)
+        {
+            aQuestions.push_back(
+                {Name(srvRecords->front().mData.begin() + kSrvHeaderLength, srvRecords->front().mData.end()),
+                 kTypeAaaa, false});
+        }
+    }
+}
+
+void PublisherNative::HandleSocketReadable(int aSocket)
+{
+    uint8_t       buffer[kMaxMessageSize];
+    uint8_t       control[CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(in_pktinfo))];
+    SocketAddress sender;
+    iovec         iov;
+    msghdr        header;
+    ssize_t       length;
+    uint32_t      netifIndex = 0;
+    Message       message;
+
+    iov.iov_base = buffer;
+    iov.iov_len  = sizeof(buffer);
+
+    memset(&header, 0, sizeof(header));
+    header.msg_name       = &sender;
+    header.msg_namelen    = sizeof(sender);
+    header.msg_iov        = &iov;
+    header.msg_iovlen     = 1;
+    header.msg_control    = control;
+    header.msg_controllen = sizeof(control);
+
+    length = recvmsg(aSocket, &header, 0);
+
+    if (length < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            otbrLogWarning("Failed to receive mDNS message: %s", strerror(errno));
+        }
+
+        ExitNow();
+    }
+
+    for (cmsghdr *cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr; cmsg = CMSG_NXTHDR(&header, cmsg))
+    {
+        if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO)
+        {
+            in6_pktinfo packetInfo;
+
+            memcpy(&packetInfo, CMSG_DATA(cmsg), sizeof(packetInfo));
+            netifIndex = packetInfo.ipi6_ifindex;
+        }
+        else if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO)
+        {
+            in_pktinfo packetInfo;
+
+            memcpy(&packetInfo, CMSG_DATA(cmsg), sizeof(packetInfo));
+            netifIndex = static_cast<uint32_t>(packetInfo.ipi_ifindex);
+        }
+    }
+
+    VerifyOrExit(std::find(mNetifIndexes.begin(), mNetifIndexes.end(), netifIndex) != mNetifIndexes.end());
+
+    if (!ParseMessage(buffer, static_cast<size_t>(length), message))
+    {
+        otbrLogDebug("Dropped a malformed mDNS message from netif %u", netifIndex);
+        ExitNow();
+    }
+
+    HandleMessage(message, netifIndex, sender);
+
+exit:
+    return;
+}
+
+void PublisherNative::HandleMessage(const Message &aMessage, uint32_t aNetifIndex, const SocketAddress &aSender)
+{
+    uint16_t senderPort = ntohs(aSender.mAddress.sa_family == AF_INET6 ? aSender.mAddress6.sin6_port
+                                                                       : aSender.mAddress4.sin_port);
+
+    VerifyOrExit((aMessage.mFlags & kOpcodeMask) == 0);
+
+    if (aMessage.mFlags & kResponseFlag)
+    {
+        // RFC 6762 section 6: responses which are not sent from the mDNS port must be ignored.
+        VerifyOrExit(senderPort == kMdnsPort);
+        HandleResponse(aMessage, aNetifIndex);
+    }
+    else
+    {
+        if (!aMessage.mAuthorities.empty())
+        {
+            HandleProbe(aMessage);
+        }
+
+        HandleQuery(aMessage, aNetifIndex, aSender, senderPort != kMdnsPort);
+    }
+
+    ProcessEntryResults();
+    ScheduleTimer();
+
+exit:
+    return;
+}
+
+void PublisherNative::HandleQuery(const Message       &aMessage,
+                                  uint32_t             aNetifIndex,
+                                  const SocketAddress &aSender,
+                                  bool                 aLegacyUnicast)
+{
+    Timepoint             now             = Clock::now();
+    bool                  isProbe         = !aMessage.mAuthorities.empty();
+    bool                  unicastResponse = aLegacyUnicast;
+    std::vector<Record *> answers;
+    std::vector<Record *> additionals;
+    Message               response;
+
+    VerifyOrExit(!aMessage.mQuestions.empty());
+
+    if (!unicastResponse)
+    {
+        unicastResponse = std::all_of(aMessage.mQuestions.begin(), aMessage.mQuestions.end(),
+                                      [](const Question &aQuestion) { return aQuestion.mUnicastResponse; });
+    }
+
+    for (const Question &question : aMessage.mQuestions)
+    {
+        FindAnswers(question, answers);
+    }
+
+    // RFC 6762 section 7.1: known-answer suppression. Section 6: a record should not be multicast
+    // again within one second, unless it's defending a probe.
+    answers.erase(std::remove_if(answers.begin(), answers.end(),
+                                 [&](Record *aRecord) {
+                                     return IsKnownAnswer(aMessage, *aRecord) ||
+                                            (!unicastResponse && !isProbe &&
+                                             now < aRecord->mLastMulticastTime + kMinMulticastInterval);
+                                 }),
+                  answers.end());
+    VerifyOrExit(!answers.empty());
+
+    for (Record *answer : answers)
+    {
+        AddAdditionalRecords(*answer, additionals);
+    }
+
+    additionals.erase(std::remove_if(additionals.begin(), additionals.end(),
+                                     [&answers](Record *aRecord) {
+                                         return std::find(answers.begin(), answers.end(), aRecord) != answers.end();
+                                     }),
+                      additionals.end());
+
+    response.mFlags = kResponseFlags;
+
+    if (aLegacyUnicast)
+    {
+        // RFC 6762 section 6.7: legacy unicast responses repeat the query ID and the questions,
+        // and have neither long TTLs nor the cache-flush bit.
+        response.mId        = aMessage.mId;
+        response.mQuestions = aMessage.mQuestions;
+
+        for (Question &question : response.mQuestions)
+        {
+            question.mUnicastResponse = false;
+        }
+    }
+
+    for (Record *answer : answers)
+    {
+        response.mAnswers.push_back(ToResourceRecord(
+            *answer, aLegacyUnicast ? std::min(answer->mTtl, kLegacyUnicastTtl) : answer->mTtl,
+            answer->mUnique && !aLegacyUnicast));
+    }
+
+    for (Record *additional : additionals)
+    {
+        response.mAdditionals.push_back(ToResourceRecord(
+            *additional, aLegacyUnicast ? std::min(additional->mTtl, kLegacyUnicastTtl) : additional->mTtl,
+            additional->mUnique && !aLegacyUnicast));
+    }
+
+    if (unicastResponse)
+    {
+        SendMessage(response, aNetifIndex, &aSender);
+    }
+    else
+    {
+        SendMessage(response, aNetifIndex, nullptr);
+
+        for (Record *answer : answers)
+        {
+            answer->mLastMulticastTime = now;
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::HandleProbe(const Message &aMessage)
+{
+    Timepoint now = Clock::now();
+
+    // RFC 6762 section 8.2: simultaneous probes are resolved by comparing the proposed
+    // records, the host whose records are lexicographically later wins.
+    for (Entry *entry : mEntries)
+    {
+        if (entry->mState != Entry::State::kProbing || entry->mResultPending)
+        {
+            continue;
+        }
+
+        for (const Record &record : entry->mRecords)
+        {
+            RecordSet ours;
+            RecordSet theirs;
+
+            if (!record.mUnique)
+            {
+                continue;
+            }
+
+            for (const ResourceRecord &authority : aMessage.mAuthorities)
+            {
+                if (NameEquals(authority.mName, record.mName))
+                {
+                    theirs.emplace_back(authority.mType, &authority.mData);
+                }
+            }
+
+            if (theirs.empty())
+            {
+                continue;
+            }
+
+            for (const Record &other : entry->mRecords)
+            {
+                if (other.mUnique && NameEquals(other.mName, record.mName))
+                {
+                    ours.emplace_back(other.mType, &other.mData);
+                }
+            }
+
+            if (CompareRecordSets(ours, theirs) < 0)
+            {
+                otbrLogInfo("Lost the simultaneous probe of %s, probing again later",
+                            NameToString(record.mName).c_str());
+                entry->mTxCount = 0;
+                entry->mTxTime  = now + kProbeDeferral;
+                break;
+            }
+        }
+    }
+}
+
+void PublisherNative::HandleResponse(const Message &aMessage, uint32_t aNetifIndex)
+{
+    Timepoint now       = Clock::now();
+    bool      cacheable = !mSubscribedServices.empty() || !mSubscribedHosts.empty();
+
+    for (const std::vector<ResourceRecord> *section : {&aMessage.mAnswers, &aMessage.mAdditionals})
+    {
+        for (const ResourceRecord &record : *section)
+        {
+            CheckConflict(record, now);
+
+            if (cacheable && UpdateCache(record, aNetifIndex, now))
+            {
+                mEvaluationPending = true;
+            }
+        }
+    }
+
+    if (mEvaluationPending)
+    {
+        EvaluateSubscriptions();
+    }
+}
+
+void PublisherNative::CheckConflict(const ResourceRecord &aRecord, Timepoint aNow)
+{
+    VerifyOrExit(aRecord.mTtl != 0);
+
+    for (Entry *entry : mEntries)
+    {
+        bool sameRecordSet = false;
+        bool identical     = false;
+
+        if (entry->mResultPending)
+        {
+            continue;
+        }
+
+        for (const Record &record : entry->mRecords)
+        {
+            if (record.mUnique && record.mType == aRecord.mType && NameEquals(record.mName, aRecord.mName))
+            {
+                sameRecordSet = true;
+                identical |= (record.mData == aRecord.mData);
+            }
+        }
+
+        if (!sameRecordSet || identical)
+        {
+            continue;
+        }
+
+        if (entry->mState == Entry::State::kProbing)
+        {
+            otbrLogWarning("Name conflict detected while probing %s", NameToString(aRecord.mName).c_str());
+            entry->mResultPending = true;
+            entry->mResult        = OTBR_ERROR_DUPLICATED;
+        }
+        else
+        {
+            // RFC 6762 section 9: probe again, the entry is removed if the other host defends the records.
+            otbrLogWarning("Name conflict detected for %s, probing again", NameToString(aRecord.mName).c_str());
+            entry->mState   = Entry::State::kProbing;
+            entry->mTxCount = 0;
+            entry->mTxTime  = RandomTime(aNow, Milliseconds::zero(), kProbeInterval);
+        }
+    }
+
+exit:
+    return;
+}
+
+bool PublisherNative::UpdateCache(const ResourceRecord &aRecord, uint32_t aNetifIndex, Timepoint aNow)
+{
+    bool                                changed = false;
+    RecordCache::iterator               it;
+    std::vector<CachedRecord>::iterator cached;
+
+    VerifyOrExit(aRecord.mType == kTypePtr || aRecord.mType == kTypeSrv || aRecord.mType == kTypeTxt ||
+                 aRecord.mType == kTypeAaaa);
+
+    it = mCache.find(std::make_pair(ToLowerName(aRecord.mName), aRecord.mType));
+
+    if (it == mCache.end())
+    {
+        VerifyOrExit(aRecord.mTtl != 0);
+        it = mCache.emplace(std::make_pair(ToLowerName(aRecord.mName), aRecord.mType), std::vector<CachedRecord>())
+                 .first;
+    }
+
+    {
+        std::vector<CachedRecord> &records = it->second;
+        size_t                     count   = records.size();
+
+        if (aRecord.mCacheFlush)
+        {
+            // RFC 6762 section 10.2: the other records of the set which were received more than
+            // one second ago are outdated.
+            records.erase(std::remove_if(records.begin(), records.end(),
+                                         [&aRecord, aNow](const CachedRecord &aCached) {
+                                             return aCached.mData != aRecord.mData &&
+                                                    aCached.mReceiveTime + kCacheFlushDelay < aNow;
+                                         }),
+                          records.end());
+            changed = (records.size() != count);
+        }
+
+        cached = std::find_if(records.begin(), records.end(),
+                              [&aRecord](const CachedRecord &aCached) { return aCached.mData == aRecord.mData; });
+
+        if (aRecord.mTtl == 0)
+        {
+            // A goodbye record.
+            if (cached != records.end())
+            {
+                records.erase(cached);
+                changed = true;
+            }
+        }
+        else
+        {
+            if (cached == records.end())
+            {
+                records.emplace_back();
+                cached        = std::prev(records.end());
+                cached->mData = aRecord.mData;
+                changed       = true;
+            }
+
+            cached->mTtl         = aRecord.mTtl;
+            cached->mNetifIndex  = aNetifIndex;
+            cached->mReceiveTime = aNow;
+            cached->mExpireTime  = aNow + Seconds(aRecord.mTtl);
+        }
+
+        if (records.empty())
+        {
+            mCache.erase(it);
+        }
+    }
+
+exit:
+    return changed;
+}
+
+const std::vector<PublisherNative::CachedRecord> *PublisherNative::FindCachedRecords(const Name &aName,
+                                                                                     uint16_t    aType) const
+{
+    auto it = mCache.find(std::make_pair(ToLowerName(aName), aType));
+
+    return it != mCache.end() ? &it->second : nullptr;
+}
+
+bool PublisherNative::ResolveInstance(const Name &aInstanceName, DiscoveredInstanceInfo &aInstanceInfo) const
+{
+    bool                             resolved   = false;
+    const std::vector<CachedRecord> *srvRecords = FindCachedRecords(aInstanceName, kTypeSrv);
+    const std::vector<CachedRecord> *txtRecords = FindCachedRecords(aInstanceName, kTypeTxt);
+    Name                             hostName;
+
+    VerifyOrExit(srvRecords != nullptr && srvRecords->front().mData.size() > kSrvHeaderLength);
+
+    {
+        const CachedRecord &srv = srvRecords->front();
+
+        hostName = Name(srv.mData.begin() + kSrvHeaderLength, srv.mData.end());
+
+        aInstanceInfo.mName       = GetFirstLabel(aInstanceName);
+        aInstanceInfo.mNetifIndex = srv.mNetifIndex;
+        aInstanceInfo.mHostName   = NameToString(hostName);
+        aInstanceInfo.mPriority   = ReadUint16(&srv.mData[0]);
+        aInstanceInfo.mWeight     = ReadUint16(&srv.mData[2]);
+        aInstanceInfo.mPort       = ReadUint16(&srv.mData[4]);
+        aInstanceInfo.mTtl        = srv.mTtl;
+    }
+
+    if (txtRecords != nullptr)
+    {
+        aInstanceInfo.mTxtData = txtRecords->front().mData;
+    }
+
+    ResolveAddresses(hostName, aInstanceInfo.mAddresses, aInstanceInfo.mTtl);
+    resolved = !aInstanceInfo.mAddresses.empty();
+
+exit:
+    return resolved;
+}
+
+void PublisherNative::ResolveAddresses(const Name &aHostName, AddressList &aAddresses, uint32_t &aTtl) const
+{
+    const std::vector<CachedRecord> *records = FindCachedRecords(aHostName, kTypeAaaa);
+
+    VerifyOrExit(records != nullptr);
+
+    for (const CachedRecord &record : *records)
+    {
+        uint8_t address[16];
+
+        if (record.mData.size() != sizeof(address))
+        {
+            continue;
+        }
+
+        memcpy(address, record.mData.data(), sizeof(address));
+        AddAddress(aAddresses, Ip6Address(address));
+        aTtl = std::min(aTtl, record.mTtl);
+    }
+
+    std::sort(aAddresses.begin(), aAddresses.end());
+
+exit:
+    return;
+}
+
+void PublisherNative::EvaluateSubscriptions(void)
+{
+    std::vector<std::pair<std::string, DiscoveredInstanceInfo>> instances;
+    std::vector<std::pair<std::string, DiscoveredHostInfo>>     hosts;
+
+    mEvaluationPending = false;
+
+    for (auto &subscription : mSubscribedServices)
+    {
+        EvaluateServiceSubscription(*subscription, instances);
+    }
+
+    for (auto &subscription : mSubscribedHosts)
+    {
+        EvaluateHostSubscription(*subscription, hosts);
+    }
+
+    // The results are reported after the subscriptions are evaluated since
+    // the callbacks may subscribe or unsubscribe.
+    for (auto &instance : instances)
+    {
+        if (instance.second.mRemoved)
+        {
+            OnServiceRemoved(instance.second.mNetifIndex, std::move(instance.first), std::move(instance.second.mName));
+        }
+        else
+        {
+            OnServiceResolved(std::move(instance.first), std::move(instance.second));
+        }
+    }
+
+    for (auto &host : hosts)
+    {
+        OnHostResolved(std::move(host.first), std::move(host.second));
+    }
+}
+
+void PublisherNative::EvaluateServiceSubscription(
+    ServiceSubscription                                         &aSubscription,
+    std::vector<std::pair<std::string, DiscoveredInstanceInfo>> &aInstances)
+{
+    std::map<Name, Name> instanceNames; // The instance names keyed by the lowercase names.
+    bool                 hasNewInstance = false;
+
+    if (aSubscription.IsBrowsing())
+    {
+        const std::vector<CachedRecord> *ptrRecords = FindCachedRecords(aSubscription.mName, kTypePtr);
+
+        if (ptrRecords != nullptr)
+        {
+            for (const CachedRecord &ptr : *ptrRecords)
+            {
+                Name instanceName(ptr.mData.begin(), ptr.mData.end());
+
+                instanceNames.emplace(ToLowerName(instanceName), instanceName);
+            }
+        }
+    }
+    else
+    {
+        instanceNames.emplace(ToLowerName(aSubscription.mName), aSubscription.mName);
+    }
+
+    for (auto it = aSubscription.mInstances.begin(); it != aSubscription.mInstances.end();)
+    {
+        bool removed = (instanceNames.count(it->first) == 0 || FindCachedRecords(it->first, kTypeSrv) == nullptr);
+
+        if (removed)
+        {
+            DiscoveredInstanceInfo instanceInfo;
+
+            instanceInfo.mRemoved    = true;
+            instanceInfo.mNetifIndex = it->second.mNetifIndex;
+            instanceInfo.mName       = it->second.mName;
+            aInstances.emplace_back(aSubscription.mType, std::move(instanceInfo));
+
+            it = aSubscription.mInstances.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (auto it = aSubscription.mUnresolvedInstances.begin(); it != aSubscription.mUnresolvedInstances.end();)
+    {
+        it = (instanceNames.count(*it) == 0) ? aSubscription.mUnresolvedInstances.erase(it) : std::next(it);
+    }
+
+    for (const auto &instanceName : instanceNames)
+    {
+        DiscoveredInstanceInfo instanceInfo;
+
+        if (ResolveInstance(instanceName.second, instanceInfo))
+        {
+            auto it = aSubscription.mInstances.find(instanceName.first);
+
+            aSubscription.mUnresolvedInstances.erase(instanceName.first);
+
+            if (it == aSubscription.mInstances.end() || !IsSameInstanceInfo(it->second, instanceInfo))
+            {
+                aSubscription.mInstances[instanceName.first] = instanceInfo;
+                aInstances.emplace_back(aSubscription.mType, std::move(instanceInfo));
+            }
+        }
+        else if (aSubscription.mInstances.count(instanceName.first) == 0)
+        {
+            hasNewInstance |= aSubscription.mUnresolvedInstances.insert(instanceName.first).second;
+        }
+    }
+
+    if (hasNewInstance)
+    {
+        // Query the missing records of the new instances soon.
+        aSubscription.mQueryInterval = kMinQueryInterval;
+        aSubscription.mQueryTime =
+            std::min(aSubscription.mQueryTime, RandomTime(Clock::now(), kMinQueryDelay, kMaxQueryDelay));
+    }
+}
+
+void PublisherNative::EvaluateHostSubscription(HostSubscription                                        &aSubscription,
+                                               std::vector<std::pair<std::string, DiscoveredHostInfo>> &aHosts)
+{
+    const std::vector<CachedRecord> *records = FindCachedRecords(aSubscription.mName, kTypeAaaa);
+    DiscoveredHostInfo               hostInfo;
+
+    hostInfo.mHostName = aSubscription.mHostInfo.mHostName;
+    hostInfo.mTtl      = kHostRecordTtl;
+
+    if (records != nullptr)
+    {
+        hostInfo.mNetifIndex = records->front().mNetifIndex;
+        ResolveAddresses(aSubscription.mName, hostInfo.mAddresses, hostInfo.mTtl);
+    }
+
+    VerifyOrExit(hostInfo.mAddresses != aSubscription.mHostInfo.mAddresses);
+
+    aSubscription.mHostInfo = hostInfo;
+    aHosts.emplace_back(aSubscription.mHostName, std::move(hostInfo));
+
+exit:
+    return;
+}
+
+void PublisherNative::FindAnswers(const Question &aQuestion, std::vector<Record *> &aAnswers)
+{
+    for (Entry *entry : mEntries)
+    {
+        // RFC 6762 section 8.1: the records which are being probed must not be used to answer questions.
+        if (entry->mState == Entry::State::kProbing)
+        {
+            continue;
+        }
+
+        for (Record &record : entry->mRecords)
+        {
+            if ((aQuestion.mType == kTypeAny || aQuestion.mType == record.mType) &&
+                NameEquals(record.mName, aQuestion.mName) &&
+                std::find(aAnswers.begin(), aAnswers.end(), &record) == aAnswers.end())
+            {
+                aAnswers.push_back(&record);
+            }
+        }
+    }
+}
+
+void PublisherNative::AddAdditionalRecords(const Record &aAnswer, std::vector<Record *> &aAdditionals)
+{
+    // RFC 6763 section 12: include the SRV and TXT records of a PTR answer, and the address
+    // records of the target host of a SRV answer.
+    if (aAnswer.mType == kTypePtr)
+    {
+        Name   instanceName(aAnswer.mData.begin(), aAnswer.mData.end());
+        size_t begin = aAdditionals.size();
+
+        FindAnswers({instanceName, kTypeSrv, false}, aAdditionals);
+        FindAnswers({instanceName, kTypeTxt, false}, aAdditionals);
+
+        for (size_t i = begin; i < aAdditionals.size(); i++)
+        {
+            if (aAdditionals[i]->mType == kTypeSrv)
+            {
+                AddAdditionalRecords(*aAdditionals[i], aAdditionals);
+            }
+        }
+    }
+    else if (aAnswer.mType == kTypeSrv && aAnswer.mData.size() > kSrvHeaderLength)
+    {
+        Name hostName(aAnswer.mData.begin() + kSrvHeaderLength, aAnswer.mData.end());
+
+        FindAnswers({hostName, kTypeAaaa, false}, aAdditionals);
+        FindAnswers({hostName, kTypeA, false}, aAdditionals);
+    }
+}
+
+bool PublisherNative::IsKnownAnswer(const Message &aQuery, const Record &aRecord)
+{
+    // RFC 6762 section 7.1: a known answer suppresses the record if its TTL is at least half of the true TTL.
+    return std::any_of(aQuery.mAnswers.begin(), aQuery.mAnswers.end(), [&aRecord](const ResourceRecord &aKnown) {
+        return aKnown.mType == aRecord.mType && aKnown.mTtl >= aRecord.mTtl / 2 && aKnown.mData == aRecord.mData &&
+               NameEquals(aKnown.mName, aRecord.mName);
+    });
+}
+
+void PublisherNative::AddKnownAnswers(const Question &aQuestion, Timepoint aNow, Message &aQuery) const
+{
+    const std::vector<CachedRecord> *records = FindCachedRecords(aQuestion.mName, aQuestion.mType);
+
+    VerifyOrExit(records != nullptr);
+
+    for (const CachedRecord &record : *records)
+    {
+        uint32_t remaining;
+
+        if (record.mExpireTime <= aNow)
+        {
+            continue;
+        }
+
+        remaining = static_cast<uint32_t>(std::chrono::duration_cast<Seconds>(record.mExpireTime - aNow).count());
+
+        // RFC 6762 section 7.1: only the records whose remaining TTL is more than half of the
+        // original TTL are included.
+        if (remaining > record.mTtl / 2)
+        {
+            aQuery.mAnswers.push_back({aQuestion.mName, aQuestion.mType, false, remaining, record.mData});
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherNative::SendProbe(const Entry &aEntry)
+{
+    Message message;
+
+    for (const Record &record : aEntry.mRecords)
+    {
+        if (!record.mUnique)
+        {
+            continue;
+        }
+
+        if (std::none_of(message.mQuestions.begin(), message.mQuestions.end(),
+                         [&record](const Question &aQuestion) { return aQuestion.mName == record.mName; }))
+        {
+            // RFC 6762 section 8.1: the first probe asks for a unicast response.
+            message.mQuestions.push_back({record.mName, kTypeAny, aEntry.mTxCount == 0});
+        }
+
+        message.mAuthorities.push_back(ToResourceRecord(record, record.mTtl, /* aCacheFlush */ false));
+    }
+
+    SendMessage(message);
+}
+
+void PublisherNative::SendAnnouncement(Entry &aEntry, bool aGoodbye)
+{
+    Timepoint now = Clock::now();
+    Message   message;
+
+    message.mFlags = kResponseFlags;
+
+    for (Record &record : aEntry.mRecords)
+    {
+        message.mAnswers.push_back(
+            ToResourceRecord(record, aGoodbye ? 0 : record.mTtl, record.mUnique && !aGoodbye));
+        record.mLastMulticastTime = now;
+    }
+
+    SendMessage(message);
+}
+
+void PublisherNative::SendQuery(const std::vector<Question> &aQuestions, Timepoint aNow)
+{
+    Message message;
+
+    for (const Question &question : aQuestions)
+    {
+        if (std::none_of(message.mQuestions.begin(), message.mQuestions.end(), [&question](const Question &aOther) {
+                return aOther.mType == question.mType && NameEquals(aOther.mName, question.mName);
+            }))
+        {
+            message.mQuestions.push_back(question);
+            AddKnownAnswers(question, aNow, message);
+        }
+    }
+
+    SendMessage(message);
+}
+
+void PublisherNative::SendMessage(const Message &aMessage)
+{
+    for (uint32_t netifIndex : mNetifIndexes)
+    {
+        SendMessage(aMessage, netifIndex, nullptr);
+    }
+}
+
+void PublisherNative::SendMessage(const Message &aMessage, uint32_t aNetifIndex, const SocketAddress *aDestination)
+{
+    std::vector<std::vector<uint8_t>> packets;
+
+    EncodeMessage(aMessage, packets);
+
+    for (const std::vector<uint8_t> &packet : packets)
+    {
+        if (aDestination != nullptr)
+        {
+            SendPacket(packet, aNetifIndex, *aDestination);
+        }
+        else
+        {
+            SocketAddress destination;
+
+            memset(&destination, 0, sizeof(destination));
+            destination.mAddress6.sin6_family   = AF_INET6;
+            destination.mAddress6.sin6_port     = htons(kMdnsPort);
+            destination.mAddress6.sin6_scope_id = aNetifIndex;
+            memcpy(&destination.mAddress6.sin6_addr, kMdnsAddress6, sizeof(kMdnsAddress6));
+            SendPacket(packet, aNetifIndex, destination);
+
+            memset(&destination, 0, sizeof(destination));
+            destination.mAddress4.sin_family = AF_INET;
+            destination.mAddress4.sin_port   = htons(kMdnsPort);
+            memcpy(&destination.mAddress4.sin_addr, kMdnsAddress4, sizeof(kMdnsAddress4));
+            SendPacket(packet, aNetifIndex, destination);
+        }
+    }
+}
+
+void PublisherNative::SendPacket(const std::vector<uint8_t> &aPacket,
+                                 uint32_t                    aNetifIndex,
+                                 const SocketAddress        &aDestination)
+{
+    bool     isIp6 = (aDestination.mAddress.sa_family == AF_INET6);
+    int      fd    = isIp6 ? mSocket6 : mSocket4;
+    uint8_t  control[CMSG_SPACE(sizeof(in6_pktinfo))];
+    iovec    iov;
+    msghdr   header;
+    cmsghdr *cmsg;
+
+    VerifyOrExit(fd >= 0);
+
+    iov.iov_base = const_cast<uint8_t *>(aPacket.data());
+    iov.iov_len  = aPacket.size();
+
+    memset(control, 0, sizeof(control));
+    memset(&header, 0, sizeof(header));
+    header.msg_name    = const_cast<sockaddr *>(&aDestination.mAddress);
+    header.msg_namelen = isIp6 ? sizeof(sockaddr_in6) : sizeof(sockaddr_in);
+    header.msg_iov     = &iov;
+    header.msg_iovlen  = 1;
+    header.msg_control = control;
+
+    // Send the packet on the given netif.
+    if (isIp6)
+    {
+        in6_pktinfo packetInfo;
+
+        memset(&packetInfo, 0, sizeof(packetInfo));
+        packetInfo.ipi6_ifindex = aNetifIndex;
+        header.msg_controllen   = CMSG_SPACE(sizeof(packetInfo));
+        cmsg                    = CMSG_FIRSTHDR(&header);
+        cmsg->cmsg_level        = IPPROTO_IPV6;
+        cmsg->cmsg_type         = IPV6_PKTINFO;
+        cmsg->cmsg_len          = CMSG_LEN(sizeof(packetInfo));
+        memcpy(CMSG_DATA(cmsg), &packetInfo, sizeof(packetInfo));
+    }
+    else
+    {
+        in_pktinfo packetInfo;
+
+        memset(&packetInfo, 0, sizeof(packetInfo));
+        packetInfo.ipi_ifindex = static_cast<int>(aNetifIndex);
+        header.msg_controllen  = CMSG_SPACE(sizeof(packetInfo));
+        cmsg                   = CMSG_FIRSTHDR(&header);
+        cmsg->cmsg_level       = IPPROTO_IP;
+        cmsg->cmsg_type        = IP_PKTINFO;
+        cmsg->cmsg_len         = CMSG_LEN(sizeof(packetInfo));
+        memcpy(CMSG_DATA(cmsg), &packetInfo, sizeof(packetInfo));
+    }
+
+    if (sendmsg(fd, &header, 0) < 0)
+    {
+        otbrLogDebug("Failed to send mDNS message on netif %u: %s", aNetifIndex, strerror(errno));
+    }
+
+exit:
+    return;
+}
+
+PublisherNative::ResourceRecord PublisherNative::ToResourceRecord(const Record &aRecord,
+                                                                  uint32_t      aTtl,
+                                                                  bool          aCacheFlush)
+{
+    return {aRecord.mName, aRecord.mType, aCacheFlush, aTtl, aRecord.mData};
+}
+
+PublisherNative::Name PublisherNative::MakeName(const std::string &aName)
+{
+    Name name;
+
+    if (!AppendLabels(name, aName))
+    {
+        AppendLabel(name, kLocalLabel, sizeof(kLocalLabel) - 1);
+    }
+
+    name.push_back('\0');
+
+    return name;
+}
+
+PublisherNative::Name PublisherNative::MakeServiceName(const std::string &aInstanceName, const std::string &aType)
+{
+    Name name;
+
+    // The instance name is a single label even if it contains dots.
+    AppendLabel(name, aInstanceName.data(), aInstanceName.size());
+
+    return name + MakeName(aType);
+}
+
+PublisherNative::Name PublisherNative::MakeKeyName(const std::string &aName)
+{
+    Name   name;
+    size_t protocolPos = aName.rfind('.');
+    size_t servicePos  = (protocolPos == std::string::npos || protocolPos == 0) ? std::string::npos
+                                                                                : aName.rfind('.', protocolPos - 1);
+
+    // The key of a service instance is named `<instance>.<service>.<protocol>`,
+    // where the instance name is a single label which may contain dots.
+    if (servicePos != std::string::npos && servicePos > 0 && aName[servicePos + 1] == '_' &&
+        (LabelEquals(aName.data() + protocolPos + 1, aName.size() - protocolPos - 1, "_udp") ||
+         LabelEquals(aName.data() + protocolPos + 1, aName.size() - protocolPos - 1, "_tcp")))
+    {
+        name = MakeServiceName(aName.substr(0, servicePos), aName.substr(servicePos + 1));
+    }
+    else
+    {
+        name = MakeName(aName);
+    }
+
+    return name;
+}
+
+PublisherNative::Name PublisherNative::ToLowerName(Name aName)
+{
+    // Label lengths are at most 63, so they are never changed by `tolower()`.
+    std::transform(aName.begin(), aName.end(), aName.begin(),
+                   [](char aChar) { return static_cast<char>(tolower(static_cast<unsigned char>(aChar))); });
+
+    return aName;
+}
+
+bool PublisherNative::NameEquals(const Name &aName1, const Name &aName2)
+{
+    return aName1.size() == aName2.size() && strncasecmp(aName1.data(), aName2.data(), aName1.size()) == 0;
+}
+
+int PublisherNative::CompareRecordSets(RecordSet &aRecords1, RecordSet &aRecords2)
+{
+    auto less = [](const RecordSet::value_type &aLhs, const RecordSet::value_type &aRhs) {
+        return aLhs.first < aRhs.first || (aLhs.first == aRhs.first && *aLhs.second < *aRhs.second);
+    };
+
+    std::sort(aRecords1.begin(), aRecords1.end(), less);
+    std::sort(aRecords2.begin(), aRecords2.end(), less);
+
+    for (size_t i = 0; i < aRecords1.size() && i < aRecords2.size(); i++)
+    {
+        if (less(aRecords1[i], aRecords2[i]))
+        {
+            return -1;
+        }
+
+        if (less(aRecords2[i], aRecords1[i]))
+        {
+            return 1;
+        }
+    }
+
+    return (aRecords1.size() < aRecords2.size()) ? -1 : (aRecords1.size() > aRecords2.size() ? 1 : 0);
+}
+
+bool PublisherNative::ParseMessage(const uint8_t *aBuffer, size_t aLength, Message &aMessage)
+{
+    bool     parsed = false;
+    size_t   offset = kHeaderSize;
+    uint16_t counts[4];
+
+    VerifyOrExit(aLength >= kHeaderSize);
+
+    aMessage.mId    = ReadUint16(aBuffer);
+    aMessage.mFlags = ReadUint16(aBuffer + 2);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        counts[i] = ReadUint16(aBuffer + 4 + 2 * i);
+    }
+
+    for (uint16_t i = 0; i < counts[0]; i++)
+    {
+        Question question;
+        uint16_t questionClass;
+
+        VerifyOrExit(ReadName(aBuffer, aLength, offset, question.mName) && offset + 4 <= aLength);
+        question.mType            = ReadUint16(aBuffer + offset);
+        questionClass             = ReadUint16(aBuffer + offset + 2);
+        question.mUnicastResponse = (questionClass & kUnicastResponseFlag) != 0;
+        offset += 4;
+
+        if ((questionClass & kClassMask) == kClassIn)
+        {
+            aMessage.mQuestions.push_back(std::move(question));
+        }
+    }
+
+    for (size_t sectionIndex = 0; sectionIndex < 3; sectionIndex++)
+    {
+        std::vector<ResourceRecord> *section =
+            (sectionIndex == 0) ? &aMessage.mAnswers
+                                : (sectionIndex == 1 ? &aMessage.mAuthorities : &aMessage.mAdditionals);
+
+        for (uint16_t i = 0; i < counts[1 + sectionIndex]; i++)
+        {
+            ResourceRecord record;
+            uint16_t       recordClass;
+            uint16_t       dataLength;
+            size_t         dataOffset;
+
+            VerifyOrExit(ReadName(aBuffer, aLength, offset, record.mName) && offset + 10 <= aLength);
+            record.mType       = ReadUint16(aBuffer + offset);
+            recordClass        = ReadUint16(aBuffer + offset + 2);
+            record.mCacheFlush = (recordClass & kCacheFlushFlag) != 0;
+            record.mTtl        = ReadUint32(aBuffer + offset + 4);
+            dataLength         = ReadUint16(aBuffer + offset + 8);
+            offset += 10;
+            VerifyOrExit(offset + dataLength <= aLength);
+            dataOffset = offset;
+            offset += dataLength;
+
+            if ((recordClass & kClassMask) != kClassIn)
+            {
+                continue;
+            }
+
+            // Decompress the names in the RDATA, so that the RDATA can be compared bytewise.
+            if (record.mType == kTypePtr || record.mType == kTypeSrv)
+            {
+                size_t nameOffset = dataOffset;
+                Name   name;
+
+                if (record.mType == kTypeSrv)
+                {
+                    VerifyOrExit(dataLength > kSrvHeaderLength);
+                    record.mData.assign(aBuffer + dataOffset, aBuffer + dataOffset + kSrvHeaderLength);
+                    nameOffset += kSrvHeaderLength;
+                }
+
+                VerifyOrExit(ReadName(aBuffer, offset, nameOffset, name));
+                record.mData.insert(record.mData.end(), name.begin(), name.end());
+            }
+            else
+            {
+                record.mData.assign(aBuffer + dataOffset, aBuffer + offset);
+            }
+
+            section->push_back(std::move(record));
+        }
+    }
+
+    parsed = true;
+
+exit:
+    return parsed;
+}
+
+void PublisherNative::EncodeMessage(const Message &aMessage, std::vector<std::vector<uint8_t>> &aPackets)
+{
+    std::vector<uint8_t> packet;
+
+    AppendUint16(packet, aMessage.mId);
+    AppendUint16(packet, aMessage.mFlags);
+    AppendUint16(packet, static_cast<uint16_t>(aMessage.mQuestions.size()));
+    AppendUint16(packet, static_cast<uint16_t>(aMessage.mAnswers.size()));
+    AppendUint16(packet, static_cast<uint16_t>(aMessage.mAuthorities.size()));
+    AppendUint16(packet, static_cast<uint16_t>(aMessage.mAdditionals.size()));
+
+    for (const Question &question : aMessage.mQuestions)
+    {
+        packet.insert(packet.end(), question.mName.begin(), question.mName.end());
+        AppendUint16(packet, question.mType);
+        AppendUint16(packet, kClassIn | (question.mUnicastResponse ? kUnicastResponseFlag : 0));
+    }
+
+    for (const std::vector<ResourceRecord> *section :
+         {&aMessage.mAnswers, &aMessage.mAuthorities, &aMessage.mAdditionals})
+    {
+        for (const ResourceRecord &record : *section)
+        {
+            packet.insert(packet.end(), record.mName.begin(), record.mName.end());
+            AppendUint16(packet, record.mType);
+            AppendUint16(packet, kClassIn | (record.mCacheFlush ? kCacheFlushFlag : 0));
+            AppendUint32(packet, record.mTtl);
+            AppendUint16(packet, static_cast<uint16_t>(record.mData.size()));
+            packet.insert(packet.end(), record.mData.begin(), record.mData.end());
+        }
+    }
+
+    if (packet.size() > kMaxPacketSize && aMessage.mAnswers.size() > 1)
+    {
+        // Split the answers into two messages. The additional records are dropped since
+        // the receivers can query for them.
+        Message first;
+        Message second;
+        auto    middle = aMessage.mAnswers.begin() + static_cast<ptrdiff_t>(aMessage.mAnswers.size() / 2);
+
+        first.mId          = second.mId          = aMessage.mId;
+        first.mFlags       = second.mFlags       = aMessage.mFlags;
+        first.mQuestions   = second.mQuestions   = aMessage.mQuestions;
+        first.mAuthorities = second.mAuthorities = aMessage.mAuthorities;
+        first.mAnswers.assign(aMessage.mAnswers.begin(), middle);
+        second.mAnswers.assign(middle, aMessage.mAnswers.end());
+
+        EncodeMessage(first, aPackets);
+        EncodeMessage(second, aPackets);
+    }
+    else if (packet.size() <= kMaxMessageSize)
+    {
+        aPackets.push_back(std::move(packet));
+    }
+    else
+    {
+        otbrLogWarning("Dropped an mDNS message of %zu bytes", packet.size());
+    }
+}
+
+Publisher *Publisher::Create(StateCallback aStateCallback)
+{
+    return new PublisherNative(std::move(aStateCallback));
+}
+
+void Publisher::Destroy(Publisher *aPublisher)
+{
+    delete static_cast<PublisherNative *>(aPublisher);
+}
+
+} // namespace Mdns
+
+} // namespace otbr
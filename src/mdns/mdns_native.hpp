@@ -0,0 +1,403 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the built-in mDNS publisher which speaks mDNS directly.
+ */
+
+#ifndef OTBR_AGENT_MDNS_NATIVE_HPP_
+#define OTBR_AGENT_MDNS_NATIVE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <netinet/in.h>
+
+#include "mdns.hpp"
+#include "common/code_utils.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+
+/**
+ * @addtogroup border-router-mdns
+ *
+ * @brief
+ *   This module includes definition for the built-in mDNS publisher.
+ *
+ * @{
+ */
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements a mDNS publisher which runs the mDNS protocol (RFC 6762) inside the mainloop.
+ *
+ * Unlike the other publishers, it doesn't depend on an mDNS daemon. It sends and receives mDNS messages
+ * on all multicast-capable interfaces which are up when it's started, probes and announces the published
+ * records, answers queries with known-answer suppression, and keeps a cache of the records it receives
+ * to serve the subscriptions.
+ */
+class PublisherNative : public Publisher
+{
+public:
+    explicit PublisherNative(StateCallback aStateCallback);
+    ~PublisherNative(void) override;
+
+    otbrError Start(void) override;
+    bool      IsStarted(void) const override;
+    void      Stop(void) override;
+
+protected:
+    otbrError PublishServiceImpl(const std::string &aHostName,
+                                 const std::string &aName,
+                                 const std::string &aType,
+                                 const SubTypeList &aSubTypeList,
+                                 uint16_t           aPort,
+                                 const TxtData     &aTxtData,
+                                 ResultCallback   &&aCallback) override;
+    otbrError PublishHostImpl(const std::string &aName,
+                              const AddressList &aAddresses,
+                              ResultCallback   &&aCallback) override;
+    otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      UnpublishServiceImpl(const std::string &aName,
+                                   const std::string &aType,
+                                   ResultCallback   &&aCallback) override;
+    void      UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    otbrError SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
+    void      OnServiceResolveFailedImpl(const std::string &aType,
+                                         const std::string &aInstanceName,
+                                         int32_t            aErrorCode) override;
+    void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
+    otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+
+private:
+    friend class PublisherNativeTest;
+
+    // A DNS name in the uncompressed wire format, e.g. "\x03ins\x04_srv\x04_udp\x05local\x00".
+    typedef std::string Name;
+
+    // A published resource record. The names in `mData` are in the uncompressed wire format.
+    struct Record
+    {
+        Name                 mName;
+        uint16_t             mType;
+        bool                 mUnique; // Whether this host owns the whole record set of `mName` and `mType`.
+        uint32_t             mTtl;
+        std::vector<uint8_t> mData;
+        Timepoint            mLastMulticastTime;
+    };
+
+    // A group of records which are probed and announced together.
+    class Entry
+    {
+    public:
+        enum class State : uint8_t
+        {
+            kProbing,
+            kAnnouncing,
+            kRegistered,
+        };
+
+        explicit Entry(PublisherNative &aPublisher);
+        virtual ~Entry(void);
+
+        void AddRecord(const Name &aName, uint16_t aType, bool aUnique, uint32_t aTtl, std::vector<uint8_t> aData);
+        bool HasUniqueRecord(void) const;
+
+        // Starts probing the unique records, or announcing if there are none.
+        void Start(void);
+
+        // Reports the result of probing. The entry may be destroyed by this method.
+        virtual void HandleProbeResult(otbrError aError) = 0;
+
+        PublisherNative    &mPublisherNative;
+        std::vector<Record> mRecords;
+        State               mState;
+        uint8_t             mTxCount;
+        Timepoint           mTxTime;
+        bool                mResultPending;
+        otbrError           mResult;
+    };
+
+    class NativeServiceRegistration : public ServiceRegistration, public Entry
+    {
+    public:
+        NativeServiceRegistration(const std::string &aHostName,
+                                  const std::string &aName,
+                                  const std::string &aType,
+                                  const SubTypeList &aSubTypeList,
+                                  uint16_t           aPort,
+                                  const TxtData     &aTxtData,
+                                  ResultCallback   &&aCallback,
+                                  PublisherNative   *aPublisher)
+            : ServiceRegistration(aHostName,
+                                  aName,
+                                  aType,
+                                  aSubTypeList,
+                                  aPort,
+                                  aTxtData,
+                                  std::move(aCallback),
+                                  aPublisher)
+            , Entry(*aPublisher)
+        {
+        }
+
+        void HandleProbeResult(otbrError aError) override;
+    };
+
+    class NativeHostRegistration : public HostRegistration, public Entry
+    {
+    public:
+        NativeHostRegistration(const std::string &aName,
+                               const AddressList &aAddresses,
+                               ResultCallback   &&aCallback,
+                               PublisherNative   *aPublisher)
+            : HostRegistration(aName, aAddresses, std::move(aCallback), aPublisher)
+            , Entry(*aPublisher)
+        {
+        }
+
+        void HandleProbeResult(otbrError aError) override;
+    };
+
+    class NativeKeyRegistration : public KeyRegistration, public Entry
+    {
+    public:
+        NativeKeyRegistration(const std::string &aName,
+                              const KeyData     &aKeyData,
+                              ResultCallback   &&aCallback,
+                              PublisherNative   *aPublisher)
+            : KeyRegistration(aName, aKeyData, std::move(aCallback), aPublisher)
+            , Entry(*aPublisher)
+        {
+        }
+
+        void HandleProbeResult(otbrError aError) override;
+    };
+
+    // The address records of this host.
+    class LocalHostEntry : public Entry
+    {
+    public:
+        explicit LocalHostEntry(PublisherNative &aPublisher)
+            : Entry(aPublisher)
+        {
+        }
+
+        void HandleProbeResult(otbrError aError) override;
+    };
+
+    struct Question
+    {
+        Name     mName;
+        uint16_t mType;
+        bool     mUnicastResponse;
+    };
+
+    struct ResourceRecord
+    {
+        Name                 mName;
+        uint16_t             mType;
+        bool                 mCacheFlush;
+        uint32_t             mTtl;
+        std::vector<uint8_t> mData;
+    };
+
+    struct Message
+    {
+        uint16_t                    mId    = 0;
+        uint16_t                    mFlags = 0;
+        std::vector<Question>       mQuestions;
+        std::vector<ResourceRecord> mAnswers;
+        std::vector<ResourceRecord> mAuthorities;
+        std::vector<ResourceRecord> mAdditionals;
+    };
+
+    union SocketAddress
+    {
+        sockaddr     mAddress;
+        sockaddr_in  mAddress4;
+        sockaddr_in6 mAddress6;
+    };
+
+    struct CachedRecord
+    {
+        std::vector<uint8_t> mData;
+        uint32_t             mTtl;
+        uint32_t             mNetifIndex;
+        Timepoint            mReceiveTime;
+        Timepoint            mExpireTime;
+    };
+
+    // The cached records are keyed by the lowercase name and the record type.
+    typedef std::map<std::pair<Name, uint16_t>, std::vector<CachedRecord>> RecordCache;
+
+    // The types and RDATA of the records of a name, which are compared to break the tie of simultaneous probes.
+    typedef std::vector<std::pair<uint16_t, const std::vector<uint8_t> *>> RecordSet;
+
+    struct ServiceSubscription
+    {
+        ServiceSubscription(std::string aType, std::string aInstanceName);
+
+        bool IsBrowsing(void) const { return mInstanceName.empty(); }
+
+        std::string mType;
+        std::string mInstanceName;
+        Name        mName; // The name of the PTR records of the type, or the name of the instance.
+
+        // The instances which have been reported, keyed by the lowercase instance name.
+        std::map<Name, DiscoveredInstanceInfo> mInstances;
+
+        // The instances which are known but not resolved yet.
+        std::set<Name> mUnresolvedInstances;
+
+        Timepoint    mQueryTime;
+        Milliseconds mQueryInterval;
+    };
+
+    struct HostSubscription
+    {
+        explicit HostSubscription(std::string aHostName);
+
+        std::string        mHostName;
+        Name               mName;
+        DiscoveredHostInfo mHostInfo;
+        Timepoint          mQueryTime;
+        Milliseconds       mQueryInterval;
+    };
+
+    typedef std::vector<std::unique_ptr<ServiceSubscription>> ServiceSubscriptionList;
+    typedef std::vector<std::unique_ptr<HostSubscription>>    HostSubscriptionList;
+
+    otbrError LoadNetifs(void);
+    otbrError OpenSockets(void);
+    void      CloseSockets(void);
+    void      UpdateLocalHost(void);
+
+    void AddEntry(Entry &aEntry);
+    void RemoveEntry(Entry &aEntry);
+    void ProcessEntryResults(void);
+
+    void ScheduleTimer(void);
+    void HandleTimer(void);
+    void ProcessEntries(Timepoint aNow);
+    void ProcessQueries(Timepoint aNow);
+    void ProcessCacheExpiry(Timepoint aNow);
+    void AddQuestions(const ServiceSubscription &aSubscription, std::vector<Question> &aQuestions) const;
+
+    void HandleSocketReadable(int aSocket);
+    void HandleMessage(const Message &aMessage, uint32_t aNetifIndex, const SocketAddress &aSender);
+    void HandleQuery(const Message &aMessage, uint32_t aNetifIndex, const SocketAddress &aSender, bool aLegacyUnicast);
+    void HandleProbe(const Message &aMessage);
+    void HandleResponse(const Message &aMessage, uint32_t aNetifIndex);
+    void CheckConflict(const ResourceRecord &aRecord, Timepoint aNow);
+
+    bool UpdateCache(const ResourceRecord &aRecord, uint32_t aNetifIndex, Timepoint aNow);
+    const std::vector<CachedRecord> *FindCachedRecords(const Name &aName, uint16_t aType) const;
+    bool ResolveInstance(const Name &aInstanceName, DiscoveredInstanceInfo &aInstanceInfo) const;
+    void ResolveAddresses(const Name &aHostName, AddressList &aAddresses, uint32_t &aTtl) const;
+
+    void EvaluateSubscriptions(void);
+    void EvaluateServiceSubscription(ServiceSubscription                                         &aSubscription,
+                                     std::vector<std::pair<std::string, DiscoveredInstanceInfo>> &aInstances);
+    void EvaluateHostSubscription(HostSubscription                                        &aSubscription,
+                                  std::vector<std::pair<std::string, DiscoveredHostInfo>> &aHosts);
+
+    void FindAnswers(const Question &aQuestion, std::vector<Record *> &aAnswers);
+    void AddAdditionalRecords(const Record &aAnswer, std::vector<Record *> &aAdditionals);
+    void AddKnownAnswers(const Question &aQuestion, Timepoint aNow, Message &aQuery) const;
+
+    void SendProbe(const Entry &aEntry);
+    void SendAnnouncement(Entry &aEntry, bool aGoodbye);
+    void SendQuery(const std::vector<Question> &aQuestions, Timepoint aNow);
+    void SendMessage(const Message &aMessage);
+    void SendMessage(const Message &aMessage, uint32_t aNetifIndex, const SocketAddress *aDestination);
+    void SendPacket(const std::vector<uint8_t> &aPacket, uint32_t aNetifIndex, const SocketAddress &aDestination);
+
+    Timepoint RandomTime(Timepoint aBase, Milliseconds aMin, Milliseconds aMax);
+
+    static bool           IsKnownAnswer(const Message &aQuery, const Record &aRecord);
+    static ResourceRecord ToResourceRecord(const Record &aRecord, uint32_t aTtl, bool aCacheFlush);
+    static Name           MakeName(const std::string &aName);
+    static Name           MakeServiceName(const std::string &aInstanceName, const std::string &aType);
+    static Name           MakeKeyName(const std::string &aName);
+    static Name           ToLowerName(Name aName);
+    static bool           NameEquals(const Name &aName1, const Name &aName2);
+    static int            CompareRecordSets(RecordSet &aRecords1, RecordSet &aRecords2);
+    static bool           ParseMessage(const uint8_t *aBuffer, size_t aLength, Message &aMessage);
+    static void           EncodeMessage(const Message &aMessage, std::vector<std::vector<uint8_t>> &aPackets);
+
+    State         mState;
+    StateCallback mStateCallback;
+
+    int                   mSocket4;
+    int                   mSocket6;
+    std::vector<uint32_t> mNetifIndexes;
+
+    std::string                     mHostName;
+    AddressList                     mLocalAddresses6;
+    std::vector<in_addr>            mLocalAddresses4;
+    std::unique_ptr<LocalHostEntry> mLocalHost;
+
+    // The entries which are being probed, announced or have been registered.
+    std::vector<Entry *> mEntries;
+
+    RecordCache             mCache;
+    ServiceSubscriptionList mSubscribedServices;
+    HostSubscriptionList    mSubscribedHosts;
+    bool                    mEvaluationPending; // Whether the subscriptions should be evaluated against the cache.
+
+    MainloopManager::TimerId mTimerId;
+    Timepoint                mTimerFireTime;
+    MainloopManager::TimerId mStateTimerId;
+
+    std::mt19937 mRandom;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+/**
+ * @}
+ */
+#endif // OTBR_AGENT_MDNS_NATIVE_HPP_
@@ -26,14 +26,19 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_TAG "REST"
+
 #include "rest/connection.hpp"
 
+#include <algorithm>
 #include <cerrno>
 
 #include <assert.h>
+#include <string.h>
 
 #include <sys/socket.h>
-#include <sys/time.h>
+
+#include "common/mainloop_manager.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -55,9 +60,15 @@ static const uint32_t kWriteTimeout = 10000000;
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
+Connection::Connection(steady_clock::time_point aStartTime,
+                       Resource                *aResource,
+                       int                      aFd,
+                       CompleteCallback         aCompleteCallback)
     : mTimeStamp(aStartTime)
     , mFd(aFd)
+    , mFdSetsMask(0)
+    , mTimerId(0)
+    , mCompleteCallback(std::move(aCompleteCallback))
     , mState(ConnectionState::kInit)
     , mParser(&mRequest)
     , mResource(aResource)
@@ -66,45 +77,90 @@ Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource,
 
 Connection::~Connection(void)
 {
-    Disconnect();
+    Close();
 }
 
 void Connection::Init(void)
 {
     mParser.Init();
+    UpdateMainloop();
 }
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+void Connection::UpdateMainloop(void)
 {
-    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
+    if (mTimerId != 0)
     {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        MainloopManager::GetInstance().RemoveTimer(mTimerId);
+        mTimerId = 0;
     }
+
+    UpdateFdRegistration();
+
+    VerifyOrExit(!IsComplete());
+
+    mTimerId = MainloopManager::GetInstance().AddTimer(GetTimeout(), [this]() {
+        mTimerId = 0;
+        Process(0);
+    });
+
+exit:
+    return;
 }
 
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
+void Connection::UpdateFdRegistration(void)
 {
-    if (mState == ConnectionState::kWriteWait)
+    otbrError error      = OTBR_ERROR_NONE;
+    uint8_t   fdSetsMask = 0;
+
+    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
+    {
+        fdSetsMask = MainloopContext::kReadFdSet;
+    }
+    else if (mState == ConnectionState::kWriteWait)
+    {
+        fdSetsMask = MainloopContext::kWriteFdSet;
+    }
+
+    VerifyOrExit(mFd != -1 && fdSetsMask != mFdSetsMask);
+
+    if (fdSetsMask == 0)
     {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        MainloopManager::GetInstance().RemoveFd(mFd);
+    }
+    else
+    {
+        error = MainloopManager::GetInstance().AddFd(mFd, fdSetsMask,
+                                                     [this](uint8_t aReadyMask) { Process(aReadyMask); });
+        SuccessOrExit(error);
+    }
+
+    mFdSetsMask = fdSetsMask;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to register connection fd %d: %s", mFd, strerror(errno));
+        Disconnect();
     }
 }
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+Microseconds Connection::GetTimeout(void) const
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    uint32_t timeoutLen = kReadTimeout;
+    auto     duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
     switch (mState)
     {
+    case ConnectionState::kInit:
+        // Read immediately for the first time.
+        timeoutLen = 0;
+        break;
     case ConnectionState::kReadWait:
         timeoutLen = kReadTimeout;
         break;
     case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
+        // The callback timeout is relative to now rather than to the time stamp.
+        timeoutLen = static_cast<uint32_t>(duration + GetCallbackTimeout().count());
         break;
     case ConnectionState::kWriteWait:
         timeoutLen = kWriteTimeout;
@@ -116,42 +172,61 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
         break;
     }
 
-    if (duration <= timeoutLen)
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
-    }
-    else
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
-    }
+    return Microseconds(duration <= timeoutLen ? timeoutLen - duration : 0);
+}
+
+Microseconds Connection::GetCallbackTimeout(void) const
+{
+    // The callback is checked periodically, and also right when the response is expected to complete,
+    // so that a response completing before the next periodic check isn't delayed.
+    steady_clock::time_point now      = steady_clock::now();
+    steady_clock::time_point deadline = std::min(now + microseconds(kCallbackCheckInterval),
+                                                 mTimeStamp + microseconds(kCallbackTimeout));
 
-    if (timercmp(&timeout, &aTimeout, <))
+    if (mResponse.GetCallbackDeadline() > now)
     {
-        aTimeout = timeout;
+        deadline = std::min(deadline, mResponse.GetCallbackDeadline());
     }
+
+    return duration_cast<Microseconds>(std::max(deadline - now, steady_clock::duration::zero()));
 }
 
-void Connection::Update(MainloopContext &aMainloop)
+void Connection::Disconnect(void)
 {
-    UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
+    bool wasComplete = IsComplete();
+
+    Close();
+
+    if (!wasComplete && mCompleteCallback != nullptr)
+    {
+        mCompleteCallback();
+    }
 }
 
-void Connection::Disconnect(void)
+void Connection::Close(void)
 {
     mState = ConnectionState::kComplete;
 
+    if (mTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mTimerId);
+        mTimerId = 0;
+    }
+
     if (mFd != -1)
     {
+        if (mFdSetsMask != 0)
+        {
+            MainloopManager::GetInstance().RemoveFd(mFd);
+            mFdSetsMask = 0;
+        }
+
         close(mFd);
         mFd = -1;
     }
 }
 
-void Connection::Process(const MainloopContext &aMainloop)
+void Connection::Process(uint8_t aFdSetsMask)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -160,14 +235,14 @@ void Connection::Process(const MainloopContext &aMainloop)
     // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aMainloop.mReadFdSet);
+        ProcessWaitRead(aFdSetsMask);
         break;
     case ConnectionState::kCallbackWait:
         //  Wait for Callback process.
         ProcessWaitCallback();
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aMainloop.mWriteFdSet);
+        ProcessWaitWrite(aFdSetsMask);
         break;
     default:
         assert(false);
@@ -177,9 +252,11 @@ void Connection::Process(const MainloopContext &aMainloop)
     {
         Disconnect();
     }
+
+    UpdateMainloop();
 }
 
-void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(uint8_t aFdSetsMask)
 {
     otbrError error    = OTBR_ERROR_NONE;
     int32_t   received = 0, err;
@@ -190,7 +267,7 @@ void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
     VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
 
     // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+    VerifyOrExit((aFdSetsMask & MainloopContext::kReadFdSet) || mState == ConnectionState::kInit);
 
     do
     {
@@ -282,13 +359,13 @@ void Connection::ProcessWaitCallback(void)
     }
 }
 
-void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
+void Connection::ProcessWaitWrite(uint8_t aFdSetsMask)
 {
     auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
     if (duration <= kWriteTimeout)
     {
-        if (FD_ISSET(mFd, &aWriteFdSet))
+        if (aFdSetsMask & MainloopContext::kWriteFdSet)
         {
             Write();
         }
@@ -36,10 +36,12 @@
 
 #include "openthread-br/config.h"
 
+#include <functional>
+
 #include <string.h>
 #include <unistd.h>
 
-#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
 #include "rest/parser.hpp"
 #include "rest/resource.hpp"
 
@@ -51,34 +53,40 @@ namespace rest {
 /**
  * This class implements a Connection class of each socket connection.
  */
-class Connection : public MainloopProcessor
+class Connection : private NonCopyable
 {
 public:
+    /**
+     * This type represents the callback which is invoked when a connection is completed.
+     */
+    typedef std::function<void(void)> CompleteCallback;
+
     /**
      * The constructor is to initialize a socket connection instance.
      *
-     * @param[in] aStartTime  The reference start time of a connection which
-     *                        is set when created for the first time and maybe
-     *                        reset when transfer to wait callback or wait write
-     *                        state.
-     * @param[in] aResource   A pointer to the resource handler.
-     * @param[in] aFd         The file descriptor for the connection.
+     * @param[in] aStartTime         The reference start time of a connection which
+     *                               is set when created for the first time and maybe
+     *                               reset when transfer to wait callback or wait write
+     *                               state.
+     * @param[in] aResource          A pointer to the resource handler.
+     * @param[in] aFd                The file descriptor for the connection.
+     * @param[in] aCompleteCallback  The callback to invoke when the connection is completed.
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd, CompleteCallback aCompleteCallback);
 
     /**
      * The desctructor destroys the connection instance.
      */
-    ~Connection(void) override;
+    ~Connection(void);
 
     /**
      * This method initializes the connection.
+     *
+     * The fd of the connection is registered to the mainloop and the connection is processed only
+     * when the fd is ready or a timeout of the current state expires.
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
-
     /**
      * This method indicates whether this connection no longer need to be processed.
      *
@@ -88,15 +96,18 @@ public:
     bool IsComplete(void) const;
 
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(const fd_set &aReadFdSet);
-    void ProcessWaitCallback(void);
-    void ProcessWaitWrite(const fd_set &aWriteFdSet);
-    void Write(void);
-    void Handle(void);
-    void Disconnect(void);
+    void         UpdateMainloop(void);
+    void         UpdateFdRegistration(void);
+    Microseconds GetTimeout(void) const;
+    Microseconds GetCallbackTimeout(void) const;
+    void         Process(uint8_t aFdSetsMask);
+    void         ProcessWaitRead(uint8_t aFdSetsMask);
+    void         ProcessWaitCallback(void);
+    void         ProcessWaitWrite(uint8_t aFdSetsMask);
+    void         Write(void);
+    void         Handle(void);
+    void         Disconnect(void);
+    void         Close(void);
 
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
@@ -104,6 +115,15 @@ private:
     // File descriptor for this connection
     int mFd;
 
+    // The fd sets which the fd is currently registered to the mainloop with
+    uint8_t mFdSetsMask;
+
+    // The timer for the timeout of the current state
+    MainloopManager::TimerId mTimerId;
+
+    // The callback to invoke when this connection is completed
+    CompleteCallback mCompleteCallback;
+
     // Enum indicates the state of this connection
     ConnectionState mState;
 
@@ -1116,6 +1116,47 @@ std::string JoinerTable2JsonString(const std::vector<otJoinerInfo> &aJoinerTable
     return Json2String(JoinerTable2Json(aJoinerTable));
 }
 
+static cJSON *LatencyHistogram2Json(const LatencyHistogram &aHistogram)
+{
+    cJSON *histogram = cJSON_CreateObject();
+    cJSON *buckets   = cJSON_CreateArray();
+
+    for (uint32_t count : aHistogram.mBuckets)
+    {
+        cJSON_AddItemToArray(buckets, cJSON_CreateNumber(count));
+    }
+
+    cJSON_AddItemToObject(histogram, "Count", cJSON_CreateNumber(aHistogram.mCount));
+    cJSON_AddItemToObject(histogram, "TotalUs", cJSON_CreateNumber(static_cast<double>(aHistogram.mTotalUs)));
+    cJSON_AddItemToObject(histogram, "MaxUs", cJSON_CreateNumber(aHistogram.mMaxUs));
+    cJSON_AddItemToObject(histogram, "Buckets", buckets);
+
+    return histogram;
+}
+
+std::string MainloopStats2JsonString(const std::vector<MainloopProcessorStats> &aStats)
+{
+    cJSON      *stats = cJSON_CreateArray();
+    std::string ret;
+
+    for (const MainloopProcessorStats &processorStats : aStats)
+    {
+        cJSON *processor = cJSON_CreateObject();
+
+        cJSON_AddItemToObject(processor, "Name", cJSON_CreateString(processorStats.mName.c_str()));
+        cJSON_AddItemToObject(processor, "UpdateLatency", LatencyHistogram2Json(processorStats.mUpdateLatency));
+        cJSON_AddItemToObject(processor, "ProcessLatency", LatencyHistogram2Json(processorStats.mProcessLatency));
+        cJSON_AddItemToObject(processor, "DispatchLatency", LatencyHistogram2Json(processorStats.mDispatchLatency));
+        cJSON_AddItemToObject(processor, "StallCount", cJSON_CreateNumber(processorStats.mStallCount));
+        cJSON_AddItemToArray(stats, processor);
+    }
+
+    ret = Json2String(stats);
+    cJSON_Delete(stats);
+
+    return ret;
+}
+
 } // namespace Json
 } // namespace rest
 } // namespace otbr
@@ -260,6 +260,15 @@ bool JsonJoinerInfoString2JoinerInfo(const std::string &aJsonJoinerInfo, otJoine
 
 std::string JoinerTable2JsonString(const std::vector<otJoinerInfo> &aJoinerTable);
 
+/**
+ * This method formats the latency statistics of the mainloop processors to a Json array and serializes it to a string.
+ *
+ * @param[in] aStats  A reference to the statistics of each mainloop processor.
+ *
+ * @returns A string of serialized Json array.
+ */
+std::string MainloopStats2JsonString(const std::vector<MainloopProcessorStats> &aStats);
+
 }; // namespace Json
 
 } // namespace rest
@@ -31,6 +31,8 @@
 #include "rest/resource.hpp"
 #include <openthread/commissioner.h>
 
+#include "common/mainloop_manager.hpp"
+
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
@@ -51,6 +53,7 @@
 #define OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER "/node/commissioner/joiner"
 #define OT_REST_RESOURCE_PATH_NODE_COPROCESSOR "/node/coprocessor"
 #define OT_REST_RESOURCE_PATH_NODE_COPROCESSOR_VERSION "/node/coprocessor/version"
+#define OT_REST_RESOURCE_PATH_NODE_MAINLOOP_STATS "/node/mainloop-stats"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
@@ -151,6 +154,7 @@ Resource::Resource(RcpHost *aHost)
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_STATE, &Resource::CommissionerState);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER, &Resource::CommissionerJoiner);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_COPROCESSOR_VERSION, &Resource::CoprocessorVersion);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_MAINLOOP_STATS, &Resource::MainloopStats);
 
     // Resource callback handler
     mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::HandleDiagnosticCallback);
@@ -1086,6 +1090,26 @@ void Resource::CoprocessorVersion(const Request &aRequest, Response &aResponse)
     }
 }
 
+void Resource::GetMainloopStats(Response &aResponse) const
+{
+    std::string body = Json::MainloopStats2JsonString(MainloopManager::GetInstance().GetProcessorStats());
+
+    aResponse.SetBody(body);
+    aResponse.SetResponsCode(GetHttpStatus(HttpStatusCode::kStatusOk));
+}
+
+void Resource::MainloopStats(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetMainloopStats(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
 void Resource::DeleteOutDatedDiagnostic(void)
 {
     auto eraseIt = mDiagSet.begin();
@@ -1137,6 +1161,7 @@ exit:
     if (error == OTBR_ERROR_NONE)
     {
         aResponse.SetStartTime(steady_clock::now());
+        aResponse.SetCallbackDeadline(aResponse.GetStartTime() + microseconds(kDiagCollectTimeout));
         aResponse.SetCallback();
     }
     else
@@ -70,6 +70,16 @@ steady_clock::time_point Response::GetStartTime() const
     return mStartTime;
 }
 
+void Response::SetCallbackDeadline(steady_clock::time_point aDeadline)
+{
+    mCallbackDeadline = aDeadline;
+}
+
+steady_clock::time_point Response::GetCallbackDeadline() const
+{
+    return mCallbackDeadline;
+}
+
 bool Response::IsComplete()
 {
     return mComplete == true;
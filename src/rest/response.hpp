@@ -129,6 +129,22 @@ public:
      */
     steady_clock::time_point GetStartTime() const;
 
+    /**
+     * This method sets when the callback handler is expected to complete the response.
+     *
+     * The connection checks the response again at this time instead of waiting for its next periodic check.
+     *
+     * @param[in] aDeadline  A timestamp indicates when the callback handler completes the response.
+     */
+    void SetCallbackDeadline(steady_clock::time_point aDeadline);
+
+    /**
+     * This method returns when the callback handler is expected to complete the response.
+     *
+     * @returns A timepoint object indicates the callback deadline, or the epoch if not set.
+     */
+    steady_clock::time_point GetCallbackDeadline() const;
+
     /**
      * This method serialize a response to a string that could be sent by socket later.
      *
@@ -144,6 +160,7 @@ private:
     std::string                        mBody;
     bool                               mComplete;
     steady_clock::time_point           mStartTime;
+    steady_clock::time_point           mCallbackDeadline;
 };
 
 } // namespace rest
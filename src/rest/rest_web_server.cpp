@@ -50,6 +50,7 @@ static const uint32_t kMaxServeNum = 500;
 RestWebServer::RestWebServer(RcpHost &aHost, const std::string &aRestListenAddress, int aRestListenPort)
     : mResource(Resource(&aHost))
     , mListenFd(-1)
+    , mEraseTimerId(0)
 {
     mAddress.sin6_family = AF_INET6;
     mAddress.sin6_addr   = in6addr_any;
@@ -65,8 +66,14 @@ RestWebServer::RestWebServer(RcpHost &aHost, const std::string &aRestListenAddre
 
 RestWebServer::~RestWebServer(void)
 {
+    if (mEraseTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mEraseTimerId);
+    }
+
     if (mListenFd != -1)
     {
+        MainloopManager::GetInstance().RemoveFd(mListenFd);
         close(mListenFd);
     }
 }
@@ -77,48 +84,51 @@ void RestWebServer::Init(void)
     InitializeListenFd();
 }
 
-void RestWebServer::Update(MainloopContext &aMainloop)
+void RestWebServer::HandleListenFdReady(void)
 {
-    aMainloop.AddFdToReadSet(mListenFd);
+    otbrError error = OTBR_ERROR_NONE;
 
-    return;
+    EraseCompletedConnections();
+
+    // Create new connection if the server is not full
+    if (mConnectionSet.size() < kMaxServeNum)
+    {
+        error = Accept(mListenFd);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
+    }
 }
 
-void RestWebServer::Process(const MainloopContext &aMainloop)
+void RestWebServer::HandleConnectionComplete(void)
 {
-    UpdateConnections(aMainloop.mReadFdSet);
+    // The connection can't be released in its own callback, so it's released in a timer later.
+    VerifyOrExit(mEraseTimerId == 0);
+
+    mEraseTimerId = MainloopManager::GetInstance().AddTimer(Microseconds::zero(), [this]() {
+        mEraseTimerId = 0;
+        EraseCompletedConnections();
+    });
+
+exit:
+    return;
 }
 
-void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
+void RestWebServer::EraseCompletedConnections(void)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
-
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
+    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end();)
     {
-        Connection *connection = eraseIt->second.get();
-
-        if (connection->IsComplete())
+        if (it->second->IsComplete())
         {
-            eraseIt = mConnectionSet.erase(eraseIt);
+            it = mConnectionSet.erase(it);
         }
         else
         {
-            eraseIt++;
+            it++;
         }
     }
-
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
-    {
-        error = Accept(mListenFd);
-    }
-
-    if (error != OTBR_ERROR_NONE)
-    {
-        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
-    }
 }
 
 bool RestWebServer::ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr)
@@ -163,6 +173,10 @@ void RestWebServer::InitializeListenFd(void)
     ret = listen(mListenFd, 5);
     VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
+    VerifyOrExit(MainloopManager::GetInstance().AddFd(mListenFd, MainloopContext::kReadFdSet,
+                                                      [this](uint8_t) { HandleListenFdReady(); }) == OTBR_ERROR_NONE,
+                 err = errno, error = OTBR_ERROR_REST, errorMessage = "register listen fd");
+
 exit:
 
     if (error != OTBR_ERROR_NONE)
@@ -207,8 +221,8 @@ exit:
 
 void RestWebServer::CreateNewConnection(int &aFd)
 {
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
+    auto it = mConnectionSet.emplace(aFd, MakeUnique<Connection>(steady_clock::now(), &mResource, aFd,
+                                                                 [this]() { HandleConnectionComplete(); }));
 
     if (it.second == true)
     {
@@ -40,7 +40,7 @@
 #include <netinet/ip.h>
 #include <sys/socket.h>
 
-#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
 #include "rest/connection.hpp"
 
 using otbr::Host::RcpHost;
@@ -52,7 +52,7 @@ namespace rest {
 /**
  * This class implements a REST server.
  */
-class RestWebServer : public MainloopProcessor
+class RestWebServer : private NonCopyable
 {
 public:
     /**
@@ -65,18 +65,17 @@ public:
     /**
      * The destructor destroys the server instance.
      */
-    ~RestWebServer(void) override;
+    ~RestWebServer(void);
 
     /**
      * This method initializes the REST server.
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
-
 private:
-    void      UpdateConnections(const fd_set &aReadFdSet);
+    void      HandleListenFdReady(void);
+    void      HandleConnectionComplete(void);
+    void      EraseCompletedConnections(void);
     void      CreateNewConnection(int32_t &aFd);
     otbrError Accept(int32_t aListenFd);
     bool      ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
@@ -91,6 +90,8 @@ private:
     int32_t mListenFd;
     // Connection List
     std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
+    // Timer for releasing completed connections
+    MainloopManager::TimerId mEraseTimerId;
 };
 
 } // namespace rest
@@ -37,10 +37,11 @@
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
-#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO
-#error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
+#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO && !OTBR_ENABLE_MDNS_NATIVE
+#error "The Advertising Proxy requires an mDNS publisher (Avahi, mDNSResponder, Mojo or native)"
 #endif
 
+#include <algorithm>
 #include <string>
 
 #include <assert.h>
@@ -51,14 +52,29 @@
 
 namespace otbr {
 
+constexpr Milliseconds AdvertisingProxy::kReadvertiseSliceInterval;
+constexpr Milliseconds AdvertisingProxy::kUpdateExpiryGuardTime;
+
 AdvertisingProxy::AdvertisingProxy(Host::RcpHost &aHost, Mdns::Publisher &aPublisher)
     : mHost(aHost)
     , mPublisher(aPublisher)
     , mIsEnabled(false)
     , mAllowMlEid(false)
+    , mMaxInFlightUpdates(kDefaultMaxInFlightUpdates)
+    , mIsDispatching(false)
+    , mReadvertiseTimerId(0)
+    , mReadvertiseInFlight(0)
+{
+    mHost.RegisterResetHandler([this]() {
+        // The SRP updates received before the reset no longer exist on the SRP server.
+        DropPendingUpdates();
+        otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this);
+    });
+}
+
+AdvertisingProxy::~AdvertisingProxy(void)
 {
-    mHost.RegisterResetHandler(
-        [this]() { otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this); });
+    StopReadvertise();
 }
 
 void AdvertisingProxy::SetEnabled(bool aIsEnabled)
@@ -78,6 +94,12 @@ exit:
     return;
 }
 
+void AdvertisingProxy::SetMaxInFlightUpdates(uint16_t aMaxInFlightUpdates)
+{
+    mMaxInFlightUpdates = aMaxInFlightUpdates;
+    DispatchPendingUpdates();
+}
+
 void AdvertisingProxy::Start(void)
 {
     otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this);
@@ -90,12 +112,18 @@ void AdvertisingProxy::Stop(void)
     // Outstanding updates will fail on the SRP server because of timeout.
     // TODO: handle this case gracefully.
 
+    AbortPendingUpdates();
+    StopReadvertise();
+
     // Stop receiving SRP server events.
     if (GetInstance() != nullptr)
     {
         otSrpServerSetServiceUpdateHandler(GetInstance(), nullptr, nullptr);
     }
 
+    // Hosts are fully advertised again after the Advertising Proxy is re-enabled.
+    mAdvertisedHosts.clear();
+
     otbrLogInfo("Stopped");
 }
 
@@ -111,53 +139,209 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                           const otSrpServerHost     *aHost,
                                           uint32_t                   aTimeout)
 {
-    OTBR_UNUSED_VARIABLE(aTimeout);
-
-    OutstandingUpdate *update = nullptr;
-    otbrError          error  = OTBR_ERROR_NONE;
+    Mdns::Publisher::Batch batch;
+    std::string            hostName;
+    bool                   isIncremental;
+    Milliseconds           timeout = Milliseconds(aTimeout);
+    otbrError              error   = OTBR_ERROR_NONE;
 
     VerifyOrExit(IsEnabled());
 
-    mOutstandingUpdates.emplace_back();
-    update      = &mOutstandingUpdates.back();
-    update->mId = aId;
-
-    error = PublishHostAndItsServices(aHost, update);
-
-    if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
+    error = PublishHostAndItsServices(aHost, batch, hostName, isIncremental);
+    if (error != OTBR_ERROR_NONE)
     {
-        mOutstandingUpdates.pop_back();
+        otbrLogInfo("Failed to advertise SRP service updates (id = %u)", aId);
         otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        ExitNow();
     }
 
+    // The SRP server started its timer before calling the handler and frees the host when
+    // the update times out, so a queued update is considered timed out a bit earlier.
+    timeout -= std::min(kUpdateExpiryGuardTime, timeout / 2);
+
+    mPendingUpdates.emplace_back();
+    mPendingUpdates.back().mId            = aId;
+    mPendingUpdates.back().mHost          = aHost;
+    mPendingUpdates.back().mHostName      = std::move(hostName);
+    mPendingUpdates.back().mReceiveTime   = Clock::now();
+    mPendingUpdates.back().mExpireTime    = mPendingUpdates.back().mReceiveTime + timeout;
+    mPendingUpdates.back().mBatch         = std::move(batch);
+    mPendingUpdates.back().mIsIncremental = isIncremental;
+
+    DispatchPendingUpdates();
+
 exit:
     return;
 }
 
-void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
+void AdvertisingProxy::DispatchPendingUpdates(void)
 {
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
+    // Results may be delivered before `PublishBatch` returns, which dispatches pending
+    // updates again. The nested call is skipped and the loop here continues instead.
+    VerifyOrExit(!mIsDispatching);
+    mIsDispatching = true;
+
+    DropExpiredUpdates();
+
+    while (!mPendingUpdates.empty() &&
+           (mMaxInFlightUpdates == 0 || mOutstandingUpdates.size() < mMaxInFlightUpdates))
     {
-        if (update->mId != aUpdateId)
-        {
-            continue;
-        }
+        PendingUpdate              update   = std::move(mPendingUpdates.front());
+        otSrpServerServiceUpdateId id       = update.mId;
+        std::string                hostName = update.mHostName;
+
+        mPendingUpdates.pop_front();
 
-        if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
+        if (update.mIsStale)
         {
-            // Erase before notifying OpenThread, because there are chances that new
-            // elements may be added to `otSrpServerHandleServiceUpdateResult` and
-            // the iterator will be invalidated.
-            mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
+            // A batch of the host failed after the update was received, so its changes are
+            // computed again against what is now known to be advertised.
+            otbrError error;
+
+            // Publishing the earlier updates takes time, and the host is only valid until the update expires.
+            if (update.mExpireTime <= Clock::now())
+            {
+                otbrLogWarning("SRP service updates (id = %u) timed out while queued", id);
+                mUpdateCounters.mExpiredUpdates++;
+                ForgetAdvertisedHost(hostName);
+                continue;
+            }
+
+            update.mBatch = Mdns::Publisher::Batch();
+            error = PublishHostAndItsServices(update.mHost, update.mBatch, update.mHostName, update.mIsIncremental);
+            if (error != OTBR_ERROR_NONE)
+            {
+                otbrLogInfo("Failed to advertise SRP service updates (id = %u)", id);
+                otSrpServerHandleServiceUpdateResult(GetInstance(), id, OtbrErrorToOtError(error));
+                continue;
+            }
         }
-        else
+
+        OutstandingUpdate &outstandingUpdate = mOutstandingUpdates[id];
+
+        outstandingUpdate.mHostName      = std::move(update.mHostName);
+        outstandingUpdate.mReceiveTime   = update.mReceiveTime;
+        outstandingUpdate.mIsIncremental = update.mIsIncremental;
+
+        // The result may be delivered before `PublishBatch` returns, so the
+        // outstanding update must not be accessed after this call.
+        mPublisher.PublishBatch(std::move(update.mBatch),
+                                [this, id, hostName](otbrError aError, const std::vector<otbrError> &) {
+                                    otbrLogResult(aError, "Handle publish SRP host '%s' and its services",
+                                                  hostName.c_str());
+                                    OnMdnsPublishResult(id, aError);
+                                });
+    }
+
+    mIsDispatching = false;
+
+    mUpdateCounters.mQueuedUpdates    = static_cast<uint32_t>(mPendingUpdates.size());
+    mUpdateCounters.mMaxQueuedUpdates = std::max(mUpdateCounters.mMaxQueuedUpdates, mUpdateCounters.mQueuedUpdates);
+    if (!mPendingUpdates.empty())
+    {
+        otbrLogDebug("%zu SRP updates in flight, %zu queued", mOutstandingUpdates.size(), mPendingUpdates.size());
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::DropExpiredUpdates(void)
+{
+    Timepoint                now = Clock::now();
+    std::vector<std::string> hostNames;
+
+    for (auto update = mPendingUpdates.begin(); update != mPendingUpdates.end();)
+    {
+        if (update->mExpireTime > now)
         {
-            --update->mCallbackCount;
-            otbrLogInfo("Waiting for more publishing callbacks %d", update->mCallbackCount);
+            ++update;
+            continue;
         }
-        break;
+
+        // The SRP server has already failed the update and may have freed its host.
+        otbrLogWarning("SRP service updates (id = %u) timed out while queued", update->mId);
+        hostNames.push_back(std::move(update->mHostName));
+        update = mPendingUpdates.erase(update);
+        mUpdateCounters.mExpiredUpdates++;
+    }
+
+    // The later updates of the hosts may only have the changes since the dropped ones.
+    for (const std::string &hostName : hostNames)
+    {
+        ForgetAdvertisedHost(hostName);
+    }
+}
+
+std::deque<AdvertisingProxy::PendingUpdate> AdvertisingProxy::DropPendingUpdates(void)
+{
+    std::deque<PendingUpdate> pendingUpdates = std::move(mPendingUpdates);
+
+    mPendingUpdates.clear();
+    mUpdateCounters.mQueuedUpdates = 0;
+
+    // The batches are never published, so it's unknown what has been advertised for their hosts.
+    for (const PendingUpdate &update : pendingUpdates)
+    {
+        mAdvertisedHosts.erase(update.mHostName);
+    }
+
+    return pendingUpdates;
+}
+
+void AdvertisingProxy::AbortPendingUpdates(void)
+{
+    std::deque<PendingUpdate> pendingUpdates = DropPendingUpdates();
+
+    VerifyOrExit(GetInstance() != nullptr);
+    for (const PendingUpdate &update : pendingUpdates)
+    {
+        otSrpServerHandleServiceUpdateResult(GetInstance(), update.mId, OT_ERROR_ABORT);
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
+{
+    auto        update = mOutstandingUpdates.find(aUpdateId);
+    std::string hostName;
+
+    VerifyOrExit(update != mOutstandingUpdates.end());
+
+    if (aError == OTBR_ERROR_NONE && update->second.mIsStale)
+    {
+        // The batch only has the changes since an earlier batch of the host, which failed. The SRP
+        // update fails, so that the SRP client retries it and the host is then advertised in full.
+        otbrLogInfo("Fail SRP service updates (id = %u) published after a failure of the host", aUpdateId);
+        aError = OTBR_ERROR_ABORTED;
+    }
+
+    mUpdateCounters.mCommitLatency.Record(static_cast<uint64_t>(
+        std::chrono::duration_cast<Microseconds>(Clock::now() - update->second.mReceiveTime).count()));
+
+    // Erase before notifying OpenThread, because there are chances that new
+    // elements may be added to `otSrpServerHandleServiceUpdateResult` and
+    // the iterator will be invalidated.
+    hostName = std::move(update->second.mHostName);
+    mOutstandingUpdates.erase(update);
+
+    if (aError != OTBR_ERROR_NONE)
+    {
+        ForgetAdvertisedHost(hostName);
+    }
+
+    // The Thread host may have been de-initialized while the update was being published.
+    if (GetInstance() != nullptr)
+    {
+        otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
     }
+
+    DispatchPendingUpdates();
+
+exit:
+    return;
 }
 
 std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
@@ -198,134 +382,275 @@ exit:
 
 void AdvertisingProxy::PublishAllHostsAndServices(void)
 {
-    const otSrpServerHost *host = nullptr;
+    // {time since the last update in milliseconds, full host name}
+    std::vector<std::pair<uint32_t, std::string>> hosts;
+    const otSrpServerHost                        *host = nullptr;
 
     VerifyOrExit(IsEnabled());
     VerifyOrExit(mPublisher.IsStarted());
 
-    otbrLogInfo("Publish all hosts and services");
-    while ((host = otSrpServerGetNextHost(GetInstance(), host)))
+    while ((host = otSrpServerGetNextHost(GetInstance(), host)) != nullptr)
     {
-        PublishHostAndItsServices(host, nullptr);
+        uint32_t             timeSinceUpdate = UINT32_MAX;
+        otSrpServerLeaseInfo leaseInfo;
+
+        // Deleted hosts only need to be un-published, so they are ranked last.
+        if (!otSrpServerHostIsDeleted(host))
+        {
+            otSrpServerHostGetLeaseInfo(host, &leaseInfo);
+            timeSinceUpdate = leaseInfo.mLease - leaseInfo.mRemainingLease;
+        }
+        hosts.emplace_back(timeSinceUpdate, otSrpServerHostGetFullName(host));
     }
 
+    StartReadvertise(std::move(hosts));
+
 exit:
     return;
 }
 
-otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate)
+void AdvertisingProxy::StartReadvertise(std::vector<std::pair<uint32_t, std::string>> aHosts)
+{
+    StopReadvertise();
+    mAdvertisedHosts.clear();
+
+    // The most recently updated hosts are published first.
+    std::stable_sort(aHosts.begin(), aHosts.end(),
+                     [](const std::pair<uint32_t, std::string> &aLhs, const std::pair<uint32_t, std::string> &aRhs) {
+                         return aLhs.first < aRhs.first;
+                     });
+    for (auto &entry : aHosts)
+    {
+        mReadvertiseQueue.push_back(std::move(entry.second));
+    }
+
+    mReadvertiseProgress.mIsRunning      = true;
+    mReadvertiseProgress.mTotalHosts     = static_cast<uint32_t>(mReadvertiseQueue.size());
+    mReadvertiseProgress.mPublishedHosts = 0;
+    mReadvertiseBeginTime                = Clock::now();
+
+    otbrLogInfo("Publish all %u hosts and services", mReadvertiseProgress.mTotalHosts);
+    PublishNextSlice();
+}
+
+void AdvertisingProxy::PublishNextSlice(void)
 {
-    otbrError                  error = OTBR_ERROR_NONE;
-    std::string                hostName;
-    std::string                hostDomain;
-    const otIp6Address        *hostAddresses;
-    uint8_t                    hostAddressNum;
-    bool                       hostDeleted;
-    const otSrpServerService  *service;
-    otSrpServerServiceUpdateId updateId     = 0;
-    bool                       hasUpdate    = false;
-    std::string                fullHostName = otSrpServerHostGetFullName(aHost);
+    std::vector<std::string>                       slice;
+    std::map<std::string, const otSrpServerHost *> sliceHosts;
+    const otSrpServerHost                         *host       = nullptr;
+    size_t                                         foundHosts = 0;
+
+    mReadvertiseTimerId = 0;
+
+    if (!IsEnabled() || !mPublisher.IsStarted())
+    {
+        otbrLogInfo("Stop publishing all hosts and services: the mDNS publisher is not ready");
+        StopReadvertise();
+        ExitNow();
+    }
+
+    if (mReadvertiseQueue.empty())
+    {
+        otbrLogInfo("Published all %u hosts and services in %lld ms", mReadvertiseProgress.mPublishedHosts,
+                    static_cast<long long>(
+                        std::chrono::duration_cast<Milliseconds>(Clock::now() - mReadvertiseBeginTime).count()));
+        StopReadvertise();
+        ExitNow();
+    }
+
+    slice = TakeReadvertiseSlice();
+    VerifyOrExit(!slice.empty());
+    VerifyOrExit(GetInstance() != nullptr);
+
+    for (const std::string &fullHostName : slice)
+    {
+        sliceHosts.emplace(fullHostName, nullptr);
+    }
+    // The hosts are looked up by name, because the SRP server may have removed some of them since
+    // the re-advertisement started.
+    while (foundHosts < sliceHosts.size() && (host = otSrpServerGetNextHost(GetInstance(), host)) != nullptr)
+    {
+        auto sliceHost = sliceHosts.find(otSrpServerHostGetFullName(host));
+
+        if (sliceHost != sliceHosts.end())
+        {
+            sliceHost->second = host;
+            foundHosts++;
+        }
+    }
+
+    for (const std::string &fullHostName : slice)
+    {
+        Mdns::Publisher::Batch batch;
+        std::string            hostName;
+        bool                   isIncremental;
+
+        host = sliceHosts[fullHostName];
+        if (host == nullptr)
+        {
+            continue;
+        }
+
+        if (PublishHostAndItsServices(host, batch, hostName, isIncremental) != OTBR_ERROR_NONE)
+        {
+            continue;
+        }
+
+        mReadvertiseInFlight++;
+        mPublisher.PublishBatch(std::move(batch), [this, hostName](otbrError aError, const std::vector<otbrError> &) {
+            mReadvertiseInFlight--;
+            if (aError != OTBR_ERROR_NONE)
+            {
+                otbrLogWarning("Failed to publish SRP host '%s' and its services: %s", hostName.c_str(),
+                               otbrErrorString(aError));
+                ForgetAdvertisedHost(hostName);
+            }
+        });
+    }
+
+    otbrLogDebug("Published %u of %u hosts and services", mReadvertiseProgress.mPublishedHosts,
+                 mReadvertiseProgress.mTotalHosts);
+
+exit:
+    if (mReadvertiseProgress.mIsRunning && mReadvertiseTimerId == 0)
+    {
+        mReadvertiseTimerId =
+            MainloopManager::GetInstance().AddTimer(kReadvertiseSliceInterval, [this]() { PublishNextSlice(); });
+    }
+}
+
+std::vector<std::string> AdvertisingProxy::TakeReadvertiseSlice(void)
+{
+    std::vector<std::string> slice;
+    uint16_t                 sliceSize = kReadvertiseHostsPerSlice;
+
+    // Waits for earlier hosts to complete if the in-flight budget is used up.
+    VerifyOrExit(mReadvertiseInFlight < kMaxReadvertiseInFlight);
+    if (kMaxReadvertiseInFlight - mReadvertiseInFlight < sliceSize)
+    {
+        sliceSize = kMaxReadvertiseInFlight - mReadvertiseInFlight;
+    }
+
+    while (!mReadvertiseQueue.empty() && slice.size() < sliceSize)
+    {
+        slice.push_back(std::move(mReadvertiseQueue.front()));
+        mReadvertiseQueue.pop_front();
+    }
+
+    // The hosts which the SRP server has removed since are done as well.
+    mReadvertiseProgress.mPublishedHosts += static_cast<uint32_t>(slice.size());
+
+exit:
+    return slice;
+}
+
+void AdvertisingProxy::StopReadvertise(void)
+{
+    if (mReadvertiseTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mReadvertiseTimerId);
+        mReadvertiseTimerId = 0;
+    }
+    mReadvertiseQueue.clear();
+    mReadvertiseProgress.mIsRunning = false;
+}
+
+otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost  *aHost,
+                                                      Mdns::Publisher::Batch &aBatch,
+                                                      std::string            &aHostName,
+                                                      bool                   &aIsIncremental)
+{
+    otbrError                 error = OTBR_ERROR_NONE;
+    std::string               hostDomain;
+    const otIp6Address       *hostAddresses;
+    uint8_t                   hostAddressNum;
+    bool                      hostDeleted;
+    const otSrpServerService *service;
+    std::string               fullHostName = otSrpServerHostGetFullName(aHost);
+    Mdns::Publisher::Batch    batch;
+    auto                      advertisedHost = mAdvertisedHosts.end();
 
     otbrLogInfo("Advertise SRP service updates: host=%s", fullHostName.c_str());
 
-    SuccessOrExit(error = SplitFullHostName(fullHostName, hostName, hostDomain));
+    SuccessOrExit(error = SplitFullHostName(fullHostName, aHostName, hostDomain));
     hostAddresses = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
     hostDeleted   = otSrpServerHostIsDeleted(aHost);
 
-    if (aUpdate)
+    advertisedHost = mAdvertisedHosts.find(aHostName);
+    aIsIncremental = (advertisedHost != mAdvertisedHosts.end());
+    if (!aIsIncremental)
     {
-        hasUpdate = true;
-        updateId  = aUpdate->mId;
-        aUpdate->mCallbackCount++;
-        aUpdate->mHostName = hostName;
-        service            = nullptr;
-        while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
-        {
-            aUpdate->mCallbackCount++;
-        }
+        advertisedHost = mAdvertisedHosts.emplace(aHostName, AdvertisedHost()).first;
     }
 
+    // The operations are staged in a local batch so that nothing of this host is added
+    // to @p aBatch if any of the names fails to parse.
     service = nullptr;
     while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
     {
         std::string fullServiceName = otSrpServerServiceGetInstanceName(service);
-        std::string serviceName;
-        std::string serviceType;
-        std::string serviceDomain;
+        DnsNameView serviceNameView = ParseFullDnsName(DnsNameSpan(fullServiceName));
 
-        SuccessOrExit(error = SplitFullServiceInstanceName(fullServiceName, serviceName, serviceType, serviceDomain));
+        // The name components are only copied for the services which have changed.
+        VerifyOrExit(serviceNameView.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
 
         if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
         {
-            Mdns::Publisher::TxtData     txtData     = MakeTxtData(service);
-            Mdns::Publisher::SubTypeList subTypeList = MakeSubTypeList(service);
+            // The mDNS implementation may drop a registration after it was established, e.g. on a
+            // name conflict, so an unchanged service is only skipped while it's still registered.
+            if (!UpdateAdvertisedService(advertisedHost->second, aIsIncremental, fullServiceName,
+                                         /* aIsDeleted */ false, ComputeServiceDigest(service)) &&
+                mPublisher.IsServiceRegistered(serviceNameView.mInstanceName.ToString(),
+                                               serviceNameView.mServiceName.ToString()))
+            {
+                continue;
+            }
 
             otbrLogDebug("Publish SRP service '%s'", fullServiceName.c_str());
-            mPublisher.PublishService(
-                hostName, serviceName, serviceType, subTypeList, otSrpServerServiceGetPort(service), txtData,
-                [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
-                    otbrLogResult(aError, "Handle publish SRP service '%s'", fullServiceName.c_str());
-                    if (hasUpdate)
-                    {
-                        OnMdnsPublishResult(updateId, aError);
-                    }
-                });
+            batch.PublishService(aHostName, serviceNameView.mInstanceName.ToString(),
+                                 serviceNameView.mServiceName.ToString(), MakeSubTypeList(service),
+                                 otSrpServerServiceGetPort(service), MakeTxtData(service));
         }
         else
         {
+            if (!UpdateAdvertisedService(advertisedHost->second, aIsIncremental, fullServiceName,
+                                         /* aIsDeleted */ true, /* aDigest */ 0))
+            {
+                continue;
+            }
+
             otbrLogDebug("Unpublish SRP service '%s'", fullServiceName.c_str());
-            mPublisher.UnpublishService(
-                serviceName, serviceType, [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
-                    // Treat `NOT_FOUND` as success when unpublishing service
-                    aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
-                    otbrLogResult(aError, "Handle unpublish SRP service '%s'", fullServiceName.c_str());
-                    if (hasUpdate)
-                    {
-                        OnMdnsPublishResult(updateId, aError);
-                    }
-                });
+            batch.UnpublishService(serviceNameView.mInstanceName.ToString(), serviceNameView.mServiceName.ToString());
         }
     }
 
     if (!hostDeleted)
     {
-        std::vector<Ip6Address> addresses;
-
         // TODO: select a preferred address or advertise all addresses from SRP client.
-        otbrLogDebug("Publish SRP host '%s'", fullHostName.c_str());
-
-        addresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
-        mPublisher.PublishHost(
-            hostName, addresses,
-            Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, fullHostName](otbrError aError) {
-                otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
-                if (hasUpdate)
-                {
-                    OnMdnsPublishResult(updateId, aError);
-                }
-            }));
+        std::vector<Ip6Address> addresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
+
+        if (UpdateAdvertisedAddresses(advertisedHost->second, aIsIncremental, addresses) ||
+            (!addresses.empty() && !mPublisher.IsHostRegistered(aHostName)))
+        {
+            otbrLogDebug("Publish SRP host '%s'", fullHostName.c_str());
+            batch.PublishHost(aHostName, std::move(addresses));
+        }
     }
     else
     {
         otbrLogDebug("Unpublish SRP host '%s'", fullHostName.c_str());
-        mPublisher.UnpublishHost(hostName, [this, hasUpdate, updateId, fullHostName](otbrError aError) {
-            // Treat `NOT_FOUND` as success when unpublishing host.
-            aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
-            otbrLogResult(aError, "Handle unpublish SRP host '%s'", fullHostName.c_str());
-            if (hasUpdate)
-            {
-                OnMdnsPublishResult(updateId, aError);
-            }
-        });
+        batch.UnpublishHost(aHostName);
     }
 
+    otbrLogDebug("Advertise %zu changes of SRP host '%s'", batch.GetSize(), fullHostName.c_str());
+    aBatch.Append(std::move(batch));
+
 exit:
-    if (error != OTBR_ERROR_NONE)
+    if (advertisedHost != mAdvertisedHosts.end() && (error != OTBR_ERROR_NONE || hostDeleted))
     {
-        if (hasUpdate)
-        {
-            otbrLogInfo("Failed to advertise SRP service updates (id = %u)", updateId);
-        }
+        // Forgets the snapshot if the host is deleted, or if it may be inconsistent with the
+        // advertised host because of failing to parse the names.
+        mAdvertisedHosts.erase(advertisedHost);
     }
     return error;
 }
@@ -358,6 +683,114 @@ exit:
     return subTypeList;
 }
 
+bool AdvertisingProxy::UpdateAdvertisedService(AdvertisedHost    &aAdvertisedHost,
+                                               bool               aIsIncremental,
+                                               const std::string &aFullServiceName,
+                                               bool               aIsDeleted,
+                                               uint64_t           aDigest)
+{
+    bool isChanged;
+
+    if (!aIsDeleted)
+    {
+        auto result = aAdvertisedHost.mServiceDigests.emplace(aFullServiceName, aDigest);
+
+        isChanged            = !aIsIncremental || result.second || result.first->second != aDigest;
+        result.first->second = aDigest;
+    }
+    else
+    {
+        // Unless the host is advertised in full, a deleted service is only un-published if it was advertised.
+        isChanged = (aAdvertisedHost.mServiceDigests.erase(aFullServiceName) != 0) || !aIsIncremental;
+    }
+
+    return isChanged;
+}
+
+bool AdvertisingProxy::UpdateAdvertisedAddresses(AdvertisedHost                &aAdvertisedHost,
+                                                 bool                           aIsIncremental,
+                                                 const std::vector<Ip6Address> &aAddresses)
+{
+    bool isChanged = !aIsIncremental || aAddresses != aAdvertisedHost.mAddresses;
+
+    if (isChanged)
+    {
+        aAdvertisedHost.mAddresses = aAddresses;
+    }
+
+    return isChanged;
+}
+
+void AdvertisingProxy::ForgetAdvertisedHost(const std::string &aHostName)
+{
+    // It's unknown which part of the host has been advertised, so the host is advertised in full
+    // on its next update. The other batches of the host which only have the changes since an
+    // earlier update may then be incomplete: the queued ones are rebuilt before being published,
+    // and the in-flight ones fail when they complete.
+    mAdvertisedHosts.erase(aHostName);
+
+    for (auto &entry : mOutstandingUpdates)
+    {
+        if (entry.second.mIsIncremental && entry.second.mHostName == aHostName)
+        {
+            entry.second.mIsStale = true;
+        }
+    }
+
+    for (PendingUpdate &update : mPendingUpdates)
+    {
+        if (update.mIsIncremental && update.mHostName == aHostName)
+        {
+            update.mIsStale = true;
+        }
+    }
+}
+
+uint64_t AdvertisingProxy::ComputeServiceDigest(const otSrpServerService *aSrpService)
+{
+    // FNV-1a over the port, the sub-types and the TXT data of the service, which
+    // together with its names are everything advertised for the service.
+    static constexpr uint64_t kOffsetBasis = 14695981039346656037ULL;
+    static constexpr uint64_t kPrime       = 1099511628211ULL;
+
+    uint64_t       digest = kOffsetBasis;
+    uint16_t       port   = otSrpServerServiceGetPort(aSrpService);
+    uint16_t       subTypeCount;
+    const uint8_t *txtData;
+    uint16_t       txtLength = 0;
+
+    auto update = [&digest](uint8_t aByte) { digest = (digest ^ aByte) * kPrime; };
+
+    update(static_cast<uint8_t>(port >> 8));
+    update(static_cast<uint8_t>(port & 0xff));
+
+    for (subTypeCount = 0;; subTypeCount++)
+    {
+        const char *subTypeName = otSrpServerServiceGetSubTypeServiceNameAt(aSrpService, subTypeCount);
+
+        if (subTypeName == nullptr)
+        {
+            break;
+        }
+
+        // The null character separates the sub-type names.
+        do
+        {
+            update(static_cast<uint8_t>(*subTypeName));
+        } while (*subTypeName++ != '\0');
+    }
+    update(static_cast<uint8_t>(subTypeCount >> 8));
+    update(static_cast<uint8_t>(subTypeCount & 0xff));
+
+    txtData = otSrpServerServiceGetTxtData(aSrpService, &txtLength);
+    for (uint16_t i = 0; i < txtLength; i++)
+    {
+        update(txtData[i]);
+    }
+
+    return digest;
+}
+
 } // namespace otbr
 
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
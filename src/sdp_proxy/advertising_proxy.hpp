@@ -40,10 +40,19 @@
 
 #include <stdint.h>
 
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
 #include "common/code_utils.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
 #include "host/rcp_host.hpp"
 #include "mdns/mdns.hpp"
 
@@ -55,6 +64,29 @@ namespace otbr {
 class AdvertisingProxy : public Mdns::StateObserver, private NonCopyable
 {
 public:
+    static constexpr uint16_t kDefaultMaxInFlightUpdates = 16; ///< The default max number of in-flight SRP updates.
+
+    /**
+     * This structure represents the counters of SRP updates handled by the Advertising Proxy.
+     */
+    struct UpdateCounters
+    {
+        uint32_t         mQueuedUpdates    = 0; ///< The number of SRP updates waiting for an in-flight slot.
+        uint32_t         mMaxQueuedUpdates = 0; ///< The max number of SRP updates which have waited at the same time.
+        uint32_t         mExpiredUpdates   = 0; ///< The number of queued SRP updates which timed out on the SRP server.
+        LatencyHistogram mCommitLatency;        ///< The latencies from receiving SRP updates to committing them.
+    };
+
+    /**
+     * This structure represents the progress of re-advertising all hosts and services.
+     */
+    struct ReadvertiseProgress
+    {
+        bool     mIsRunning      = false; ///< Whether the re-advertisement is running.
+        uint32_t mTotalHosts     = 0;     ///< The number of SRP hosts when the re-advertisement started.
+        uint32_t mPublishedHosts = 0;     ///< The number of SRP hosts which have been re-advertised or removed.
+    };
+
     /**
      * This constructor initializes the Advertising Proxy object.
      *
@@ -63,6 +95,8 @@ public:
      */
     explicit AdvertisingProxy(Host::RcpHost &aHost, Mdns::Publisher &aPublisher);
 
+    ~AdvertisingProxy(void) override;
+
     /**
      * This method enables/disables the Advertising Proxy.
      *
@@ -73,11 +107,38 @@ public:
     /** Sets `true` to allow advertising ML-EID. */
     void SetAllowMlEid(bool aAllowMlEid) { mAllowMlEid = aAllowMlEid; }
 
+    /**
+     * This method sets the max number of SRP updates which are being published at the same time.
+     *
+     * SRP updates beyond the limit are queued, and published in the order they were received
+     * when earlier updates complete. Queued updates which the SRP server has timed out are dropped.
+     *
+     * @param[in] aMaxInFlightUpdates  The max number of in-flight SRP updates, or 0 for no limit.
+     */
+    void SetMaxInFlightUpdates(uint16_t aMaxInFlightUpdates);
+
+    /**
+     * This method returns the counters of SRP updates.
+     *
+     * @returns The counters of SRP updates.
+     */
+    const UpdateCounters &GetUpdateCounters(void) const { return mUpdateCounters; }
+
     /**
      * This method publishes all registered hosts and services.
+     *
+     * The hosts are published incrementally in slices on later mainloop iterations, with the most recently
+     * updated hosts first. A re-advertisement which is running is restarted.
      */
     void PublishAllHostsAndServices(void);
 
+    /**
+     * This method returns the progress of re-advertising all hosts and services.
+     *
+     * @returns The progress of the latest re-advertisement.
+     */
+    const ReadvertiseProgress &GetReadvertiseProgress(void) const { return mReadvertiseProgress; }
+
     /**
      * This method handles mDNS publisher's state changes.
      *
@@ -86,11 +147,39 @@ public:
     void HandleMdnsState(Mdns::Publisher::State aState) override;
 
 private:
+    friend class AdvertisingProxyTest;
+
+    static constexpr uint16_t     kReadvertiseHostsPerSlice = 8;                 // Max SRP hosts published per slice.
+    static constexpr Milliseconds kReadvertiseSliceInterval = Milliseconds(50);  // The interval between slices.
+    static constexpr uint16_t     kMaxReadvertiseInFlight   = 32;                // Max SRP hosts being published.
+    static constexpr Milliseconds kUpdateExpiryGuardTime    = Milliseconds(500); // Margin before SRP update timeout.
+
     struct OutstandingUpdate
     {
-        otSrpServerServiceUpdateId mId;                // The ID of the SRP service update transaction.
-        std::string                mHostName;          // The host name.
-        uint32_t                   mCallbackCount = 0; // The number of callbacks which we are waiting for.
+        std::string mHostName;              // The host name.
+        Timepoint   mReceiveTime;           // The time when the SRP update was received.
+        bool        mIsIncremental = false; // Whether only the changes of the host are published.
+        bool        mIsStale       = false; // Whether a batch of the host failed while this one was in flight.
+    };
+
+    struct PendingUpdate
+    {
+        otSrpServerServiceUpdateId mId;                    // The ID of the SRP service update transaction.
+        const otSrpServerHost     *mHost;                  // The SRP host, only valid before `mExpireTime`.
+        std::string                mHostName;              // The host name.
+        Timepoint                  mReceiveTime;           // The time when the SRP update was received.
+        Timepoint                  mExpireTime;            // The time when the update is considered timed out.
+        Mdns::Publisher::Batch     mBatch;                 // The operations to publish the SRP update.
+        bool                       mIsIncremental = false; // Whether only the changes of the host are published.
+        bool                       mIsStale       = false; // Whether a batch of the host failed, so it's rebuilt.
+    };
+
+    // A compact snapshot of what has been advertised for an SRP host, which is used to publish
+    // only the changes of a host and its services.
+    struct AdvertisedHost
+    {
+        std::vector<Ip6Address>         mAddresses;      // The advertised addresses.
+        std::map<std::string, uint64_t> mServiceDigests; // Full service instance name -> digest of the service.
     };
 
     static void AdvertisingHandler(otSrpServerServiceUpdateId aId,
@@ -101,7 +190,25 @@ private:
 
     static Mdns::Publisher::TxtData     MakeTxtData(const otSrpServerService *aSrpService);
     static Mdns::Publisher::SubTypeList MakeSubTypeList(const otSrpServerService *aSrpService);
+    static uint64_t                     ComputeServiceDigest(const otSrpServerService *aSrpService);
+    static bool                         UpdateAdvertisedService(AdvertisedHost    &aAdvertisedHost,
+                                                                bool               aIsIncremental,
+                                                                const std::string &aFullServiceName,
+                                                                bool               aIsDeleted,
+                                                                uint64_t           aDigest);
+    static bool                         UpdateAdvertisedAddresses(AdvertisedHost                &aAdvertisedHost,
+                                                                  bool                           aIsIncremental,
+                                                                  const std::vector<Ip6Address> &aAddresses);
+    void                                ForgetAdvertisedHost(const std::string &aHostName);
     void                                OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError);
+    void                                DispatchPendingUpdates(void);
+    void                                DropExpiredUpdates(void);
+    std::deque<PendingUpdate>           DropPendingUpdates(void);
+    void                                AbortPendingUpdates(void);
+    void                                StartReadvertise(std::vector<std::pair<uint32_t, std::string>> aHosts);
+    void                                PublishNextSlice(void);
+    std::vector<std::string>            TakeReadvertiseSlice(void);
+    void                                StopReadvertise(void);
 
     std::vector<Ip6Address> GetEligibleAddresses(const otIp6Address *aHostAddresses, uint8_t aHostAddressNum);
 
@@ -110,18 +217,23 @@ private:
     bool IsEnabled(void) const { return mIsEnabled; }
 
     /**
-     * This method publishes a specified host and its services.
+     * This method adds the operations which publish a specified host and its services to a batch.
      *
-     * It also makes a OutstandingUpdate object when needed.
+     * If the host has been advertised, only the host and services which changed since they were last
+     * advertised, or which are no longer registered with the mDNS publisher, are added to the batch.
      *
-     * @param[in]  aHost         A pointer to the host.
-     * @param[in]  aUpdate       A pointer to the output OutstandingUpdate object. When it's not null, the method will
-     *                           fill its fields, otherwise it's ignored.
+     * @param[in]    aHost           A pointer to the host.
+     * @param[inout] aBatch          The batch to add the operations to.
+     * @param[out]   aHostName       The host name without domain.
+     * @param[out]   aIsIncremental  Whether only the changes of the host and its services are added.
      *
-     * @retval  OTBR_ERROR_NONE  Successfully published the host and its services.
-     * @retval  ...              Failed to publish the host and/or its services.
+     * @retval  OTBR_ERROR_NONE  Successfully added the operations of the host and its services.
+     * @retval  ...              Failed to parse the names of the host and/or its services.
      */
-    otbrError PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate);
+    otbrError PublishHostAndItsServices(const otSrpServerHost  *aHost,
+                                        Mdns::Publisher::Batch &aBatch,
+                                        std::string            &aHostName,
+                                        bool                   &aIsIncremental);
 
     otInstance *GetInstance(void) { return mHost.GetInstance(); }
 
@@ -134,8 +246,23 @@ private:
     bool mIsEnabled;
     bool mAllowMlEid;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // SRP updates which are being published, by the ID of the SRP service update transaction.
+    std::unordered_map<otSrpServerServiceUpdateId, OutstandingUpdate> mOutstandingUpdates;
+    // SRP updates which are waiting for an in-flight slot, in the order they were received.
+    std::deque<PendingUpdate> mPendingUpdates;
+    uint16_t                  mMaxInFlightUpdates;
+    bool                      mIsDispatching;
+    UpdateCounters            mUpdateCounters;
+
+    // The full names of the SRP hosts left to the running re-advertisement, most recently updated first.
+    std::deque<std::string>  mReadvertiseQueue;
+    MainloopManager::TimerId mReadvertiseTimerId;
+    uint16_t                 mReadvertiseInFlight;
+    Timepoint                mReadvertiseBeginTime;
+    ReadvertiseProgress      mReadvertiseProgress;
+
+    // Host name -> what has been advertised for the host.
+    std::map<std::string, AdvertisedHost> mAdvertisedHosts;
 };
 
 } // namespace otbr
@@ -48,15 +48,12 @@
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
 #include "utils/dns_utils.hpp"
-#include "utils/string_utils.hpp"
 
 namespace otbr {
 namespace Dnssd {
 
-static inline bool DnsLabelsEqual(const std::string &aLabel1, const std::string &aLabel2)
-{
-    return StringUtils::EqualCaseInsensitive(aLabel1, aLabel2);
-}
+constexpr Milliseconds DiscoveryProxy::kSubscriptionLingerTime;
+constexpr uint8_t      DiscoveryProxy::kCacheRefreshPercent;
 
 DiscoveryProxy::DiscoveryProxy(Host::RcpHost &aHost, Mdns::Publisher &aPublisher)
     : mHost(aHost)
@@ -66,9 +63,24 @@ DiscoveryProxy::DiscoveryProxy(Host::RcpHost &aHost, Mdns::Publisher &aPublisher
     mHost.RegisterResetHandler([this]() {
         otDnssdQuerySetCallbacks(mHost.GetInstance(), &DiscoveryProxy::OnDiscoveryProxySubscribe,
                                  &DiscoveryProxy::OnDiscoveryProxyUnsubscribe, this);
+        // The queries are gone with the reset, keep the cache until the subscriptions expire.
+        ReleaseSubscriptionReferences();
     });
 }
 
+DiscoveryProxy::~DiscoveryProxy(void)
+{
+    if (mCacheAnswerTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mCacheAnswerTimerId);
+    }
+
+    if (mMaintenanceTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mMaintenanceTimerId);
+    }
+}
+
 void DiscoveryProxy::SetEnabled(bool aIsEnabled)
 {
     VerifyOrExit(IsEnabled() != aIsEnabled);
@@ -85,6 +97,36 @@ exit:
     return;
 }
 
+void DiscoveryProxy::HandleMdnsState(Mdns::Publisher::State aState)
+{
+    VerifyOrExit(IsEnabled());
+    VerifyOrExit(aState == Mdns::Publisher::State::kReady);
+
+    otbrLogInfo("mDNS publisher is ready, resubscribe %zu entries", mSubscriptions.size());
+
+    // The cached answers may have changed while the publisher was not ready, so they are discovered again.
+    mPendingCacheAnswers.clear();
+
+    for (auto &subscription : mSubscriptions)
+    {
+        subscription.second.mAnswers.clear();
+
+        // Each entry holds one reference to the publisher's subscription. The publisher drops its
+        // subscriptions when it's stopped, but keeps them when it only becomes ready again.
+        if (IsMdnsSubscribed(subscription.second))
+        {
+            RequeryMdns(subscription.second);
+        }
+        else
+        {
+            SubscribeMdns(subscription.second);
+        }
+    }
+
+exit:
+    return;
+}
+
 void DiscoveryProxy::Start(void)
 {
     assert(mSubscriberId == 0);
@@ -93,14 +135,11 @@ void DiscoveryProxy::Start(void)
                              &DiscoveryProxy::OnDiscoveryProxyUnsubscribe, this);
 
     mSubscriberId = mMdnsPublisher.AddSubscriptionCallbacks(
-        [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
-            if (!aInstanceInfo.mRemoved)
-            {
-                OnServiceDiscovered(aType, aInstanceInfo);
-            }
+        [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+            OnServiceDiscovered(aType, aInstanceInfo);
         },
 
-        [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo) {
+        [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfoPtr &aHostInfo) {
             OnHostDiscovered(aHostName, aHostInfo);
         });
 
@@ -117,6 +156,8 @@ void DiscoveryProxy::Stop(void)
         mSubscriberId = 0;
     }
 
+    ClearSubscriptions();
+
     otbrLogInfo("Stopped");
 }
 
@@ -127,22 +168,26 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(void *aContext, const char *aFull
 
 void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
 {
-    std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    std::string     fullName(aFullName);
+    DnsNameInfo     nameInfo = SplitFullDnsName(fullName);
+    SubscriptionKey key      = MakeSubscriptionKey(nameInfo);
+    auto            it       = mSubscriptions.find(key);
 
-    otbrLogInfo("Subscribe: %s", fullName.c_str());
-
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    if (it == mSubscriptions.end())
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
-        }
+        it = mSubscriptions.emplace(key, Subscription(nameInfo)).first;
+        SubscribeMdns(it->second);
     }
+    else if (!it->second.mAnswers.empty())
+    {
+        // Answers the new query from the cache instead of waiting for the next mDNS response.
+        ScheduleCacheAnswer(key);
+    }
+
+    it->second.mRefCount++;
+
+    otbrLogInfo("Subscribe: %s, references %u, cached answers %zu", fullName.c_str(), it->second.mRefCount,
+                it->second.mAnswers.size());
 }
 
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName)
@@ -153,21 +198,21 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFu
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
 {
     std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    auto        it = mSubscriptions.find(MakeSubscriptionKey(SplitFullDnsName(fullName)));
 
     otbrLogInfo("Unsubscribe: %s", fullName.c_str());
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    VerifyOrExit(it != mSubscriptions.end() && it->second.mRefCount > 0);
+
+    // The mDNS subscription is kept for a while so that repeated queries are answered from the cache.
+    if (--it->second.mRefCount == 0)
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
-        }
+        it->second.mLingerDeadline = Clock::now() + kSubscriptionLingerTime;
+        ScheduleMaintenance(it->second.mLingerDeadline);
     }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::FilterLinkLocalAddresses(const AddressList &aAddrList, AddressList &aFilteredList)
@@ -185,179 +230,518 @@ void DiscoveryProxy::FilterLinkLocalAddresses(const AddressList &aAddrList, Addr
     }
 }
 
-void DiscoveryProxy::OnServiceDiscovered(const std::string                             &aType,
-                                         const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
+void DiscoveryProxy::OnServiceDiscovered(const std::string                                &aType,
+                                         const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo)
 {
-    otDnssdServiceInstanceInfo instanceInfo;
-    const otDnssdQuery        *query                 = nullptr;
-    std::string                unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
-    AddressList                filteredAddrList;
+    std::string     unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo->mName);
+    SubscriptionKey keys[] = {SubscriptionKey("", aType, ""), SubscriptionKey(unescapedInstanceName, aType, "")};
+    CachedAnswer    newAnswer;
+    CachedAnswer   *answer = nullptr;
+
+    if (aInstanceInfo->mRemoved || aInstanceInfo->mTtl == 0)
+    {
+        for (const SubscriptionKey &key : keys)
+        {
+            auto it = mSubscriptions.find(key);
+
+            if (it != mSubscriptions.end())
+            {
+                it->second.mAnswers.erase(unescapedInstanceName);
+            }
+        }
 
-    FilterLinkLocalAddresses(aInstanceInfo.mAddresses, filteredAddrList);
+        ExitNow();
+    }
+
+    FilterLinkLocalAddresses(aInstanceInfo->mAddresses, newAnswer.mAddresses);
 
     otbrLogInfo("Service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
                 "weight %d",
-                aType.c_str(), aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(), filteredAddrList.size(),
-                aInstanceInfo.mPort, aInstanceInfo.mPriority, aInstanceInfo.mWeight);
+                aType.c_str(), aInstanceInfo->mName.c_str(), aInstanceInfo->mHostName.c_str(),
+                newAnswer.mAddresses.size(), aInstanceInfo->mPort, aInstanceInfo->mPriority, aInstanceInfo->mWeight);
 
-    instanceInfo.mAddressNum = filteredAddrList.size();
+    newAnswer.mInstanceInfo = aInstanceInfo;
+    newAnswer.mInstanceName = unescapedInstanceName;
+    newAnswer.mHostName     = aInstanceInfo->mHostName;
+    newAnswer.mUpdateTime   = Clock::now();
+    newAnswer.mExpireTime   = newAnswer.mUpdateTime + Seconds(aInstanceInfo->mTtl);
 
-    if (!filteredAddrList.empty())
+    for (const SubscriptionKey &key : keys)
     {
-        instanceInfo.mAddresses = reinterpret_cast<const otIp6Address *>(&filteredAddrList[0]);
+        auto it = mSubscriptions.find(key);
+
+        if (it != mSubscriptions.end())
+        {
+            CachedAnswer &cachedAnswer = it->second.mAnswers[unescapedInstanceName];
+
+            if (UpdateCachedAnswer(cachedAnswer, newAnswer))
+            {
+                ScheduleMaintenance(GetRefreshTime(cachedAnswer));
+            }
+
+            answer = &cachedAnswer;
+        }
+    }
+
+    // Nobody subscribes to the service, so there are no queries to answer.
+    VerifyOrExit(answer != nullptr);
+
+    AnswerServiceQueries(aType, *answer, CapTtl(aInstanceInfo->mTtl));
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::OnHostDiscovered(const std::string                            &aHostName,
+                                      const Mdns::Publisher::DiscoveredHostInfoPtr &aHostInfo)
+{
+    auto         it = mSubscriptions.find(SubscriptionKey("", "", aHostName));
+    CachedAnswer newAnswer;
+
+    VerifyOrExit(it != mSubscriptions.end());
+
+    FilterLinkLocalAddresses(aHostInfo->mAddresses, newAnswer.mAddresses);
+
+    if (newAnswer.mAddresses.empty() || aHostInfo->mTtl == 0)
+    {
+        it->second.mAnswers.erase(aHostName);
+        ExitNow();
+    }
+
+    otbrLogInfo("Host discovered: %s hostname %s addresses %zu", aHostName.c_str(), aHostInfo->mHostName.c_str(),
+                newAnswer.mAddresses.size());
+
+    newAnswer.mHostName   = aHostInfo->mHostName.empty() ? aHostName + ".local." : aHostInfo->mHostName;
+    newAnswer.mUpdateTime = Clock::now();
+    newAnswer.mExpireTime = newAnswer.mUpdateTime + Seconds(aHostInfo->mTtl);
+
+    {
+        CachedAnswer &cachedAnswer = it->second.mAnswers[aHostName];
+
+        if (UpdateCachedAnswer(cachedAnswer, newAnswer))
+        {
+            ScheduleMaintenance(GetRefreshTime(cachedAnswer));
+        }
+
+        AnswerHostQueries(aHostName, cachedAnswer, CapTtl(aHostInfo->mTtl));
+    }
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::AnswerServiceQueries(const std::string &aType, CachedAnswer &aAnswer, uint32_t aTtl)
+{
+    otDnssdServiceInstanceInfo instanceInfo;
+    const otDnssdQuery        *query = nullptr;
+
+    // The Thread host may have been de-initialized while mDNS was discovering.
+    VerifyOrExit(mHost.GetInstance() != nullptr);
+
+    instanceInfo.mAddressNum = aAnswer.mAddresses.size();
+
+    if (!aAnswer.mAddresses.empty())
+    {
+        instanceInfo.mAddresses = reinterpret_cast<const otIp6Address *>(&aAnswer.mAddresses[0]);
     }
     else
     {
         instanceInfo.mAddresses = nullptr;
     }
 
-    instanceInfo.mPort      = aInstanceInfo.mPort;
-    instanceInfo.mPriority  = aInstanceInfo.mPriority;
-    instanceInfo.mWeight    = aInstanceInfo.mWeight;
-    instanceInfo.mTxtLength = static_cast<uint16_t>(aInstanceInfo.mTxtData.size());
-    instanceInfo.mTxtData   = aInstanceInfo.mTxtData.data();
-    instanceInfo.mTtl       = CapTtl(aInstanceInfo.mTtl);
+    instanceInfo.mPort      = aAnswer.mInstanceInfo->mPort;
+    instanceInfo.mPriority  = aAnswer.mInstanceInfo->mPriority;
+    instanceInfo.mWeight    = aAnswer.mInstanceInfo->mWeight;
+    instanceInfo.mTxtLength = static_cast<uint16_t>(aAnswer.mInstanceInfo->mTxtData.size());
+    instanceInfo.mTxtData   = aAnswer.mInstanceInfo->mTxtData.data();
+    instanceInfo.mTtl       = aTtl;
 
     while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
     {
-        std::string      instanceName;
-        std::string      serviceName;
-        std::string      hostName;
-        std::string      domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
-        otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
+        char             hostName[OT_DNS_MAX_NAME_SIZE];
+        otDnssdQueryType type      = otDnssdGetQueryTypeAndName(query, &queryName);
+        DnsNameView      queryView = ParseFullDnsName(DnsNameSpan(queryName));
+        bool             isMatched;
 
         switch (type)
         {
         case OT_DNSSD_QUERY_TYPE_BROWSE:
-            splitError = SplitFullServiceName(queryName, serviceName, domain);
+            isMatched = queryView.IsService();
             break;
         case OT_DNSSD_QUERY_TYPE_RESOLVE:
-            splitError = SplitFullServiceInstanceName(queryName, instanceName, serviceName, domain);
+            isMatched = queryView.IsServiceInstance() &&
+                        queryView.mInstanceName.EqualsCaseInsensitive(aAnswer.mInstanceName);
             break;
         default:
-            splitError = OTBR_ERROR_NOT_FOUND;
+            isMatched = false;
             break;
         }
-        if (splitError != OTBR_ERROR_NONE)
+
+        if (!isMatched || !queryView.mServiceName.EqualsCaseInsensitive(aType))
         {
             // Incoming service/instance was not what current query wanted to see, move on.
             continue;
         }
 
-        if (DnsLabelsEqual(serviceName, aType) &&
-            (instanceName.empty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
         {
-            std::string serviceFullName    = aType + "." + domain;
-            std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
-            std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
+            std::string serviceFullName  = aType + "." + queryView.mDomain.ToString();
+            std::string instanceFullName = aAnswer.mInstanceName + "." + serviceFullName;
 
             instanceInfo.mFullName = instanceFullName.c_str();
-            instanceInfo.mHostName = translatedHostName.c_str();
+            instanceInfo.mHostName = TranslateDomain(aAnswer.mHostName, queryView.mDomain, hostName, sizeof(hostName));
 
             otDnssdQueryHandleDiscoveredServiceInstance(mHost.GetInstance(), serviceFullName.c_str(), &instanceInfo);
         }
     }
+
+exit:
+    return;
 }
 
-void DiscoveryProxy::OnHostDiscovered(const std::string                         &aHostName,
-                                      const Mdns::Publisher::DiscoveredHostInfo &aHostInfo)
+void DiscoveryProxy::AnswerHostQueries(const std::string &aHostName, CachedAnswer &aAnswer, uint32_t aTtl)
 {
     otDnssdHostInfo     hostInfo;
-    const otDnssdQuery *query            = nullptr;
-    std::string         resolvedHostName = aHostInfo.mHostName;
-    AddressList         filteredAddrList;
-
-    FilterLinkLocalAddresses(aHostInfo.mAddresses, filteredAddrList);
-    VerifyOrExit(!filteredAddrList.empty());
-
-    otbrLogInfo("Host discovered: %s hostname %s addresses %zu", aHostName.c_str(), aHostInfo.mHostName.c_str(),
-                filteredAddrList.size());
-
-    if (resolvedHostName.empty())
-    {
-        resolvedHostName = aHostName + ".local.";
-    }
+    const otDnssdQuery *query = nullptr;
 
-    hostInfo.mAddressNum = filteredAddrList.size();
-    hostInfo.mAddresses  = reinterpret_cast<const otIp6Address *>(&filteredAddrList[0]);
+    VerifyOrExit(mHost.GetInstance() != nullptr);
 
-    hostInfo.mTtl = CapTtl(aHostInfo.mTtl);
+    hostInfo.mAddressNum = aAnswer.mAddresses.size();
+    hostInfo.mAddresses  = reinterpret_cast<const otIp6Address *>(&aAnswer.mAddresses[0]);
+    hostInfo.mTtl        = aTtl;
 
     while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
     {
-        std::string      hostName, domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
+        char             hostName[OT_DNS_MAX_NAME_SIZE];
         otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
-
-        OTBR_UNUSED_VARIABLE(splitError);
+        DnsNameView      queryView;
 
         if (type != OT_DNSSD_QUERY_TYPE_RESOLVE_HOST)
         {
             continue;
         }
 
-        splitError = SplitFullHostName(queryName, hostName, domain);
+        queryView = ParseFullDnsName(DnsNameSpan(queryName));
+
+        if (queryView.IsHost() && queryView.mHostName.EqualsCaseInsensitive(aHostName))
+        {
+            otDnssdQueryHandleDiscoveredHost(
+                mHost.GetInstance(), TranslateDomain(aAnswer.mHostName, queryView.mDomain, hostName, sizeof(hostName)),
+                &hostInfo);
+        }
+    }
+
+exit:
+    return;
+}
+
+const char *DiscoveryProxy::TranslateDomain(const std::string &aName,
+                                            const DnsNameSpan &aTargetDomain,
+                                            char              *aBuffer,
+                                            size_t             aBufferSize)
+{
+    const char *targetName = aBuffer;
+
+    VerifyOrExit(OTBR_ERROR_NONE ==
+                     RewriteDnsDomain(DnsNameSpan(aName), DnsNameSpan("local."), aTargetDomain, aBuffer, aBufferSize),
+                 targetName = aName.c_str());
+
+exit:
+    otbrLogDebug("Translate domain: %s => %s", aName.c_str(), targetName);
+    return targetName;
+}
+
+uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
+{
+    return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
+}
+
+DiscoveryProxy::Subscription::Subscription(const DnsNameInfo &aNameInfo)
+    : mInstanceName(aNameInfo.mInstanceName)
+    , mServiceName(aNameInfo.mServiceName)
+    , mHostName(aNameInfo.mHostName)
+{
+}
+
+bool DiscoveryProxy::SubscriptionKeyLess::operator()(const SubscriptionKey &aKey1, const SubscriptionKey &aKey2) const
+{
+    int result = CompareDnsNames(DnsNameSpan(std::get<0>(aKey1)), DnsNameSpan(std::get<0>(aKey2)));
+
+    if (result == 0)
+    {
+        result = CompareDnsNames(DnsNameSpan(std::get<1>(aKey1)), DnsNameSpan(std::get<1>(aKey2)));
+    }
+
+    if (result == 0)
+    {
+        result = CompareDnsNames(DnsNameSpan(std::get<2>(aKey1)), DnsNameSpan(std::get<2>(aKey2)));
+    }
+
+    return result < 0;
+}
+
+DiscoveryProxy::SubscriptionKey DiscoveryProxy::MakeSubscriptionKey(const DnsNameInfo &aNameInfo)
+{
+    return SubscriptionKey(aNameInfo.mInstanceName, aNameInfo.mServiceName, aNameInfo.mHostName);
+}
+
+bool DiscoveryProxy::UpdateCachedAnswer(CachedAnswer &aAnswer, const CachedAnswer &aNewAnswer)
+{
+    // A result replayed from the mDNS cache carries the remaining TTL in whole seconds, it doesn't
+    // extend the lifetime and so the refresh state is kept.
+    bool isRefreshed = aNewAnswer.mExpireTime > aAnswer.mExpireTime + Seconds(1);
+
+    aAnswer.mInstanceInfo = aNewAnswer.mInstanceInfo;
+    aAnswer.mInstanceName = aNewAnswer.mInstanceName;
+    aAnswer.mHostName     = aNewAnswer.mHostName;
+    aAnswer.mAddresses    = aNewAnswer.mAddresses;
+    aAnswer.mExpireTime   = aNewAnswer.mExpireTime;
+
+    if (isRefreshed)
+    {
+        aAnswer.mUpdateTime       = aNewAnswer.mUpdateTime;
+        aAnswer.mRefreshRequested = false;
+    }
+
+    return isRefreshed;
+}
+
+uint32_t DiscoveryProxy::GetRemainingTtl(const CachedAnswer &aAnswer, Timepoint aNow)
+{
+    uint32_t ttl = 0;
+
+    VerifyOrExit(aAnswer.mExpireTime > aNow);
+
+    // Rounds up, so that an answer which has not expired is never reported with a TTL of zero.
+    ttl = static_cast<uint32_t>(
+        std::chrono::duration_cast<Seconds>(aAnswer.mExpireTime - aNow + Seconds(1) - Clock::duration(1)).count());
+
+exit:
+    return ttl;
+}
+
+Timepoint DiscoveryProxy::GetRefreshTime(const CachedAnswer &aAnswer)
+{
+    return aAnswer.mUpdateTime + (aAnswer.mExpireTime - aAnswer.mUpdateTime) * kCacheRefreshPercent / 100;
+}
 
-        if (splitError != OTBR_ERROR_NONE)
+void DiscoveryProxy::SubscribeMdns(const Subscription &aSubscription)
+{
+    if (aSubscription.mHostName.empty())
+    {
+        mMdnsPublisher.SubscribeService(aSubscription.mServiceName, aSubscription.mInstanceName, mSubscriberId);
+    }
+    else
+    {
+        mMdnsPublisher.SubscribeHost(aSubscription.mHostName, mSubscriberId);
+    }
+}
+
+void DiscoveryProxy::UnsubscribeMdns(const Subscription &aSubscription)
+{
+    if (aSubscription.mHostName.empty())
+    {
+        mMdnsPublisher.UnsubscribeService(aSubscription.mServiceName, aSubscription.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.UnsubscribeHost(aSubscription.mHostName);
+    }
+}
+
+void DiscoveryProxy::RequeryMdns(const Subscription &aSubscription)
+{
+    if (aSubscription.mHostName.empty())
+    {
+        mMdnsPublisher.RequeryService(aSubscription.mServiceName, aSubscription.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.RequeryHost(aSubscription.mHostName);
+    }
+}
+
+bool DiscoveryProxy::IsMdnsSubscribed(const Subscription &aSubscription) const
+{
+    return aSubscription.mHostName.empty()
+               ? mMdnsPublisher.IsServiceSubscribed(aSubscription.mServiceName, aSubscription.mInstanceName)
+               : mMdnsPublisher.IsHostSubscribed(aSubscription.mHostName);
+}
+
+void DiscoveryProxy::ScheduleCacheAnswer(const SubscriptionKey &aKey)
+{
+    mPendingCacheAnswers.insert(aKey);
+
+    // The query is answered on the next mainloop iteration, after OpenThread has finished handling it.
+    if (mCacheAnswerTimerId == 0)
+    {
+        mCacheAnswerTimerId = MainloopManager::GetInstance().AddTimer(Microseconds::zero(), [this]() {
+            mCacheAnswerTimerId = 0;
+            HandleCacheAnswerTimer();
+        });
+    }
+}
+
+void DiscoveryProxy::HandleCacheAnswerTimer(void)
+{
+    std::set<SubscriptionKey, SubscriptionKeyLess> keys = std::move(mPendingCacheAnswers);
+    Timepoint                                      now  = Clock::now();
+
+    mPendingCacheAnswers.clear();
+
+    for (const SubscriptionKey &key : keys)
+    {
+        auto it = mSubscriptions.find(key);
+
+        if (it == mSubscriptions.end())
         {
             continue;
         }
 
-        if (DnsLabelsEqual(hostName, aHostName))
+        // Answering the queries never removes a subscription or its answers, so the iteration is safe.
+        for (auto &answer : it->second.mAnswers)
         {
-            std::string hostFullName = TranslateDomain(resolvedHostName, domain);
+            uint32_t ttl = CapTtl(GetRemainingTtl(answer.second, now));
 
-            otDnssdQueryHandleDiscoveredHost(mHost.GetInstance(), hostFullName.c_str(), &hostInfo);
+            if (ttl == 0)
+            {
+                continue;
+            }
+
+            if (it->second.mHostName.empty())
+            {
+                AnswerServiceQueries(it->second.mServiceName, answer.second, ttl);
+            }
+            else
+            {
+                AnswerHostQueries(it->second.mHostName, answer.second, ttl);
+            }
         }
     }
-
-exit:
-    return;
 }
 
-std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
+void DiscoveryProxy::ScheduleMaintenance(Timepoint aTime)
 {
-    std::string targetName;
-    std::string hostName;
-    std::string domain;
+    VerifyOrExit(mMaintenanceTimerId == 0 || aTime < mMaintenanceTime);
 
-    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), targetName = aName);
-    VerifyOrExit(DnsLabelsEqual(domain, "local."), targetName = aName);
+    if (mMaintenanceTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mMaintenanceTimerId);
+    }
 
-    targetName = hostName + "." + aTargetDomain;
+    mMaintenanceTime    = aTime;
+    mMaintenanceTimerId = MainloopManager::GetInstance().AddTimer(
+        std::chrono::duration_cast<Microseconds>(std::max(aTime - Clock::now(), Clock::duration::zero())),
+        [this]() {
+            mMaintenanceTimerId = 0;
+            HandleMaintenanceTimer();
+        });
 
 exit:
-    otbrLogDebug("Translate domain: %s => %s", aName.c_str(), targetName.c_str());
-    return targetName;
+    return;
 }
 
-int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const
+void DiscoveryProxy::HandleMaintenanceTimer(void)
 {
-    const otDnssdQuery *query = nullptr;
-    int                 count = 0;
+    Timepoint now  = Clock::now();
+    Timepoint next = Timepoint::max();
 
-    while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
+    for (auto it = mSubscriptions.begin(); it != mSubscriptions.end();)
     {
-        char        queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsNameInfo queryInfo;
+        Subscription &subscription  = it->second;
+        bool          shouldRefresh = false;
+
+        if (subscription.mRefCount == 0 && subscription.mLingerDeadline <= now)
+        {
+            UnsubscribeMdns(subscription);
+            it = mSubscriptions.erase(it);
+            continue;
+        }
 
-        otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = SplitFullDnsName(queryName);
+        for (auto answer = subscription.mAnswers.begin(); answer != subscription.mAnswers.end();)
+        {
+            if (answer->second.mExpireTime <= now)
+            {
+                answer = subscription.mAnswers.erase(answer);
+                continue;
+            }
 
-        count += (DnsLabelsEqual(aNameInfo.mInstanceName, queryInfo.mInstanceName) &&
-                  DnsLabelsEqual(aNameInfo.mServiceName, queryInfo.mServiceName) &&
-                  DnsLabelsEqual(aNameInfo.mHostName, queryInfo.mHostName));
+            if (!answer->second.mRefreshRequested)
+            {
+                if (GetRefreshTime(answer->second) <= now)
+                {
+                    answer->second.mRefreshRequested = true;
+                    shouldRefresh                    = true;
+                }
+                else
+                {
+                    next = std::min(next, GetRefreshTime(answer->second));
+                }
+            }
+
+            next = std::min(next, answer->second.mExpireTime);
+            ++answer;
+        }
+
+        if (subscription.mRefCount == 0)
+        {
+            next = std::min(next, subscription.mLingerDeadline);
+        }
+
+        // The responses to the new query refresh the cached answers.
+        if (shouldRefresh)
+        {
+            otbrLogInfo("Refresh cached answers of %s%s%s", subscription.mInstanceName.c_str(),
+                        subscription.mServiceName.c_str(), subscription.mHostName.c_str());
+            RequeryMdns(subscription);
+        }
+
+        ++it;
     }
 
-    return count;
+    if (next != Timepoint::max())
+    {
+        ScheduleMaintenance(next);
+    }
 }
 
-uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
+void DiscoveryProxy::ReleaseSubscriptionReferences(void)
 {
-    return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
+    Timepoint deadline = Clock::now() + kSubscriptionLingerTime;
+
+    for (auto &subscription : mSubscriptions)
+    {
+        if (subscription.second.mRefCount > 0)
+        {
+            subscription.second.mRefCount       = 0;
+            subscription.second.mLingerDeadline = deadline;
+            ScheduleMaintenance(deadline);
+        }
+    }
+}
+
+void DiscoveryProxy::ClearSubscriptions(void)
+{
+    for (const auto &subscription : mSubscriptions)
+    {
+        UnsubscribeMdns(subscription.second);
+    }
+
+    mSubscriptions.clear();
+    mPendingCacheAnswers.clear();
+
+    if (mCacheAnswerTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mCacheAnswerTimerId);
+        mCacheAnswerTimerId = 0;
+    }
+
+    if (mMaintenanceTimerId != 0)
+    {
+        MainloopManager::GetInstance().RemoveTimer(mMaintenanceTimerId);
+        mMaintenanceTimerId = 0;
+    }
 }
 
 } // namespace Dnssd
@@ -38,7 +38,10 @@
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
+#include <map>
 #include <set>
+#include <string>
+#include <tuple>
 #include <utility>
 
 #include <stdint.h>
@@ -47,6 +50,8 @@
 #include <openthread/instance.h>
 
 #include "common/dns_utils.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
 #include "host/rcp_host.hpp"
 #include "mdns/mdns.hpp"
 
@@ -67,6 +72,11 @@ public:
      */
     explicit DiscoveryProxy(Host::RcpHost &aHost, Mdns::Publisher &aPublisher);
 
+    /**
+     * This destructor cancels the pending cache timers.
+     */
+    ~DiscoveryProxy(void) override;
+
     /**
      * This method enables/disables the Discovery Proxy.
      *
@@ -79,15 +89,11 @@ public:
      *
      * @param[in] aState  The state of mDNS publisher.
      */
-    void HandleMdnsState(Mdns::Publisher::State aState)
-    {
-        VerifyOrExit(IsEnabled());
-        OTBR_UNUSED_VARIABLE(aState);
-    exit:
-        return;
-    }
+    void HandleMdnsState(Mdns::Publisher::State aState) override;
 
 private:
+    friend class DiscoveryProxyTest;
+
     using AddressList = Mdns::Publisher::AddressList;
 
     enum : uint32_t
@@ -95,19 +101,72 @@ private:
         kServiceTtlCapLimit = 10, // TTL cap limit for Discovery Proxy (in seconds).
     };
 
+    static constexpr Milliseconds kSubscriptionLingerTime = Milliseconds(120000); // Lifetime of idle subscriptions.
+    static constexpr uint8_t      kCacheRefreshPercent    = 80;                   // Percent of TTL to refresh at.
+
+    // The (instance name, service type, host name) of a subscription, which are compared case-insensitively.
+    using SubscriptionKey = std::tuple<std::string, std::string, std::string>;
+
+    struct SubscriptionKeyLess
+    {
+        bool operator()(const SubscriptionKey &aKey1, const SubscriptionKey &aKey2) const;
+    };
+
+    struct CachedAnswer
+    {
+        Mdns::Publisher::DiscoveredInstanceInfoPtr mInstanceInfo; // Snapshot of the service instance, null for hosts.
+        std::string                                mInstanceName; // Unescaped instance name, empty for hosts.
+        std::string                                mHostName;     // Full mDNS host name.
+        AddressList                                mAddresses;    // Addresses without the link-local ones.
+        Timepoint                                  mUpdateTime;
+        Timepoint                                  mExpireTime;
+        bool                                       mRefreshRequested = false;
+    };
+
+    struct Subscription
+    {
+        explicit Subscription(const DnsNameInfo &aNameInfo);
+
+        std::string                                      mInstanceName;
+        std::string                                      mServiceName;
+        std::string                                      mHostName;
+        uint32_t                                         mRefCount = 0;
+        Timepoint                                        mLingerDeadline;
+        std::map<std::string, CachedAnswer, DnsNameLess> mAnswers; // Keyed by the instance or host name.
+    };
+
     static void        OnDiscoveryProxySubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxySubscribe(const char *aSubscription);
     static void        OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxyUnsubscribe(const char *aSubscription);
-    int                GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const;
-    static std::string TranslateDomain(const std::string &aName, const std::string &aTargetDomain);
-    void               OnServiceDiscovered(const std::string                             &aSubscription,
-                                           const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
-    void OnHostDiscovered(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
+    static const char *TranslateDomain(const std::string &aName,
+                                       const DnsNameSpan &aTargetDomain,
+                                       char              *aBuffer,
+                                       size_t             aBufferSize);
+    void               OnServiceDiscovered(const std::string                                &aSubscription,
+                                           const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo);
+    void OnHostDiscovered(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfoPtr &aHostInfo);
     static uint32_t CapTtl(uint32_t aTtl);
 
     static void FilterLinkLocalAddresses(const AddressList &aAddrList, AddressList &aFilteredList);
 
+    static SubscriptionKey MakeSubscriptionKey(const DnsNameInfo &aNameInfo);
+    static bool            UpdateCachedAnswer(CachedAnswer &aAnswer, const CachedAnswer &aNewAnswer);
+    static uint32_t        GetRemainingTtl(const CachedAnswer &aAnswer, Timepoint aNow);
+    static Timepoint       GetRefreshTime(const CachedAnswer &aAnswer);
+    void                   SubscribeMdns(const Subscription &aSubscription);
+    void                   UnsubscribeMdns(const Subscription &aSubscription);
+    void                   RequeryMdns(const Subscription &aSubscription);
+    bool                   IsMdnsSubscribed(const Subscription &aSubscription) const;
+    void                   AnswerServiceQueries(const std::string &aType, CachedAnswer &aAnswer, uint32_t aTtl);
+    void                   AnswerHostQueries(const std::string &aHostName, CachedAnswer &aAnswer, uint32_t aTtl);
+    void                   ScheduleCacheAnswer(const SubscriptionKey &aKey);
+    void                   HandleCacheAnswerTimer(void);
+    void                   ScheduleMaintenance(Timepoint aTime);
+    void                   HandleMaintenanceTimer(void);
+    void                   ReleaseSubscriptionReferences(void);
+    void                   ClearSubscriptions(void);
+
     void Start(void);
     void Stop(void);
     bool IsEnabled(void) const { return mIsEnabled; }
@@ -116,6 +175,12 @@ private:
     Mdns::Publisher &mMdnsPublisher;
     bool             mIsEnabled;
     uint64_t         mSubscriberId = 0;
+
+    std::map<SubscriptionKey, Subscription, SubscriptionKeyLess> mSubscriptions;
+    std::set<SubscriptionKey, SubscriptionKeyLess>               mPendingCacheAnswers;
+    MainloopManager::TimerId                                     mCacheAnswerTimerId = 0;
+    MainloopManager::TimerId                                     mMaintenanceTimerId = 0;
+    Timepoint                                                    mMaintenanceTime;
 };
 
 } // namespace Dnssd
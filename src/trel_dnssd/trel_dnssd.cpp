@@ -114,14 +114,14 @@ void TrelDnssd::StartBrowse(void)
 
     assert(mSubscriberId == 0);
     mSubscriberId = mPublisher.AddSubscriptionCallbacks(
-        [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
+        [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
             OnTrelServiceInstanceResolved(aType, aInstanceInfo);
         },
-        /* aHostCallback */ nullptr);
+        /* aHostCallback */ nullptr, kTrelServiceName);
 
     if (IsReady())
     {
-        mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "");
+        mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "", mSubscriberId);
     }
 
 exit:
@@ -211,15 +211,15 @@ exit:
     return;
 }
 
-void TrelDnssd::OnTrelServiceInstanceResolved(const std::string                             &aType,
-                                              const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
+void TrelDnssd::OnTrelServiceInstanceResolved(const std::string                                &aType,
+                                              const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo)
 {
     VerifyOrExit(StringUtils::EqualCaseInsensitive(aType, kTrelServiceName));
-    VerifyOrExit(aInstanceInfo.mNetifIndex == mTrelNetifIndex);
+    VerifyOrExit(aInstanceInfo->mNetifIndex == mTrelNetifIndex);
 
-    if (aInstanceInfo.mRemoved)
+    if (aInstanceInfo->mRemoved)
     {
-        OnTrelServiceInstanceRemoved(aInstanceInfo.mName);
+        OnTrelServiceInstanceRemoved(aInstanceInfo->mName);
     }
     else
     {
@@ -283,9 +283,9 @@ void TrelDnssd::HandleUnpublishTrelServiceError(otbrError aError)
     }
 }
 
-void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
+void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo)
 {
-    std::string        instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
+    std::string        instanceName = StringUtils::ToLowercase(aInstanceInfo->mName);
     Ip6Address         selectedAddress;
     otPlatTrelPeerInfo peerInfo;
 
@@ -294,10 +294,10 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
 
     otbrLogDebug("Peer discovered: %s hostname %s addresses %zu port %d priority %d "
                  "weight %d",
-                 aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(), aInstanceInfo.mAddresses.size(),
-                 aInstanceInfo.mPort, aInstanceInfo.mPriority, aInstanceInfo.mWeight);
+                 aInstanceInfo->mName.c_str(), aInstanceInfo->mHostName.c_str(), aInstanceInfo->mAddresses.size(),
+                 aInstanceInfo->mPort, aInstanceInfo->mPriority, aInstanceInfo->mWeight);
 
-    for (const auto &addr : aInstanceInfo.mAddresses)
+    for (const auto &addr : aInstanceInfo->mAddresses)
     {
         otbrLogDebug("Peer address: %s", addr.ToString().c_str());
 
@@ -317,22 +317,22 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
         }
     }
 
-    if (aInstanceInfo.mAddresses.empty())
+    if (aInstanceInfo->mAddresses.empty())
     {
-        otbrLogWarning("Peer %s does not have any IPv6 address, ignored", aInstanceInfo.mName.c_str());
+        otbrLogWarning("Peer %s does not have any IPv6 address, ignored", aInstanceInfo->mName.c_str());
         ExitNow();
     }
 
     peerInfo.mRemoved = false;
     memcpy(&peerInfo.mSockAddr.mAddress, &selectedAddress, sizeof(peerInfo.mSockAddr.mAddress));
-    peerInfo.mSockAddr.mPort = aInstanceInfo.mPort;
-    peerInfo.mTxtData        = aInstanceInfo.mTxtData.data();
-    peerInfo.mTxtLength      = aInstanceInfo.mTxtData.size();
+    peerInfo.mSockAddr.mPort = aInstanceInfo->mPort;
+    peerInfo.mTxtData        = aInstanceInfo->mTxtData.data();
+    peerInfo.mTxtLength      = aInstanceInfo->mTxtData.size();
 
     {
-        Peer peer(aInstanceInfo.mTxtData, peerInfo.mSockAddr);
+        Peer peer(aInstanceInfo, peerInfo.mSockAddr);
 
-        VerifyOrExit(peer.mValid, otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str()));
+        VerifyOrExit(peer.mValid, otbrLogWarning("Peer %s is invalid", aInstanceInfo->mName.c_str()));
 
         otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
 
@@ -391,8 +391,8 @@ void TrelDnssd::NotifyRemovePeer(const Peer &aPeer)
     otPlatTrelPeerInfo peerInfo;
 
     peerInfo.mRemoved   = true;
-    peerInfo.mTxtData   = aPeer.mTxtData.data();
-    peerInfo.mTxtLength = aPeer.mTxtData.size();
+    peerInfo.mTxtData   = aPeer.GetTxtData().data();
+    peerInfo.mTxtLength = aPeer.GetTxtData().size();
     peerInfo.mSockAddr  = aPeer.mSockAddr;
 
     otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
@@ -448,7 +448,7 @@ void TrelDnssd::OnBecomeReady(void)
 
         if (mSubscriberId > 0)
         {
-            mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "");
+            mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "", mSubscriberId);
         }
 
         if (mRegisterInfo.IsValid())
@@ -500,24 +500,23 @@ const char TrelDnssd::Peer::kTxtRecordExtAddressKey[] = "xa";
 
 void TrelDnssd::Peer::ReadExtAddrFromTxtData(void)
 {
-    std::vector<Mdns::Publisher::TxtEntry> txtEntries;
+    Mdns::Publisher::TxtDataIterator iterator(GetTxtData().data(), static_cast<uint16_t>(GetTxtData().size()));
+    Mdns::Publisher::TxtEntryView    txtEntry;
 
     memset(&mExtAddr, 0, sizeof(mExtAddr));
 
-    SuccessOrExit(Mdns::Publisher::DecodeTxtData(txtEntries, mTxtData.data(), mTxtData.size()));
-
-    for (const auto &txtEntry : txtEntries)
+    while (iterator.GetNextEntry(txtEntry) == OTBR_ERROR_NONE)
     {
         if (txtEntry.mIsBooleanAttribute)
         {
             continue;
         }
 
-        if (StringUtils::EqualCaseInsensitive(txtEntry.mKey, kTxtRecordExtAddressKey))
+        if (txtEntry.KeyEquals(kTxtRecordExtAddressKey))
         {
-            VerifyOrExit(txtEntry.mValue.size() == sizeof(mExtAddr));
+            VerifyOrExit(txtEntry.mValueLength == sizeof(mExtAddr));
 
-            memcpy(mExtAddr.m8, txtEntry.mValue.data(), sizeof(mExtAddr));
+            memcpy(mExtAddr.m8, txtEntry.mValue, sizeof(mExtAddr));
             mValid = true;
             break;
         }
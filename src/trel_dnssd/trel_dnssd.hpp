@@ -131,21 +131,22 @@ private:
     {
         static const char kTxtRecordExtAddressKey[];
 
-        explicit Peer(std::vector<uint8_t> aTxtData, const otSockAddr &aSockAddr)
+        explicit Peer(Mdns::Publisher::DiscoveredInstanceInfoPtr aInstanceInfo, const otSockAddr &aSockAddr)
             : mDiscoverTime(Clock::now())
-            , mTxtData(std::move(aTxtData))
+            , mInstanceInfo(std::move(aInstanceInfo))
             , mSockAddr(aSockAddr)
         {
             ReadExtAddrFromTxtData();
         }
 
-        void ReadExtAddrFromTxtData(void);
+        void                            ReadExtAddrFromTxtData(void);
+        const Mdns::Publisher::TxtData &GetTxtData(void) const { return mInstanceInfo->mTxtData; }
 
-        Clock::time_point    mDiscoverTime;
-        std::vector<uint8_t> mTxtData;
-        otSockAddr           mSockAddr;
-        otExtAddress         mExtAddr;
-        bool                 mValid = false;
+        Clock::time_point                          mDiscoverTime;
+        Mdns::Publisher::DiscoveredInstanceInfoPtr mInstanceInfo; // The discovered instance, which holds the TXT data.
+        otSockAddr                                 mSockAddr;
+        otExtAddress                               mExtAddr;
+        bool                                       mValid = false;
     };
 
     using PeerMap = std::map<std::string, Peer>;
@@ -159,9 +160,9 @@ private:
     void        UnpublishTrelService(void);
     static void HandlePublishTrelServiceError(otbrError aError);
     static void HandleUnpublishTrelServiceError(otbrError aError);
-    void        OnTrelServiceInstanceResolved(const std::string                             &aType,
-                                              const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
-    void        OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
+    void        OnTrelServiceInstanceResolved(const std::string                                &aType,
+                                              const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo);
+    void        OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo);
     void        OnTrelServiceInstanceRemoved(const std::string &aInstanceName);
 
     void     NotifyRemovePeer(const Peer &aPeer);
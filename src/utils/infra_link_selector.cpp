@@ -76,6 +76,9 @@ InfraLinkSelector::InfraLinkSelector(std::vector<const char *> aInfraLinkNames)
     {
         mNetlinkSocket = CreateNetLinkRouteSocket(RTMGRP_LINK);
         VerifyOrDie(mNetlinkSocket != -1, "Failed to create netlink socket");
+        SuccessOrDie(MainloopManager::GetInstance().AddFd(mNetlinkSocket, MainloopContext::kReadFdSet,
+                                                          [this](uint8_t) { ReceiveNetLinkMessage(); }),
+                     "Failed to register netlink socket");
     }
 
     for (const char *name : mInfraLinkNames)
@@ -88,6 +91,7 @@ InfraLinkSelector::~InfraLinkSelector(void)
 {
     if (mNetlinkSocket != -1)
     {
+        MainloopManager::GetInstance().RemoveFd(mNetlinkSocket);
         close(mNetlinkSocket);
         mNetlinkSocket = -1;
     }
@@ -231,24 +235,6 @@ exit:
     return state;
 }
 
-void InfraLinkSelector::Update(MainloopContext &aMainloop)
-{
-    if (mNetlinkSocket != -1)
-    {
-        aMainloop.AddFdToReadSet(mNetlinkSocket);
-    }
-}
-
-void InfraLinkSelector::Process(const MainloopContext &aMainloop)
-{
-    OTBR_UNUSED_VARIABLE(aMainloop);
-
-    if (mNetlinkSocket != -1 && FD_ISSET(mNetlinkSocket, &aMainloop.mReadFdSet))
-    {
-        ReceiveNetLinkMessage();
-    }
-}
-
 void InfraLinkSelector::ReceiveNetLinkMessage(void)
 {
     const size_t kMaxNetLinkBufSize = 8192;
@@ -47,6 +47,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/task_runner.hpp"
 #include "common/time.hpp"
 
@@ -66,7 +67,7 @@ namespace Utils {
 /**
  * This class implements Infrastructure Link Selector.
  */
-class InfraLinkSelector : public MainloopProcessor, private NonCopyable
+class InfraLinkSelector : private NonCopyable
 {
 public:
     /**
@@ -126,8 +127,6 @@ private:
 
     static const char *LinkStateToString(LinkState aState);
     static LinkState   QueryInfraLinkState(const char *aInfraLinkName);
-    void               Update(MainloopContext &aMainloop) override;
-    void               Process(const MainloopContext &aMainloop) override;
     void               ReceiveNetLinkMessage(void);
     void               HandleInfraLinkStateChange(uint32_t aInfraLinkIndex);
 
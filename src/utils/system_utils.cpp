@@ -39,6 +39,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <string>
+
 #include "common/logging.hpp"
 
 namespace otbr {
@@ -73,5 +75,19 @@ int ExecuteCommand(const char *aFormat, ...)
     return exitCode;
 }
 
+void ExecuteCommandAsync(WorkerPool::SequenceId aSequence, const char *aFormat, ...)
+{
+    char        cmd[kSystemCommandMaxLength];
+    std::string command;
+    va_list     args;
+
+    va_start(args, aFormat);
+    vsnprintf(cmd, sizeof(cmd), aFormat, args);
+    va_end(args);
+
+    command = cmd;
+    WorkerPool::GetInstance().Post(aSequence, [command]() { ExecuteCommand("%s", command.c_str()); });
+}
+
 } // namespace SystemUtils
 } // namespace otbr
@@ -36,6 +36,8 @@
 
 #include "openthread-br/config.h"
 
+#include "common/worker_pool.hpp"
+
 namespace otbr {
 namespace SystemUtils {
 
@@ -57,6 +59,18 @@ int ExecuteCommand(const char *aFormat, ...);
 }
 #endif
 
+/**
+ * This method formats a system command and executes it on the worker pool.
+ *
+ * The command is formatted on the calling thread. Commands posted on the same sequence are
+ * executed in order, and the exit code is logged.
+ *
+ * @param[in] aSequence  The worker pool sequence to execute the command on.
+ * @param[in] aFormat    A pointer to the format string.
+ * @param[in] ...        Arguments for the format specification.
+ */
+void ExecuteCommandAsync(WorkerPool::SequenceId aSequence, const char *aFormat, ...);
+
 } // namespace SystemUtils
 } // namespace otbr
 
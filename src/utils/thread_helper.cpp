@@ -70,6 +70,9 @@
 #include "common/logging.hpp"
 #include "common/tlv.hpp"
 #include "host/rcp_host.hpp"
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+#include "sdp_proxy/advertising_proxy.hpp"
+#endif
 
 namespace otbr {
 namespace agent {
@@ -1087,7 +1090,9 @@ void ThreadHelper::RetrieveBorderAgentInfo(threadnetwork::TelemetryData::BorderA
 }
 #endif
 
-otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData)
+otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
+                                            const AdvertisingProxy       *aAdvertisingProxy,
+                                            threadnetwork::TelemetryData &telemetryData)
 {
     otError                     error = OT_ERROR_NONE;
     std::vector<otNeighborInfo> neighborTable;
@@ -1504,8 +1509,34 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
             srpServerResponseCounters->set_name_exists_count(responseCounters->mNameExists);
             srpServerResponseCounters->set_refused_count(responseCounters->mRefused);
             srpServerResponseCounters->set_other_count(responseCounters->mOther);
+
+            if (aAdvertisingProxy != nullptr)
+            {
+                auto        advertisingProxyCounters = srpServer->mutable_advertising_proxy_counters();
+                const auto &updateCounters           = aAdvertisingProxy->GetUpdateCounters();
+                const auto &commitLatency            = updateCounters.mCommitLatency;
+                const auto &readvertiseProgress      = aAdvertisingProxy->GetReadvertiseProgress();
+
+                advertisingProxyCounters->set_queued_update_count(updateCounters.mQueuedUpdates);
+                advertisingProxyCounters->set_max_queued_update_count(updateCounters.mMaxQueuedUpdates);
+                advertisingProxyCounters->set_expired_update_count(updateCounters.mExpiredUpdates);
+                advertisingProxyCounters->set_committed_update_count(commitLatency.mCount);
+                if (commitLatency.mCount != 0)
+                {
+                    advertisingProxyCounters->set_commit_avg_latency_ms(
+                        static_cast<uint32_t>(commitLatency.mTotalUs / commitLatency.mCount / 1000));
+                }
+                advertisingProxyCounters->set_commit_p99_latency_ms(commitLatency.GetPercentileUs(99) / 1000);
+                advertisingProxyCounters->set_commit_max_latency_ms(commitLatency.mMaxUs / 1000);
+
+                advertisingProxyCounters->set_is_readvertising(readvertiseProgress.mIsRunning);
+                advertisingProxyCounters->set_readvertise_total_host_count(readvertiseProgress.mTotalHosts);
+                advertisingProxyCounters->set_readvertise_published_host_count(readvertiseProgress.mPublishedHosts);
+            }
         }
         // End of SrpServerInfo section.
+#else
+        OTBR_UNUSED_VARIABLE(aAdvertisingProxy);
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
@@ -56,6 +56,7 @@
 #endif
 
 namespace otbr {
+class AdvertisingProxy;
 namespace Host {
 class RcpHost;
 }
@@ -263,13 +264,16 @@ public:
      * retrieve the remaining telemetries instead of the immediately return. The error code
      * OT_ERRROR_FAILED will be returned if there is one or more error(s) happened in the process.
      *
-     * @param[in] aPublisher     The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
-     * @param[in] telemetryData  The telemetry data to be populated.
+     * @param[in] aPublisher         The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
+     * @param[in] aAdvertisingProxy  The AdvertisingProxy to provide SRP update counters if it is not `nullptr`.
+     * @param[in] telemetryData      The telemetry data to be populated.
      *
      * @retval OTBR_ERROR_NONE  There is no error happened in the process.
      * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
      */
-    otError RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData);
+    otError RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
+                                  const AdvertisingProxy       *aAdvertisingProxy,
+                                  threadnetwork::TelemetryData &telemetryData);
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
     /**
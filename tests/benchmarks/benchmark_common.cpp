@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes microbenchmarks for the common utilities.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "common/dns_utils.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/task_runner.hpp"
+#include "common/types.hpp"
+
+using otbr::MainloopContext;
+using otbr::MainloopManager;
+
+static void ResetMainloop(MainloopContext &aMainloop)
+{
+    aMainloop.mMaxFd   = -1;
+    aMainloop.mTimeout = {0, 0};
+    aMainloop.mFdEvents.clear();
+
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+}
+
+// Posts a batch of immediate tasks from the mainloop thread and dispatches them.
+static void BM_TaskRunnerPostAndDispatch(benchmark::State &aState)
+{
+    otbr::TaskRunner taskRunner;
+    MainloopContext  mainloop;
+    int64_t          counter = 0;
+
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < aState.range(0); i++)
+        {
+            taskRunner.Post([&counter]() { ++counter; });
+        }
+
+        ResetMainloop(mainloop);
+        taskRunner.Update(mainloop);
+        taskRunner.Process(mainloop);
+    }
+
+    benchmark::DoNotOptimize(counter);
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_TaskRunnerPostAndDispatch)->Arg(1)->Arg(64)->Arg(1024);
+
+// Posts a batch of delayed tasks and cancels them.
+static void BM_TaskRunnerPostDelayedAndCancel(benchmark::State &aState)
+{
+    otbr::TaskRunner                      taskRunner;
+    std::vector<otbr::TaskRunner::TaskId> taskIds(static_cast<size_t>(aState.range(0)));
+
+    for (auto _ : aState)
+    {
+        for (auto &taskId : taskIds)
+        {
+            taskId = taskRunner.Post(otbr::Milliseconds(1000), []() {});
+        }
+
+        for (auto taskId : taskIds)
+        {
+            taskRunner.Cancel(taskId);
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_TaskRunnerPostDelayedAndCancel)->Arg(16)->Arg(1024);
+
+class SyntheticProcessor : public otbr::MainloopProcessor
+{
+public:
+    void Update(MainloopContext &aMainloop) override { benchmark::DoNotOptimize(aMainloop.mMaxFd); }
+    void Process(const MainloopContext &aMainloop) override { benchmark::DoNotOptimize(aMainloop.mMaxFd); }
+};
+
+// Runs one mainloop iteration (without polling) with N registered processors.
+static void BM_MainloopIteration(benchmark::State &aState)
+{
+    std::vector<std::unique_ptr<SyntheticProcessor>> processors;
+    MainloopContext                                  mainloop;
+
+    for (int64_t i = 0; i < aState.range(0); i++)
+    {
+        processors.emplace_back(new SyntheticProcessor());
+    }
+
+    for (auto _ : aState)
+    {
+        ResetMainloop(mainloop);
+        MainloopManager::GetInstance().Update(mainloop);
+        MainloopManager::GetInstance().Process(mainloop);
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_MainloopIteration)->Arg(1)->Arg(8)->Arg(64);
+
+static void BM_SplitFullDnsName(benchmark::State &aState)
+{
+    const std::string kNames[] = {
+        "my-host.default.service.arpa.",
+        "_meshcop._udp.default.service.arpa.",
+        "OpenThread BR._meshcop._udp.default.service.arpa.",
+    };
+
+    for (auto _ : aState)
+    {
+        for (const std::string &name : kNames)
+        {
+            benchmark::DoNotOptimize(SplitFullDnsName(name));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * 3);
+}
+BENCHMARK(BM_SplitFullDnsName);
+
+static void BM_Ip6AddressFromString(benchmark::State &aState)
+{
+    const char *const kAddresses[] = {
+        "fe80::1",
+        "fd00:db8:0:0:8d3a:2c5e:71a:9b3f",
+        "2001:db8:85a3::8a2e:370:7334",
+    };
+    otbr::Ip6Address address;
+
+    for (auto _ : aState)
+    {
+        for (const char *str : kAddresses)
+        {
+            benchmark::DoNotOptimize(otbr::Ip6Address::FromString(str, address));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * 3);
+}
+BENCHMARK(BM_Ip6AddressFromString);
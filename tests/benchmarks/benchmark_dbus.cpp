@@ -0,0 +1,100 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes microbenchmarks for the D-Bus message encoding.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "dbus/common/dbus_message_helper.hpp"
+
+using otbr::DBus::ActiveScanResult;
+using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::TupleToDBusMessage;
+
+static std::vector<ActiveScanResult> MakeScanResults(size_t aCount)
+{
+    std::vector<ActiveScanResult> results(aCount);
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        results[i].mExtAddress    = 0x1122334455667700 + i;
+        results[i].mNetworkName   = "OpenThread-" + std::to_string(i);
+        results[i].mExtendedPanId = 0xdead00beef00cafe;
+        results[i].mSteeringData  = {0xff, 0xff, 0xff, 0xff};
+        results[i].mPanId         = static_cast<uint16_t>(0x1234 + i);
+        results[i].mJoinerUdpPort = 1000;
+        results[i].mChannel       = 15;
+        results[i].mRssi          = -40;
+        results[i].mLqi           = 200;
+        results[i].mVersion       = 4;
+    }
+
+    return results;
+}
+
+static void BM_DBusMessageEncode(benchmark::State &aState)
+{
+    std::tuple<std::vector<ActiveScanResult>> values(MakeScanResults(static_cast<size_t>(aState.range(0))));
+
+    for (auto _ : aState)
+    {
+        DBusMessage *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+        benchmark::DoNotOptimize(TupleToDBusMessage(*msg, values));
+        dbus_message_unref(msg);
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_DBusMessageEncode)->Arg(1)->Arg(32);
+
+static void BM_DBusMessageExtract(benchmark::State &aState)
+{
+    std::tuple<std::vector<ActiveScanResult>> values(MakeScanResults(static_cast<size_t>(aState.range(0))));
+    DBusMessage                              *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+    TupleToDBusMessage(*msg, values);
+
+    for (auto _ : aState)
+    {
+        std::tuple<std::vector<ActiveScanResult>> extracted;
+
+        benchmark::DoNotOptimize(DBusMessageToTuple(*msg, extracted));
+    }
+
+    dbus_message_unref(msg);
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_DBusMessageExtract)->Arg(1)->Arg(32);
@@ -0,0 +1,82 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes microbenchmarks for the mDNS publisher utilities.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "mdns/mdns.hpp"
+
+using otbr::Mdns::Publisher;
+
+static Publisher::TxtList MakeTxtList(void)
+{
+    return Publisher::TxtList{
+        {"rv", "1"},
+        {"tv", "1.4.0"},
+        {"nn", "OpenThread-1234"},
+        {"xp", "dead00beef00cafe"},
+        {"vn", "OpenThread"},
+        {"mn", "BorderRouter"},
+        {"dd"},
+    };
+}
+
+static void BM_EncodeTxtData(benchmark::State &aState)
+{
+    Publisher::TxtList txtList = MakeTxtList();
+    Publisher::TxtData txtData;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Publisher::EncodeTxtData(txtList, txtData));
+    }
+
+    aState.SetBytesProcessed(aState.iterations() * static_cast<int64_t>(txtData.size()));
+}
+BENCHMARK(BM_EncodeTxtData);
+
+static void BM_DecodeTxtData(benchmark::State &aState)
+{
+    Publisher::TxtData txtData;
+    Publisher::TxtList txtList;
+
+    Publisher::EncodeTxtData(MakeTxtList(), txtData);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(
+            Publisher::DecodeTxtData(txtList, txtData.data(), static_cast<uint16_t>(txtData.size())));
+    }
+
+    aState.SetBytesProcessed(aState.iterations() * static_cast<int64_t>(txtData.size()));
+}
+BENCHMARK(BM_DecodeTxtData);
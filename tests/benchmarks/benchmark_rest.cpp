@@ -0,0 +1,105 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes microbenchmarks for the REST JSON formatting.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include <openthread/netdiag.h>
+
+#include "rest/json.hpp"
+
+// Builds the diagnostic TLVs of one node.
+static std::vector<otNetworkDiagTlv> MakeNodeDiag(uint16_t aRloc16)
+{
+    std::vector<otNetworkDiagTlv> diag;
+    otNetworkDiagTlv              tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+    memset(tlv.mData.mExtAddress.m8, 0xa5, sizeof(tlv.mData.mExtAddress.m8));
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlv.mData.mAddr16 = aRloc16;
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_MODE;
+    tlv.mData.mMode.mRxOnWhenIdle = true;
+    tlv.mData.mMode.mDeviceType   = true;
+    tlv.mData.mMode.mNetworkData  = true;
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                                = OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA;
+    tlv.mData.mLeaderData.mPartitionId       = 0x12345678;
+    tlv.mData.mLeaderData.mWeighting         = 64;
+    tlv.mData.mLeaderData.mDataVersion       = 1;
+    tlv.mData.mLeaderData.mStableDataVersion = 1;
+    tlv.mData.mLeaderData.mLeaderRouterId    = 3;
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST;
+    tlv.mData.mIp6AddrList.mCount = 4;
+    for (uint8_t i = 0; i < tlv.mData.mIp6AddrList.mCount; i++)
+    {
+        tlv.mData.mIp6AddrList.mList[i].mFields.m8[0]  = 0xfd;
+        tlv.mData.mIp6AddrList.mList[i].mFields.m8[15] = i;
+    }
+    diag.push_back(tlv);
+
+    return diag;
+}
+
+static void BM_Diag2JsonString(benchmark::State &aState)
+{
+    std::vector<std::vector<otNetworkDiagTlv>> diagSet;
+
+    for (int64_t i = 0; i < aState.range(0); i++)
+    {
+        diagSet.push_back(MakeNodeDiag(static_cast<uint16_t>(i << 10)));
+    }
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(otbr::rest::Json::Diag2JsonString(diagSet));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_Diag2JsonString)->Arg(1)->Arg(32);
@@ -219,12 +219,16 @@ void CheckDnssdCounters(ThreadApiDBus *aApi)
 
 void CheckMdnsInfo(ThreadApiDBus *aApi)
 {
-    otbr::MdnsTelemetryInfo mdnsInfo;
+    otbr::MdnsTelemetryInfo  mdnsInfo;
+    otbr::MdnsOperationStats mdnsStats;
 
     TEST_ASSERT(aApi->GetMdnsTelemetryInfo(mdnsInfo) == OTBR_ERROR_NONE);
 
     TEST_ASSERT(mdnsInfo.mServiceRegistrations.mSuccess > 0);
     TEST_ASSERT(mdnsInfo.mServiceRegistrationEmaLatency > 0);
+
+    TEST_ASSERT(aApi->GetMdnsOperationStats(mdnsStats) == OTBR_ERROR_NONE);
+    TEST_ASSERT(mdnsStats.mServiceRegistrationLatency.mCount >= mdnsInfo.mServiceRegistrations.mSuccess);
 }
 
 void CheckNat64(ThreadApiDBus *aApi)
@@ -328,6 +332,7 @@ void CheckTelemetryData(ThreadApiDBus *aApi)
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     TEST_ASSERT(telemetryData.wpan_border_router().srp_server().state() ==
                 threadnetwork::TelemetryData::SRP_SERVER_STATE_RUNNING);
+    TEST_ASSERT(telemetryData.wpan_border_router().srp_server().has_advertising_proxy_counters());
 #endif
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     TEST_ASSERT(telemetryData.wpan_border_router().dns_server().response_counters().server_failure_count() == 0);
@@ -394,6 +399,23 @@ void CheckCapabilities(ThreadApiDBus *aApi)
     TEST_ASSERT(capabilities.nat64() == OTBR_ENABLE_NAT64);
 }
 
+void CheckMainloopStats(ThreadApiDBus *aApi)
+{
+    std::vector<otbr::MainloopProcessorStats> stats;
+    bool                                      hasProcessed = false;
+
+    TEST_ASSERT(aApi->GetMainloopStats(stats) == OTBR_ERROR_NONE);
+    TEST_ASSERT(!stats.empty());
+
+    for (const auto &processorStats : stats)
+    {
+        TEST_ASSERT(!processorStats.mName.empty());
+        hasProcessed = hasProcessed || processorStats.mProcessLatency.mCount > 0;
+    }
+
+    TEST_ASSERT(hasProcessed);
+}
+
 int main()
 {
     DBusError                      error;
@@ -510,6 +532,7 @@ int main()
                             CheckTelemetryData(api.get());
 #endif
                             CheckCapabilities(api.get());
+                            CheckMainloopStats(api.get());
                             api->FactoryReset(nullptr);
                             TEST_ASSERT(api->GetNetworkName(name) == OTBR_ERROR_NONE);
                             TEST_ASSERT(rloc16 != 0xffff);
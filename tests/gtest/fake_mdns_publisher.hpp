@@ -0,0 +1,208 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a fake mDNS publisher for unit tests.
+ */
+
+#ifndef OTBR_GTEST_FAKE_MDNS_PUBLISHER_HPP_
+#define OTBR_GTEST_FAKE_MDNS_PUBLISHER_HPP_
+
+#include <string>
+#include <vector>
+
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+namespace Mdns {
+
+// A `Publisher` which records the calls into the mDNS implementation and completes
+// publishing operations only when a test asks it to.
+class FakePublisher : public Publisher
+{
+public:
+    using Publisher::NameKey;
+
+    otbrError Start(void) override
+    {
+        mStarted = true;
+        return OTBR_ERROR_NONE;
+    }
+    void Stop(void) override
+    {
+        // The mDNS implementations drop their subscriptions when they are stopped.
+        ClearSubscriptions();
+        mStarted = false;
+    }
+    bool IsStarted(void) const override { return mStarted; }
+
+    // Returns the number of references to a subscription, or 0 if it's not subscribed.
+    uint32_t GetServiceSubscriptionCount(const std::string &aType, const std::string &aInstanceName) const
+    {
+        auto it = mServiceSubscriptions.find(std::make_pair(aType, aInstanceName));
+
+        return it != mServiceSubscriptions.end() ? it->second.mCount : 0;
+    }
+    uint32_t GetHostSubscriptionCount(const std::string &aHostName) const
+    {
+        auto it = mHostSubscriptions.find(aHostName);
+
+        return it != mHostSubscriptions.end() ? it->second.mCount : 0;
+    }
+
+    // Completes the oldest pending publishing operation with @p aError.
+    void CompleteNext(otbrError aError = OTBR_ERROR_NONE)
+    {
+        ResultCallback callback = std::move(mPendingCallbacks.front());
+
+        mPendingCallbacks.erase(mPendingCallbacks.begin());
+        std::move(callback)(aError);
+    }
+
+    // Reports a discovered service instance or host as the mDNS implementation does.
+    void Resolve(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
+    {
+        OnServiceResolved(aType, aInstanceInfo);
+    }
+    void Resolve(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+    {
+        OnHostResolved(aHostName, aHostInfo);
+    }
+
+    std::vector<std::string>    mEvents;
+    std::vector<ResultCallback> mPendingCallbacks;
+    otbrError                   mSubscribeError = OTBR_ERROR_NONE;
+
+protected:
+    otbrError PublishServiceImpl(const std::string &aHostName,
+                                 const std::string &aName,
+                                 const std::string &aType,
+                                 const SubTypeList &aSubTypeList,
+                                 uint16_t           aPort,
+                                 const TxtData     &aTxtData,
+                                 ResultCallback   &&aCallback) override
+    {
+        OTBR_UNUSED_VARIABLE(aHostName);
+        OTBR_UNUSED_VARIABLE(aSubTypeList);
+        OTBR_UNUSED_VARIABLE(aPort);
+        OTBR_UNUSED_VARIABLE(aTxtData);
+
+        RecordPublish("service " + aName + "." + aType, std::move(aCallback));
+        return OTBR_ERROR_NONE;
+    }
+
+    otbrError PublishHostImpl(const std::string &aName,
+                              const AddressList &aAddresses,
+                              ResultCallback   &&aCallback) override
+    {
+        OTBR_UNUSED_VARIABLE(aAddresses);
+
+        RecordPublish("host " + aName, std::move(aCallback));
+        return OTBR_ERROR_NONE;
+    }
+
+    otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override
+    {
+        OTBR_UNUSED_VARIABLE(aKeyData);
+
+        RecordPublish("key " + aName, std::move(aCallback));
+        return OTBR_ERROR_NONE;
+    }
+
+    void UnpublishServiceImpl(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override
+    {
+        mEvents.push_back("unpublish service " + aName + "." + aType);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override
+    {
+        mEvents.push_back("unpublish host " + aName);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override
+    {
+        mEvents.push_back("unpublish key " + aName);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void BeginPublishGroup(void) override { mEvents.push_back("begin"); }
+    void EndPublishGroup(void) override { mEvents.push_back("end"); }
+
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override
+    {
+        mEvents.push_back("subscribe service " + aInstanceName + "." + aType);
+        return mSubscribeError;
+    }
+    void UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override
+    {
+        mEvents.push_back("unsubscribe service " + aInstanceName + "." + aType);
+    }
+    otbrError SubscribeHostImpl(const std::string &aHostName) override
+    {
+        mEvents.push_back("subscribe host " + aHostName);
+        return mSubscribeError;
+    }
+    void UnsubscribeHostImpl(const std::string &aHostName) override
+    {
+        mEvents.push_back("unsubscribe host " + aHostName);
+    }
+
+    void OnServiceResolveFailedImpl(const std::string &aType,
+                                    const std::string &aInstanceName,
+                                    int32_t            aErrorCode) override
+    {
+        OTBR_UNUSED_VARIABLE(aType);
+        OTBR_UNUSED_VARIABLE(aInstanceName);
+        OTBR_UNUSED_VARIABLE(aErrorCode);
+    }
+
+    void OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override
+    {
+        OTBR_UNUSED_VARIABLE(aHostName);
+        OTBR_UNUSED_VARIABLE(aErrorCode);
+    }
+
+    otbrError DnsErrorToOtbrError(int32_t aError) override { return aError == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS; }
+
+private:
+    void RecordPublish(const std::string &aEvent, ResultCallback &&aCallback)
+    {
+        mEvents.push_back(TakePublishGroup() ? aEvent + " (grouped)" : aEvent);
+        mPendingCallbacks.push_back(std::move(aCallback));
+    }
+
+    bool mStarted = false;
+};
+
+} // namespace Mdns
+} // namespace otbr
+
+#endif // OTBR_GTEST_FAKE_MDNS_PUBLISHER_HPP_
@@ -0,0 +1,496 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/mainloop_manager.hpp"
+#include "host/rcp_host.hpp"
+#include "sdp_proxy/advertising_proxy.hpp"
+
+#include "fake_mdns_publisher.hpp"
+
+namespace otbr {
+
+// Drives the bookkeeping of an `AdvertisingProxy` whose Thread host is not initialized,
+// so that no SRP server is involved.
+class AdvertisingProxyTest : public ::testing::Test
+{
+protected:
+    using AdvertisedHost = AdvertisingProxy::AdvertisedHost;
+
+    AdvertisingProxyTest(void)
+        : mHost("wpan0", {}, "", /* aDryRun */ false, /* aEnableAutoAttach */ false)
+        , mProxy(mHost, mPublisher)
+    {
+    }
+
+    static bool UpdateService(AdvertisedHost    &aAdvertisedHost,
+                              bool               aIsIncremental,
+                              const std::string &aFullServiceName,
+                              bool               aIsDeleted,
+                              uint64_t           aDigest)
+    {
+        return AdvertisingProxy::UpdateAdvertisedService(aAdvertisedHost, aIsIncremental, aFullServiceName,
+                                                         aIsDeleted, aDigest);
+    }
+
+    static bool UpdateAddresses(AdvertisedHost                &aAdvertisedHost,
+                                bool                           aIsIncremental,
+                                const std::vector<Ip6Address> &aAddresses)
+    {
+        return AdvertisingProxy::UpdateAdvertisedAddresses(aAdvertisedHost, aIsIncremental, aAddresses);
+    }
+
+    void AddOutstandingUpdate(otSrpServerServiceUpdateId aId, const std::string &aHostName, bool aIsIncremental)
+    {
+        AdvertisingProxy::OutstandingUpdate &update = mProxy.mOutstandingUpdates[aId];
+
+        update.mHostName      = aHostName;
+        update.mIsIncremental = aIsIncremental;
+    }
+
+    // Queues an update which publishes @p aHostName, or un-publishes it if @p aIsUnpublish is true.
+    // The fake publisher completes un-publishing synchronously.
+    void AddPendingUpdate(otSrpServerServiceUpdateId aId,
+                          const std::string         &aHostName,
+                          bool                       aIsIncremental,
+                          bool                       aIsUnpublish = false)
+    {
+        AdvertisingProxy::PendingUpdate update;
+
+        update.mId            = aId;
+        update.mHost          = nullptr;
+        update.mHostName      = aHostName;
+        update.mReceiveTime   = Clock::now();
+        update.mExpireTime    = update.mReceiveTime + Seconds(10);
+        update.mIsIncremental = aIsIncremental;
+        if (aIsUnpublish)
+        {
+            update.mBatch.UnpublishHost(aHostName);
+        }
+        else
+        {
+            update.mBatch.PublishHost(aHostName, {});
+        }
+        mProxy.mPendingUpdates.push_back(std::move(update));
+    }
+
+    void ExpirePendingUpdate(otSrpServerServiceUpdateId aId)
+    {
+        for (AdvertisingProxy::PendingUpdate &update : mProxy.mPendingUpdates)
+        {
+            if (update.mId == aId)
+            {
+                update.mExpireTime = Clock::now() - Milliseconds(1);
+            }
+        }
+    }
+
+    bool IsOutstandingUpdateStale(otSrpServerServiceUpdateId aId) const
+    {
+        return mProxy.mOutstandingUpdates.at(aId).mIsStale;
+    }
+
+    bool IsPendingUpdateStale(otSrpServerServiceUpdateId aId) const
+    {
+        bool isStale = false;
+
+        for (const AdvertisingProxy::PendingUpdate &update : mProxy.mPendingUpdates)
+        {
+            if (update.mId == aId)
+            {
+                isStale = update.mIsStale;
+            }
+        }
+
+        return isStale;
+    }
+
+    void SetAdvertisedHost(const std::string &aHostName) { mProxy.mAdvertisedHosts[aHostName]; }
+    bool IsHostAdvertised(const std::string &aHostName) const
+    {
+        return mProxy.mAdvertisedHosts.find(aHostName) != mProxy.mAdvertisedHosts.end();
+    }
+
+    void ForgetAdvertisedHost(const std::string &aHostName) { mProxy.ForgetAdvertisedHost(aHostName); }
+    void DispatchPendingUpdates(void) { mProxy.DispatchPendingUpdates(); }
+    void DropPendingUpdates(void) { mProxy.DropPendingUpdates(); }
+    void AbortPendingUpdates(void) { mProxy.AbortPendingUpdates(); }
+
+    // Starts re-advertising {time since the last update in milliseconds, full host name} hosts.
+    // The hosts are not known to the SRP server, so the slices are taken but nothing is published.
+    void StartReadvertise(std::vector<std::pair<uint32_t, std::string>> aHosts)
+    {
+        mProxy.mIsEnabled = true;
+        mPublisher.Start();
+        mProxy.StartReadvertise(std::move(aHosts));
+    }
+
+    static uint16_t     GetMaxReadvertiseInFlight(void) { return AdvertisingProxy::kMaxReadvertiseInFlight; }
+    static uint16_t     GetReadvertiseHostsPerSlice(void) { return AdvertisingProxy::kReadvertiseHostsPerSlice; }
+    static Microseconds GetReadvertiseSliceInterval(void) { return AdvertisingProxy::kReadvertiseSliceInterval; }
+
+    std::vector<std::string> TakeReadvertiseSlice(void) { return mProxy.TakeReadvertiseSlice(); }
+    void SetReadvertiseInFlight(uint16_t aInFlight) { mProxy.mReadvertiseInFlight = aInFlight; }
+    const std::deque<std::string> &GetReadvertiseQueue(void) const { return mProxy.mReadvertiseQueue; }
+
+    // Runs one mainloop iteration, which waits at most @p aMaxWait for the next timer and fires it.
+    // Returns how long the iteration would wait.
+    static Microseconds ProcessMainloop(Microseconds aMaxWait)
+    {
+        MainloopContext mainloop;
+        Microseconds    wait;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = ToTimeval(aMaxWait);
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        MainloopManager::GetInstance().Update(mainloop);
+        wait = FromTimeval<Microseconds>(mainloop.mTimeout);
+        MainloopManager::GetInstance().Poll(mainloop);
+        MainloopManager::GetInstance().Process(mainloop);
+
+        return wait;
+    }
+
+    size_t GetOutstandingUpdateCount(void) const { return mProxy.mOutstandingUpdates.size(); }
+    size_t GetPendingUpdateCount(void) const { return mProxy.mPendingUpdates.size(); }
+    bool   IsDispatching(void) const { return mProxy.mIsDispatching; }
+
+    Host::RcpHost       mHost;
+    Mdns::FakePublisher mPublisher;
+    AdvertisingProxy    mProxy;
+};
+
+TEST_F(AdvertisingProxyTest, NewHostIsPublishedInFull)
+{
+    AdvertisedHost advertisedHost;
+
+    EXPECT_TRUE(UpdateService(advertisedHost, /* aIsIncremental */ false, "s1._t._udp", false, 1));
+    EXPECT_TRUE(UpdateService(advertisedHost, /* aIsIncremental */ false, "s2._t._udp", true, 0));
+    EXPECT_TRUE(UpdateAddresses(advertisedHost, /* aIsIncremental */ false, {}));
+
+    // A deleted service is un-published, but it isn't remembered.
+    EXPECT_EQ(advertisedHost.mServiceDigests.size(), 1u);
+    EXPECT_EQ(advertisedHost.mServiceDigests.at("s1._t._udp"), 1u);
+}
+
+TEST_F(AdvertisingProxyTest, RefreshPublishesNothing)
+{
+    AdvertisedHost advertisedHost;
+    Ip6Address     address;
+
+    ASSERT_EQ(Ip6Address::FromString("fd00::1", address), OTBR_ERROR_NONE);
+    UpdateService(advertisedHost, /* aIsIncremental */ false, "s1._t._udp", false, 1);
+    UpdateAddresses(advertisedHost, /* aIsIncremental */ false, {address});
+
+    EXPECT_FALSE(UpdateService(advertisedHost, /* aIsIncremental */ true, "s1._t._udp", false, 1));
+    EXPECT_FALSE(UpdateAddresses(advertisedHost, /* aIsIncremental */ true, {address}));
+}
+
+TEST_F(AdvertisingProxyTest, ChangesArePublished)
+{
+    AdvertisedHost advertisedHost;
+    Ip6Address     address1;
+    Ip6Address     address2;
+
+    ASSERT_EQ(Ip6Address::FromString("fd00::1", address1), OTBR_ERROR_NONE);
+    ASSERT_EQ(Ip6Address::FromString("fd00::2", address2), OTBR_ERROR_NONE);
+    UpdateService(advertisedHost, /* aIsIncremental */ false, "s1._t._udp", false, 1);
+    UpdateAddresses(advertisedHost, /* aIsIncremental */ false, {address1});
+
+    EXPECT_TRUE(UpdateService(advertisedHost, /* aIsIncremental */ true, "s1._t._udp", false, 2));
+    EXPECT_EQ(advertisedHost.mServiceDigests.at("s1._t._udp"), 2u);
+    EXPECT_TRUE(UpdateService(advertisedHost, /* aIsIncremental */ true, "s2._t._udp", false, 3));
+    EXPECT_TRUE(UpdateAddresses(advertisedHost, /* aIsIncremental */ true, {address1, address2}));
+    EXPECT_EQ(advertisedHost.mAddresses.size(), 2u);
+}
+
+TEST_F(AdvertisingProxyTest, OnlyAdvertisedDeletedServicesAreUnpublished)
+{
+    AdvertisedHost advertisedHost;
+
+    UpdateService(advertisedHost, /* aIsIncremental */ false, "s1._t._udp", false, 1);
+
+    EXPECT_TRUE(UpdateService(advertisedHost, /* aIsIncremental */ true, "s1._t._udp", true, 0));
+    EXPECT_TRUE(advertisedHost.mServiceDigests.empty());
+
+    // The service has already been un-published.
+    EXPECT_FALSE(UpdateService(advertisedHost, /* aIsIncremental */ true, "s1._t._udp", true, 0));
+
+    // A full update un-publishes the deleted service anyway.
+    EXPECT_TRUE(UpdateService(advertisedHost, /* aIsIncremental */ false, "s1._t._udp", true, 0));
+}
+
+TEST_F(AdvertisingProxyTest, FailedBatchInvalidatesIncrementalUpdatesOfHost)
+{
+    SetAdvertisedHost("host1");
+    SetAdvertisedHost("host2");
+    AddOutstandingUpdate(1, "host1", /* aIsIncremental */ true);
+    AddOutstandingUpdate(2, "host1", /* aIsIncremental */ false);
+    AddOutstandingUpdate(3, "host2", /* aIsIncremental */ true);
+    AddPendingUpdate(4, "host1", /* aIsIncremental */ true);
+    AddPendingUpdate(5, "host1", /* aIsIncremental */ false);
+    AddPendingUpdate(6, "host2", /* aIsIncremental */ true);
+
+    ForgetAdvertisedHost("host1");
+
+    // The next update of the host is published in full.
+    EXPECT_FALSE(IsHostAdvertised("host1"));
+    EXPECT_TRUE(IsHostAdvertised("host2"));
+
+    // The in-flight incremental update of the host fails, and the queued one is rebuilt.
+    EXPECT_TRUE(IsOutstandingUpdateStale(1));
+    EXPECT_TRUE(IsPendingUpdateStale(4));
+
+    // Full updates and the updates of other hosts are unaffected.
+    EXPECT_FALSE(IsOutstandingUpdateStale(2));
+    EXPECT_FALSE(IsOutstandingUpdateStale(3));
+    EXPECT_FALSE(IsPendingUpdateStale(5));
+    EXPECT_FALSE(IsPendingUpdateStale(6));
+}
+
+TEST_F(AdvertisingProxyTest, UpdatesBeyondLimitAreQueued)
+{
+    mProxy.SetMaxInFlightUpdates(2);
+    AddPendingUpdate(1, "host1", /* aIsIncremental */ false);
+    AddPendingUpdate(2, "host2", /* aIsIncremental */ false);
+    AddPendingUpdate(3, "host3", /* aIsIncremental */ false);
+    AddPendingUpdate(4, "host4", /* aIsIncremental */ false);
+    DispatchPendingUpdates();
+
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({"begin", "host host1 (grouped)", "end", "begin",
+                                                            "host host2 (grouped)", "end"}));
+    EXPECT_EQ(GetOutstandingUpdateCount(), 2u);
+    EXPECT_EQ(GetPendingUpdateCount(), 2u);
+    EXPECT_EQ(mProxy.GetUpdateCounters().mQueuedUpdates, 2u);
+    EXPECT_EQ(mProxy.GetUpdateCounters().mMaxQueuedUpdates, 2u);
+
+    // A completed update makes room for the oldest queued one.
+    mPublisher.mEvents.clear();
+    mPublisher.CompleteNext();
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({"begin", "host host3 (grouped)", "end"}));
+    EXPECT_EQ(mProxy.GetUpdateCounters().mQueuedUpdates, 1u);
+
+    // Raising the limit dispatches the queued updates at once.
+    mProxy.SetMaxInFlightUpdates(0);
+    EXPECT_EQ(GetOutstandingUpdateCount(), 3u);
+    EXPECT_EQ(GetPendingUpdateCount(), 0u);
+
+    while (!mPublisher.mPendingCallbacks.empty())
+    {
+        mPublisher.CompleteNext();
+    }
+    EXPECT_EQ(GetOutstandingUpdateCount(), 0u);
+    EXPECT_EQ(mProxy.GetUpdateCounters().mCommitLatency.mCount, 4u);
+    EXPECT_EQ(mProxy.GetUpdateCounters().mMaxQueuedUpdates, 2u);
+}
+
+TEST_F(AdvertisingProxyTest, ReadvertiseRanksRecentlyUpdatedHostsFirst)
+{
+    // Nothing is taken while the in-flight budget is used up, so the whole ranking is queued.
+    SetReadvertiseInFlight(GetMaxReadvertiseInFlight());
+    StartReadvertise({{3000, "host3.default.service.arpa."},
+                      {UINT32_MAX, "deleted.default.service.arpa."},
+                      {1000, "host1.default.service.arpa."},
+                      {2000, "host2.default.service.arpa."},
+                      {1000, "host4.default.service.arpa."}});
+
+    EXPECT_EQ(GetReadvertiseQueue(), std::deque<std::string>({"host1.default.service.arpa.",
+                                                              "host4.default.service.arpa.",
+                                                              "host2.default.service.arpa.",
+                                                              "host3.default.service.arpa.",
+                                                              "deleted.default.service.arpa."}));
+    EXPECT_TRUE(mProxy.GetReadvertiseProgress().mIsRunning);
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mTotalHosts, 5u);
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mPublishedHosts, 0u);
+}
+
+TEST_F(AdvertisingProxyTest, ReadvertiseSlicesAreCappedByInFlightHosts)
+{
+    std::vector<std::pair<uint32_t, std::string>> hosts;
+
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        hosts.emplace_back(i, "host" + std::to_string(i) + ".default.service.arpa.");
+    }
+    SetReadvertiseInFlight(GetMaxReadvertiseInFlight());
+    StartReadvertise(std::move(hosts));
+
+    // A slice is only as large as the room left in the in-flight budget.
+    SetReadvertiseInFlight(GetMaxReadvertiseInFlight() - 3);
+    EXPECT_EQ(TakeReadvertiseSlice(), std::vector<std::string>({"host0.default.service.arpa.",
+                                                                "host1.default.service.arpa.",
+                                                                "host2.default.service.arpa."}));
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mPublishedHosts, 3u);
+
+    SetReadvertiseInFlight(0);
+    EXPECT_EQ(TakeReadvertiseSlice().size(), GetReadvertiseHostsPerSlice());
+    EXPECT_EQ(GetReadvertiseQueue().front(), "host11.default.service.arpa.");
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mPublishedHosts, 11u);
+}
+
+TEST_F(AdvertisingProxyTest, ReadvertiseSlicesArePaced)
+{
+    std::vector<std::pair<uint32_t, std::string>> hosts;
+    Microseconds                                  wait;
+
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        hosts.emplace_back(i, "host" + std::to_string(i) + ".default.service.arpa.");
+    }
+    StartReadvertise(std::move(hosts));
+
+    // The first slice is taken at once.
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mTotalHosts, 20u);
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mPublishedHosts, 8u);
+    EXPECT_EQ(GetReadvertiseQueue().size(), 12u);
+
+    // The next slices are taken one interval apart.
+    wait = ProcessMainloop(Seconds(1));
+    EXPECT_GT(wait, Microseconds::zero());
+    EXPECT_LE(wait, GetReadvertiseSliceInterval());
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mPublishedHosts, 16u);
+
+    wait = ProcessMainloop(Seconds(1));
+    EXPECT_GT(wait, GetReadvertiseSliceInterval() / 2);
+    EXPECT_LE(wait, GetReadvertiseSliceInterval());
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mPublishedHosts, 20u);
+    EXPECT_TRUE(GetReadvertiseQueue().empty());
+    EXPECT_TRUE(mProxy.GetReadvertiseProgress().mIsRunning);
+
+    // The re-advertisement completes on the slice after the last hosts.
+    ProcessMainloop(Seconds(1));
+    EXPECT_FALSE(mProxy.GetReadvertiseProgress().mIsRunning);
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mPublishedHosts, 20u);
+}
+
+TEST_F(AdvertisingProxyTest, ReadvertiseStopsWhenPublisherStops)
+{
+    std::vector<std::pair<uint32_t, std::string>> hosts;
+
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        hosts.emplace_back(i, "host" + std::to_string(i) + ".default.service.arpa.");
+    }
+    StartReadvertise(std::move(hosts));
+    mPublisher.Stop();
+
+    ProcessMainloop(Seconds(1));
+    EXPECT_FALSE(mProxy.GetReadvertiseProgress().mIsRunning);
+    EXPECT_TRUE(GetReadvertiseQueue().empty());
+    EXPECT_EQ(mProxy.GetReadvertiseProgress().mPublishedHosts, 8u);
+}
+
+TEST_F(AdvertisingProxyTest, SynchronousResultsDontReenterDispatching)
+{
+    mProxy.SetMaxInFlightUpdates(1);
+    AddPendingUpdate(1, "host1", /* aIsIncremental */ false, /* aIsUnpublish */ true);
+    AddPendingUpdate(2, "host2", /* aIsIncremental */ false, /* aIsUnpublish */ true);
+    AddPendingUpdate(3, "host3", /* aIsIncremental */ false);
+    DispatchPendingUpdates();
+
+    // The un-publishing updates complete before `PublishBatch()` returns, and the loop which is
+    // already dispatching publishes the next ones in order.
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({"unpublish host host1", "unpublish host host2", "begin",
+                                                            "host host3 (grouped)", "end"}));
+    EXPECT_FALSE(IsDispatching());
+    EXPECT_EQ(GetOutstandingUpdateCount(), 1u);
+    EXPECT_EQ(GetPendingUpdateCount(), 0u);
+    EXPECT_EQ(mProxy.GetUpdateCounters().mCommitLatency.mCount, 2u);
+}
+
+TEST_F(AdvertisingProxyTest, ExpiredUpdatesAreDropped)
+{
+    SetAdvertisedHost("host1");
+    SetAdvertisedHost("host2");
+    AddPendingUpdate(1, "host1", /* aIsIncremental */ true);
+    AddPendingUpdate(2, "host2", /* aIsIncremental */ true);
+    ExpirePendingUpdate(1);
+    DispatchPendingUpdates();
+
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({"begin", "host host2 (grouped)", "end"}));
+    EXPECT_EQ(mProxy.GetUpdateCounters().mExpiredUpdates, 1u);
+    EXPECT_EQ(mProxy.GetUpdateCounters().mQueuedUpdates, 0u);
+
+    // The dropped batch was never published.
+    EXPECT_FALSE(IsHostAdvertised("host1"));
+    EXPECT_TRUE(IsHostAdvertised("host2"));
+}
+
+TEST_F(AdvertisingProxyTest, AbortedUpdatesForgetTheirHosts)
+{
+    SetAdvertisedHost("host1");
+    SetAdvertisedHost("host2");
+    SetAdvertisedHost("host3");
+    mProxy.SetMaxInFlightUpdates(1);
+    AddPendingUpdate(1, "host1", /* aIsIncremental */ true);
+    AddPendingUpdate(2, "host2", /* aIsIncremental */ true);
+    AddPendingUpdate(3, "host2", /* aIsIncremental */ true);
+    DispatchPendingUpdates();
+
+    AbortPendingUpdates();
+    EXPECT_EQ(GetPendingUpdateCount(), 0u);
+    EXPECT_EQ(mProxy.GetUpdateCounters().mQueuedUpdates, 0u);
+    EXPECT_TRUE(IsHostAdvertised("host1"));
+    EXPECT_FALSE(IsHostAdvertised("host2"));
+    EXPECT_TRUE(IsHostAdvertised("host3"));
+
+    // The in-flight update still completes.
+    mPublisher.CompleteNext();
+    EXPECT_EQ(GetOutstandingUpdateCount(), 0u);
+    EXPECT_TRUE(IsHostAdvertised("host1"));
+}
+
+TEST_F(AdvertisingProxyTest, UpdatesDroppedOnResetForgetTheirHosts)
+{
+    SetAdvertisedHost("host1");
+    SetAdvertisedHost("host2");
+    mProxy.SetMaxInFlightUpdates(1);
+    AddPendingUpdate(1, "host1", /* aIsIncremental */ true);
+    AddPendingUpdate(2, "host2", /* aIsIncremental */ true);
+    DispatchPendingUpdates();
+
+    // This is what the reset handler does, which can't be triggered without an OpenThread instance.
+    DropPendingUpdates();
+    EXPECT_EQ(GetPendingUpdateCount(), 0u);
+    EXPECT_EQ(mProxy.GetUpdateCounters().mQueuedUpdates, 0u);
+    EXPECT_TRUE(IsHostAdvertised("host1"));
+    EXPECT_FALSE(IsHostAdvertised("host2"));
+
+    mPublisher.CompleteNext();
+}
+
+} // namespace otbr
@@ -198,3 +198,34 @@ TEST(AsyncTask, TestMultipleStepsFailedHalfWay)
     EXPECT_EQ(resultHandlerCalledTimes, 1);
     EXPECT_EQ(error, OT_ERROR_BUSY);
 }
+
+TEST(AsyncTask, TestCreateRecyclesStorage)
+{
+    AsyncTaskPtr task;
+    AsyncTaskPtr step1;
+    AsyncTask   *released;
+    int          resultHandlerCalledTimes = 0;
+
+    auto errorHandler = [&resultHandlerCalledTimes](otError aError, const std::string &aErrorInfo) {
+        OTBR_UNUSED_VARIABLE(aError);
+        OTBR_UNUSED_VARIABLE(aErrorInfo);
+
+        resultHandlerCalledTimes++;
+    };
+
+    task = AsyncTask::Create(errorHandler);
+    task->First([&step1](AsyncTaskPtr aNext) { step1 = std::move(aNext); });
+    task->Run();
+    step1->SetResult(OT_ERROR_NONE, "");
+
+    released = task.get();
+    step1    = nullptr;
+    task     = nullptr;
+
+    // The storage of the released step is handed out to the next task.
+    task = AsyncTask::Create(errorHandler);
+    EXPECT_EQ(task.get(), released);
+    task->Run();
+
+    EXPECT_EQ(resultHandlerCalledTimes, 2);
+}
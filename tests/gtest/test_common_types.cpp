@@ -101,3 +101,70 @@ TEST(Ip6Prefix, EqualityOperator)
 //-------------------------------------------------------------
 // Test for MacAddress
 // TODO: Add MacAddress tests
+
+//-------------------------------------------------------------
+// Test for LatencyHistogram
+
+TEST(LatencyHistogram, RecordsIntoLogLinearBuckets)
+{
+    otbr::LatencyHistogram histogram;
+
+    histogram.Record(0);
+    histogram.Record(3);
+    histogram.Record(5);
+    histogram.Record(1000);
+    histogram.Record(UINT64_MAX);
+
+    EXPECT_EQ(histogram.mCount, 5U);
+    EXPECT_EQ(histogram.mMaxUs, UINT32_MAX);
+    EXPECT_EQ(histogram.mBuckets[0], 1U);  // 0us
+    EXPECT_EQ(histogram.mBuckets[3], 1U);  // 3us
+    EXPECT_EQ(histogram.mBuckets[5], 1U);  // [5, 6) us
+    EXPECT_EQ(histogram.mBuckets[35], 1U); // [896, 1024) us
+    EXPECT_EQ(histogram.mBuckets[otbr::LatencyHistogram::kNumBuckets - 1], 1U);
+}
+
+TEST(LatencyHistogram, BucketBounds)
+{
+    using otbr::LatencyHistogram;
+
+    for (uint8_t bucket = 0; bucket < LatencyHistogram::kNumBuckets - 1; bucket++)
+    {
+        uint64_t lower = LatencyHistogram::GetBucketLowerBoundUs(bucket);
+        uint64_t upper = LatencyHistogram::GetBucketLowerBoundUs(bucket + 1);
+
+        EXPECT_LT(lower, upper);
+        EXPECT_EQ(LatencyHistogram::GetBucket(lower), bucket);
+        EXPECT_EQ(LatencyHistogram::GetBucket(upper - 1), bucket);
+
+        // The width of a bucket is at most a quarter of its lower bound, past the linear buckets.
+        EXPECT_TRUE(lower < LatencyHistogram::kSubBucketCount || (upper - lower) * 4 <= lower);
+    }
+
+    EXPECT_EQ(LatencyHistogram::GetBucketLowerBoundUs(LatencyHistogram::kNumBuckets - 1), 7U << 21);
+    EXPECT_EQ(LatencyHistogram::GetBucket(uint64_t{1} << 24), LatencyHistogram::kNumBuckets - 1);
+}
+
+TEST(LatencyHistogram, EstimatesPercentiles)
+{
+    otbr::LatencyHistogram histogram;
+
+    EXPECT_EQ(histogram.GetPercentileUs(99), 0U);
+
+    // 90 latencies in [512, 640) us and 10 latencies in [4096, 5120) us.
+    for (int i = 0; i < 90; i++)
+    {
+        histogram.Record(600);
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        histogram.Record(5000);
+    }
+
+    EXPECT_EQ(histogram.GetPercentileUs(50), 512U + 128U * 50 / 90);
+    EXPECT_EQ(histogram.GetPercentileUs(90), 640U);
+    EXPECT_EQ(histogram.GetPercentileUs(95), 4096U + 1024U * 5 / 10);
+    EXPECT_EQ(histogram.GetPercentileUs(99), 5000U); // Capped by the max latency.
+    EXPECT_EQ(histogram.GetPercentileUs(100), 5000U);
+    EXPECT_EQ(histogram.GetPercentileUs(0), 512U + 128U / 90);
+}
@@ -0,0 +1,444 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "host/rcp_host.hpp"
+#include "sdp_proxy/discovery_proxy.hpp"
+
+#include "fake_mdns_publisher.hpp"
+
+namespace otbr {
+namespace Dnssd {
+
+// Drives the subscriptions of a `DiscoveryProxy` whose Thread host is not initialized,
+// so that no DNS-SD server is involved and no queries are answered.
+class DiscoveryProxyTest : public ::testing::Test
+{
+protected:
+    using CachedAnswer = DiscoveryProxy::CachedAnswer;
+
+    static constexpr const char *kServiceName  = "_test._tcp.default.service.arpa.";
+    static constexpr const char *kInstanceName = "service1._test._tcp.default.service.arpa.";
+    static constexpr const char *kHostName     = "host1.default.service.arpa.";
+
+    DiscoveryProxyTest(void)
+        : mHost("wpan0", {}, "", /* aDryRun */ false, /* aEnableAutoAttach */ false)
+        , mProxy(mHost, mPublisher)
+    {
+    }
+
+    // This is what `Start()` does, which can't be called without an OpenThread instance.
+    void Enable(void)
+    {
+        mProxy.mIsEnabled    = true;
+        mProxy.mSubscriberId = mPublisher.AddSubscriptionCallbacks(
+            [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+                mProxy.OnServiceDiscovered(aType, aInstanceInfo);
+            },
+            [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfoPtr &aHostInfo) {
+                mProxy.OnHostDiscovered(aHostName, aHostInfo);
+            });
+    }
+
+    void Subscribe(const char *aFullName) { mProxy.OnDiscoveryProxySubscribe(aFullName); }
+    void Unsubscribe(const char *aFullName) { mProxy.OnDiscoveryProxyUnsubscribe(aFullName); }
+
+    const DiscoveryProxy::Subscription *FindSubscription(const char *aFullName) const
+    {
+        auto it = mProxy.mSubscriptions.find(DiscoveryProxy::MakeSubscriptionKey(SplitFullDnsName(aFullName)));
+
+        return it != mProxy.mSubscriptions.end() ? &it->second : nullptr;
+    }
+
+    size_t GetSubscriptionCount(void) const { return mProxy.mSubscriptions.size(); }
+    size_t GetPendingCacheAnswerCount(void) const { return mProxy.mPendingCacheAnswers.size(); }
+    bool   IsMaintenanceScheduled(void) const { return mProxy.mMaintenanceTimerId != 0; }
+
+    Timepoint GetMaintenanceTime(void) const { return mProxy.mMaintenanceTime; }
+
+    // Moves the subscriptions and their answers @p aDuration into the past.
+    void Age(Clock::duration aDuration)
+    {
+        for (auto &subscription : mProxy.mSubscriptions)
+        {
+            subscription.second.mLingerDeadline -= aDuration;
+
+            for (auto &answer : subscription.second.mAnswers)
+            {
+                answer.second.mUpdateTime -= aDuration;
+                answer.second.mExpireTime -= aDuration;
+            }
+        }
+    }
+
+    void AgePastLingerTime(void)
+    {
+        Age(std::chrono::duration_cast<Clock::duration>(DiscoveryProxy::kSubscriptionLingerTime));
+    }
+
+    void HandleMaintenanceTimer(void) { mProxy.HandleMaintenanceTimer(); }
+    void ReleaseSubscriptionReferences(void) { mProxy.ReleaseSubscriptionReferences(); }
+    void ClearSubscriptions(void) { mProxy.ClearSubscriptions(); }
+
+    static uint32_t GetRemainingTtl(Clock::duration aRemaining)
+    {
+        CachedAnswer answer;
+        Timepoint    now = Clock::now();
+
+        answer.mExpireTime = now + aRemaining;
+
+        return DiscoveryProxy::GetRemainingTtl(answer, now);
+    }
+
+    // Runs one mainloop iteration without waiting, which fires the due timers.
+    static void ProcessMainloop(void)
+    {
+        MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {0, 0};
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        MainloopManager::GetInstance().Update(mainloop);
+        MainloopManager::GetInstance().Poll(mainloop);
+        MainloopManager::GetInstance().Process(mainloop);
+    }
+
+    static Mdns::Publisher::DiscoveredInstanceInfo MakeInstanceInfo(bool aIsRemoved = false)
+    {
+        Mdns::Publisher::DiscoveredInstanceInfo instanceInfo;
+        Ip6Address                              address;
+
+        SuccessOrDie(Ip6Address::FromString("2002::1", address), "");
+        instanceInfo.mRemoved    = aIsRemoved;
+        instanceInfo.mNetifIndex = 1;
+        instanceInfo.mName       = "service1";
+        instanceInfo.mHostName   = "host1.local.";
+        instanceInfo.mAddresses  = {address};
+        instanceInfo.mPort       = 1234;
+        instanceInfo.mTtl        = 120;
+
+        return instanceInfo;
+    }
+
+    static Mdns::Publisher::DiscoveredHostInfo MakeHostInfo(void)
+    {
+        Mdns::Publisher::DiscoveredHostInfo hostInfo;
+        Ip6Address                          address;
+
+        SuccessOrDie(Ip6Address::FromString("2002::1", address), "");
+        hostInfo.mHostName   = "host1.local.";
+        hostInfo.mAddresses  = {address};
+        hostInfo.mNetifIndex = 1;
+        hostInfo.mTtl        = 120;
+
+        return hostInfo;
+    }
+
+    Mdns::FakePublisher mPublisher;
+    Host::RcpHost       mHost;
+    DiscoveryProxy      mProxy;
+};
+
+constexpr const char *DiscoveryProxyTest::kServiceName;
+constexpr const char *DiscoveryProxyTest::kInstanceName;
+constexpr const char *DiscoveryProxyTest::kHostName;
+
+TEST_F(DiscoveryProxyTest, SubscriptionsAreReferenceCounted)
+{
+    Enable();
+    Subscribe(kServiceName);
+    Subscribe(kServiceName);
+    Subscribe(kHostName);
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({
+                                      "subscribe service ._test._tcp",
+                                      "subscribe host host1",
+                                  }));
+    ASSERT_NE(FindSubscription(kServiceName), nullptr);
+    EXPECT_EQ(FindSubscription(kServiceName)->mRefCount, 2u);
+
+    mPublisher.mEvents.clear();
+    Unsubscribe(kServiceName);
+    EXPECT_EQ(FindSubscription(kServiceName)->mRefCount, 1u);
+    EXPECT_FALSE(IsMaintenanceScheduled());
+
+    // The last query keeps the mDNS subscription lingering.
+    Unsubscribe(kServiceName);
+    Unsubscribe(kHostName);
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+    EXPECT_EQ(FindSubscription(kServiceName)->mRefCount, 0u);
+    EXPECT_TRUE(IsMaintenanceScheduled());
+
+    // An unbalanced unsubscription is ignored.
+    Unsubscribe(kServiceName);
+    EXPECT_EQ(FindSubscription(kServiceName)->mRefCount, 0u);
+}
+
+TEST_F(DiscoveryProxyTest, LingeringSubscriptionIsReusedUntilItExpires)
+{
+    Enable();
+    Subscribe(kServiceName);
+    Subscribe(kHostName);
+    Unsubscribe(kServiceName);
+    Unsubscribe(kHostName);
+
+    // A query during the lingering time reuses the mDNS subscription.
+    Subscribe(kHostName);
+    EXPECT_EQ(FindSubscription(kHostName)->mRefCount, 1u);
+
+    mPublisher.mEvents.clear();
+    AgePastLingerTime();
+    HandleMaintenanceTimer();
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({"unsubscribe service ._test._tcp"}));
+    EXPECT_EQ(FindSubscription(kServiceName), nullptr);
+    EXPECT_NE(FindSubscription(kHostName), nullptr);
+    EXPECT_EQ(GetSubscriptionCount(), 1u);
+}
+
+TEST_F(DiscoveryProxyTest, CachedAnswersAnswerNewQueries)
+{
+    Enable();
+    Subscribe(kServiceName);
+    Subscribe(kInstanceName);
+    mPublisher.Resolve("_test._tcp", MakeInstanceInfo());
+
+    // Both the service and the service instance subscriptions cache the answer.
+    ASSERT_EQ(FindSubscription(kServiceName)->mAnswers.size(), 1u);
+    ASSERT_EQ(FindSubscription(kInstanceName)->mAnswers.size(), 1u);
+    EXPECT_EQ(FindSubscription(kServiceName)->mAnswers.begin()->second.mInstanceName, "service1");
+    EXPECT_EQ(GetPendingCacheAnswerCount(), 0u);
+
+    // A new query is answered from the cache on the next mainloop iteration, without querying mDNS.
+    mPublisher.mEvents.clear();
+    Subscribe(kServiceName);
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+    EXPECT_EQ(GetPendingCacheAnswerCount(), 1u);
+    ProcessMainloop();
+    EXPECT_EQ(GetPendingCacheAnswerCount(), 0u);
+
+    mPublisher.Resolve("_test._tcp", MakeInstanceInfo(/* aIsRemoved */ true));
+    EXPECT_TRUE(FindSubscription(kServiceName)->mAnswers.empty());
+    EXPECT_TRUE(FindSubscription(kInstanceName)->mAnswers.empty());
+
+    // Without cached answers, the mDNS publisher is relied on for the new query.
+    Subscribe(kServiceName);
+    EXPECT_EQ(GetPendingCacheAnswerCount(), 0u);
+}
+
+TEST_F(DiscoveryProxyTest, CachedAnswersAreRequeriedBeforeExpiring)
+{
+    uint64_t subscriberId;
+
+    Enable();
+    Subscribe(kServiceName);
+    Subscribe(kHostName);
+    mPublisher.Resolve("_test._tcp", MakeInstanceInfo());
+    mPublisher.Resolve("host1", MakeHostInfo());
+
+    // The refresh is scheduled at 80% of the TTL.
+    {
+        const CachedAnswer &answer = FindSubscription(kServiceName)->mAnswers.begin()->second;
+
+        EXPECT_TRUE(IsMaintenanceScheduled());
+        EXPECT_EQ(answer.mExpireTime - answer.mUpdateTime, Seconds(120));
+        EXPECT_EQ(GetMaintenanceTime() - answer.mUpdateTime, Seconds(96));
+    }
+
+    // Another subscriber of the publisher shares the mDNS subscriptions, which would be answered
+    // from the publisher's cache if they were restarted.
+    subscriberId = mPublisher.AddSubscriptionCallbacks(nullptr, nullptr);
+    mPublisher.SubscribeService("_test._tcp", "", subscriberId);
+    mPublisher.SubscribeHost("host1", subscriberId);
+
+    mPublisher.mEvents.clear();
+    Age(Seconds(95));
+    HandleMaintenanceTimer();
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+
+    Age(Seconds(1));
+    HandleMaintenanceTimer();
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({
+                                      "unsubscribe host host1",
+                                      "subscribe host host1",
+                                      "unsubscribe service ._test._tcp",
+                                      "subscribe service ._test._tcp",
+                                  }));
+    EXPECT_TRUE(FindSubscription(kServiceName)->mAnswers.begin()->second.mRefreshRequested);
+
+    // A refresh is requested only once, the answer is dropped when it expires.
+    mPublisher.mEvents.clear();
+    HandleMaintenanceTimer();
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+
+    Age(Seconds(24));
+    HandleMaintenanceTimer();
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+    EXPECT_TRUE(FindSubscription(kServiceName)->mAnswers.empty());
+    EXPECT_TRUE(FindSubscription(kHostName)->mAnswers.empty());
+}
+
+TEST_F(DiscoveryProxyTest, RemainingTtlIsRoundedUp)
+{
+    EXPECT_EQ(GetRemainingTtl(Milliseconds(-1)), 0u);
+    EXPECT_EQ(GetRemainingTtl(Clock::duration::zero()), 0u);
+    EXPECT_EQ(GetRemainingTtl(Milliseconds(1)), 1u);
+    EXPECT_EQ(GetRemainingTtl(Milliseconds(999)), 1u);
+    EXPECT_EQ(GetRemainingTtl(Seconds(1)), 1u);
+    EXPECT_EQ(GetRemainingTtl(Milliseconds(1500)), 2u);
+}
+
+TEST_F(DiscoveryProxyTest, ResetReleasesQueriesAndKeepsCache)
+{
+    Enable();
+    Subscribe(kServiceName);
+    Subscribe(kServiceName);
+    mPublisher.Resolve("_test._tcp", MakeInstanceInfo());
+
+    // This is what the reset handler does, which can't be triggered without an OpenThread instance.
+    mPublisher.mEvents.clear();
+    ReleaseSubscriptionReferences();
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+    EXPECT_EQ(FindSubscription(kServiceName)->mRefCount, 0u);
+    EXPECT_EQ(FindSubscription(kServiceName)->mAnswers.size(), 1u);
+
+    // The queries sent again after the reset are answered from the cache.
+    Subscribe(kServiceName);
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+    EXPECT_EQ(FindSubscription(kServiceName)->mRefCount, 1u);
+    EXPECT_EQ(GetPendingCacheAnswerCount(), 1u);
+}
+
+TEST_F(DiscoveryProxyTest, StopClearsSubscriptions)
+{
+    Enable();
+    Subscribe(kServiceName);
+    Subscribe(kHostName);
+    Unsubscribe(kHostName);
+    mPublisher.Resolve("_test._tcp", MakeInstanceInfo());
+    Subscribe(kServiceName);
+
+    // This is what `Stop()` does besides clearing the DNS-SD server callbacks.
+    mPublisher.mEvents.clear();
+    ClearSubscriptions();
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({
+                                      "unsubscribe host host1",
+                                      "unsubscribe service ._test._tcp",
+                                  }));
+    EXPECT_EQ(GetSubscriptionCount(), 0u);
+    EXPECT_EQ(GetPendingCacheAnswerCount(), 0u);
+    EXPECT_FALSE(IsMaintenanceScheduled());
+    ProcessMainloop();
+}
+
+TEST_F(DiscoveryProxyTest, MdnsReadyResubscribesAndDropsCache)
+{
+    // Nothing is done while the Discovery Proxy is disabled.
+    mProxy.HandleMdnsState(Mdns::Publisher::State::kReady);
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+
+    Enable();
+    Subscribe(kServiceName);
+    Subscribe(kHostName);
+    Unsubscribe(kHostName);
+    mPublisher.Resolve("_test._tcp", MakeInstanceInfo());
+    Subscribe(kServiceName);
+    EXPECT_EQ(GetPendingCacheAnswerCount(), 1u);
+
+    // The publisher drops its subscriptions when it's restarted.
+    mPublisher.Stop();
+    EXPECT_EQ(mPublisher.Start(), OTBR_ERROR_NONE);
+
+    mPublisher.mEvents.clear();
+    mProxy.HandleMdnsState(Mdns::Publisher::State::kIdle);
+    EXPECT_TRUE(mPublisher.mEvents.empty());
+
+    mProxy.HandleMdnsState(Mdns::Publisher::State::kReady);
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({
+                                      "subscribe host host1",
+                                      "subscribe service ._test._tcp",
+                                  }));
+    EXPECT_TRUE(FindSubscription(kServiceName)->mAnswers.empty());
+    EXPECT_EQ(FindSubscription(kServiceName)->mRefCount, 2u);
+    EXPECT_EQ(FindSubscription(kHostName)->mRefCount, 0u);
+    EXPECT_EQ(GetPendingCacheAnswerCount(), 0u);
+
+    // Each entry, including the lingering one, holds a single reference of the publisher.
+    EXPECT_EQ(mPublisher.GetServiceSubscriptionCount("_test._tcp", ""), 1u);
+    EXPECT_EQ(mPublisher.GetHostSubscriptionCount("host1"), 1u);
+
+    // The publisher's subscriptions are balanced with the lingering ones.
+    mPublisher.mEvents.clear();
+    AgePastLingerTime();
+    HandleMaintenanceTimer();
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({"unsubscribe host host1"}));
+    EXPECT_EQ(mPublisher.GetHostSubscriptionCount("host1"), 0u);
+}
+
+TEST_F(DiscoveryProxyTest, MdnsReadyAgainRequeriesWithoutNewReferences)
+{
+    Enable();
+
+    // The host is subscribed while the publisher is not ready, so the publisher hasn't started it.
+    mPublisher.mSubscribeError = OTBR_ERROR_INVALID_STATE;
+    Subscribe(kHostName);
+    mPublisher.mSubscribeError = OTBR_ERROR_NONE;
+    Subscribe(kServiceName);
+    EXPECT_EQ(mPublisher.GetHostSubscriptionCount("host1"), 1u);
+
+    // The publisher becomes ready again without being stopped, e.g. after a name conflict, and
+    // keeps its subscriptions.
+    mPublisher.mEvents.clear();
+    mProxy.HandleMdnsState(Mdns::Publisher::State::kReady);
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({
+                                      "subscribe host host1",
+                                      "unsubscribe service ._test._tcp",
+                                      "subscribe service ._test._tcp",
+                                  }));
+    EXPECT_EQ(mPublisher.GetHostSubscriptionCount("host1"), 1u);
+    EXPECT_EQ(mPublisher.GetServiceSubscriptionCount("_test._tcp", ""), 1u);
+
+    // A single unsubscription stops the browsing.
+    mPublisher.mEvents.clear();
+    Unsubscribe(kHostName);
+    AgePastLingerTime();
+    HandleMaintenanceTimer();
+    EXPECT_EQ(mPublisher.mEvents, std::vector<std::string>({"unsubscribe host host1"}));
+    EXPECT_EQ(mPublisher.GetHostSubscriptionCount("host1"), 0u);
+}
+
+} // namespace Dnssd
+} // namespace otbr
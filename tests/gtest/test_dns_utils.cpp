@@ -31,6 +31,26 @@
 #include <assert.h>
 #include <gtest/gtest.h>
 
+static void CheckParseFullDnsName(const std::string &aFullName,
+                                  bool               aIsServiceInstance,
+                                  bool               aIsService,
+                                  bool               aIsHost,
+                                  const std::string &aInstanceName,
+                                  const std::string &aServiceName,
+                                  const std::string &aHostName,
+                                  const std::string &aDomain)
+{
+    DnsNameView view = ParseFullDnsName(DnsNameSpan(aFullName));
+
+    EXPECT_EQ(aIsServiceInstance, view.IsServiceInstance());
+    EXPECT_EQ(aIsService, view.IsService());
+    EXPECT_EQ(aIsHost, view.IsHost());
+    EXPECT_EQ(aInstanceName, view.mInstanceName.ToString());
+    EXPECT_EQ(aServiceName, view.mServiceName.ToString());
+    EXPECT_EQ(aHostName, view.mHostName.ToString());
+    EXPECT_EQ(aDomain, view.mDomain.ToString());
+}
+
 static void CheckSplitFullDnsName(const std::string &aFullName,
                                   bool               aIsServiceInstance,
                                   bool               aIsService,
@@ -63,6 +83,12 @@ static void CheckSplitFullDnsName(const std::string &aFullName,
     EXPECT_EQ(aServiceName, info.mServiceName);
     EXPECT_EQ(aHostName, info.mHostName);
     EXPECT_EQ(aDomain, info.mDomain);
+
+    // The parsed domain keeps the trailing dot only if the full name has it, and the empty domain has no dot.
+    CheckParseFullDnsName(aFullName, aIsServiceInstance, aIsService, aIsHost, aInstanceName, aServiceName, aHostName,
+                          aDomain.substr(0, aDomain.size() - 1));
+    CheckParseFullDnsName(aFullName + ".", aIsServiceInstance, aIsService, aIsHost, aInstanceName, aServiceName,
+                          aHostName, aDomain == "." ? "" : aDomain);
 }
 
 TEST(DnsUtils, TestSplitFullDnsName)
@@ -92,3 +118,34 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestCompareDnsNames)
+{
+    EXPECT_TRUE(DnsNameSpan("_IPPS._tcp").EqualsCaseInsensitive(std::string("_ipps._TCP")));
+    EXPECT_FALSE(DnsNameSpan("_ipps._tcp").EqualsCaseInsensitive(std::string("_ipps._tcp.")));
+    EXPECT_EQ(0, CompareDnsNames(DnsNameSpan("Host1"), DnsNameSpan("hOST1")));
+    EXPECT_LT(CompareDnsNames(DnsNameSpan("host"), DnsNameSpan("HOST1")), 0);
+    EXPECT_GT(CompareDnsNames(DnsNameSpan("host2"), DnsNameSpan("HOST1")), 0);
+    EXPECT_FALSE(DnsNameLess()("Host1", "host1"));
+    EXPECT_FALSE(DnsNameLess()("host1", "Host1"));
+}
+
+TEST(DnsUtils, TestRewriteDnsDomain)
+{
+    char buffer[32];
+
+    EXPECT_EQ(OTBR_ERROR_NONE, RewriteDnsDomain(DnsNameSpan("host.LOCAL."), DnsNameSpan("local."),
+                                                DnsNameSpan("default.service.arpa."), buffer, sizeof(buffer)));
+    EXPECT_STREQ("host.default.service.arpa.", buffer);
+
+    EXPECT_EQ(OTBR_ERROR_NONE, RewriteDnsDomain(DnsNameSpan("host.local"), DnsNameSpan("local."),
+                                                DnsNameSpan("default.service.arpa"), buffer, sizeof(buffer)));
+    EXPECT_STREQ("host.default.service.arpa.", buffer);
+
+    EXPECT_EQ(OTBR_ERROR_NOT_FOUND, RewriteDnsDomain(DnsNameSpan("host.example.com."), DnsNameSpan("local."),
+                                                     DnsNameSpan("default.service.arpa."), buffer, sizeof(buffer)));
+    EXPECT_EQ(OTBR_ERROR_NOT_FOUND, RewriteDnsDomain(DnsNameSpan("ins1._ipps._tcp.local."), DnsNameSpan("local."),
+                                                     DnsNameSpan("default.service.arpa."), buffer, sizeof(buffer)));
+    EXPECT_EQ(OTBR_ERROR_INVALID_ARGS, RewriteDnsDomain(DnsNameSpan("host.local."), DnsNameSpan("local."),
+                                                        DnsNameSpan("default.service.arpa."), buffer, 16));
+}
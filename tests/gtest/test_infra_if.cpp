@@ -29,6 +29,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "common/mainloop_manager.hpp"
 #include "host/posix/infra_if.hpp"
 #include "host/posix/netif.hpp"
 
@@ -152,6 +153,8 @@ TEST(InfraIf, DepsUpdateInfraIfStateInvokedCorrectly_AfterInfraIfStateChange)
         FD_ZERO(&context.mWriteFdSet);
         FD_ZERO(&context.mErrorFdSet);
 
+        // The addresses are queried on the worker pool and delivered through the mainloop manager.
+        otbr::MainloopManager::GetInstance().Update(context);
         infraIf.UpdateFdSet(context);
         int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
                           &context.mTimeout);
@@ -161,6 +164,7 @@ TEST(InfraIf, DepsUpdateInfraIfStateInvokedCorrectly_AfterInfraIfStateChange)
             exit(EXIT_FAILURE);
         }
         infraIf.Process(context);
+        otbr::MainloopManager::GetInstance().Process(context);
     }
     EXPECT_EQ(testInfraIfDep.mIsRunning, true);
 
@@ -175,6 +179,7 @@ TEST(InfraIf, DepsUpdateInfraIfStateInvokedCorrectly_AfterInfraIfStateChange)
         FD_ZERO(&context.mWriteFdSet);
         FD_ZERO(&context.mErrorFdSet);
 
+        otbr::MainloopManager::GetInstance().Update(context);
         infraIf.UpdateFdSet(context);
         int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
                           &context.mTimeout);
@@ -184,6 +189,7 @@ TEST(InfraIf, DepsUpdateInfraIfStateInvokedCorrectly_AfterInfraIfStateChange)
             exit(EXIT_FAILURE);
         }
         infraIf.Process(context);
+        otbr::MainloopManager::GetInstance().Process(context);
     }
     EXPECT_EQ(testInfraIfDep.mIp6Addresses.size(), 0);
     EXPECT_EQ(testInfraIfDep.mIsRunning, false);
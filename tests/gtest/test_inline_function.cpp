@@ -0,0 +1,144 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "common/inline_function.hpp"
+
+using otbr::InlineFunction;
+using otbr::InlineFunctionBase;
+
+TEST(InlineFunction, NullptrIsEmpty)
+{
+    InlineFunction<void(void)> func = nullptr;
+
+    EXPECT_FALSE(func);
+}
+
+TEST(InlineFunction, NullCallableIsEmpty)
+{
+    int (*nullFunc)(int) = nullptr;
+
+    std::function<int(int)> emptyFunc;
+    std::function<int(int)> negate = [](int aValue) { return -aValue; };
+
+    InlineFunction<int(int)> fromPointer  = nullFunc;
+    InlineFunction<int(int)> fromFunction = emptyFunc;
+    InlineFunction<int(int)> fromNonEmpty = negate;
+    InlineFunction<int(int)> fromInline   = InlineFunction<int(int), 16>();
+
+    EXPECT_FALSE(fromPointer);
+    EXPECT_FALSE(fromFunction);
+    EXPECT_FALSE(fromInline);
+    ASSERT_TRUE(fromNonEmpty);
+    EXPECT_EQ(fromNonEmpty(1), -1);
+}
+
+TEST(InlineFunction, SmallCallableIsStoredInline)
+{
+    uint64_t    fallbacks = InlineFunctionBase::GetHeapFallbackCount();
+    std::string prefix    = "hello, ";
+    std::string suffix    = "!";
+
+    InlineFunction<std::string(const std::string &)> greet = [prefix, suffix](const std::string &aName) {
+        return prefix + aName + suffix;
+    };
+
+    EXPECT_TRUE(greet);
+    EXPECT_EQ(greet("thread"), "hello, thread!");
+    EXPECT_EQ(InlineFunctionBase::GetHeapFallbackCount(), fallbacks);
+}
+
+TEST(InlineFunction, LargeCallableFallsBackToHeap)
+{
+    uint64_t                 fallbacks = InlineFunctionBase::GetHeapFallbackCount();
+    std::array<uint8_t, 256> data{};
+    InlineFunction<int(int)> func = [data](int aIndex) { return data[aIndex] + aIndex; };
+
+    EXPECT_EQ(InlineFunctionBase::GetHeapFallbackCount(), fallbacks + 1);
+    EXPECT_EQ(func(10), 10);
+
+    // Moving a heap-stored callable doesn't allocate again.
+    InlineFunction<int(int)> moved = std::move(func);
+
+    EXPECT_FALSE(func);
+    EXPECT_EQ(moved(20), 20);
+    EXPECT_EQ(InlineFunctionBase::GetHeapFallbackCount(), fallbacks + 1);
+}
+
+namespace {
+
+class MoveOnlyCallable
+{
+public:
+    explicit MoveOnlyCallable(int aValue)
+        : mValue(new int(aValue))
+    {
+    }
+
+    MoveOnlyCallable(MoveOnlyCallable &&aOther) noexcept = default;
+
+    int operator()(void) { return *mValue; }
+
+private:
+    std::unique_ptr<int> mValue;
+};
+
+} // namespace
+
+TEST(InlineFunction, MoveOnlyCallableIsSupported)
+{
+    InlineFunction<int(void)> func;
+
+    func = InlineFunction<int(void)>(MoveOnlyCallable(5));
+
+    EXPECT_EQ(func(), 5);
+}
+
+TEST(InlineFunction, CallableIsDestroyedOnReset)
+{
+    auto captured = std::make_shared<int>(0);
+
+    {
+        InlineFunction<void(void)> func = [captured]() { ++*captured; };
+        InlineFunction<void(void)> moved;
+
+        EXPECT_EQ(captured.use_count(), 2);
+        moved = std::move(func);
+        EXPECT_EQ(captured.use_count(), 2);
+        moved = nullptr;
+        EXPECT_EQ(captured.use_count(), 1);
+    }
+
+    EXPECT_EQ(captured.use_count(), 1);
+}
@@ -0,0 +1,289 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "common/mainloop_manager.hpp"
+#include "common/mainloop_poller.hpp"
+#include "common/task_runner.hpp"
+
+using otbr::MainloopContext;
+using otbr::MainloopManager;
+using otbr::MainloopPoller;
+
+static void ResetMainloop(MainloopContext &aMainloop)
+{
+    aMainloop.mMaxFd   = -1;
+    aMainloop.mTimeout = {0, 100000};
+    aMainloop.mFdEvents.clear();
+
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+}
+
+static void TestRegisteredFd(MainloopPoller::Type aType)
+{
+    int                             fds[2];
+    const uint8_t                   kOne = 1;
+    MainloopContext                 mainloop;
+    std::unique_ptr<MainloopPoller> poller = MainloopPoller::Create(aType);
+
+    ASSERT_EQ(pipe(fds), 0);
+    EXPECT_EQ(poller->AddFd(fds[0], MainloopContext::kReadFdSet), OTBR_ERROR_NONE);
+
+    // Nothing to read yet.
+    ResetMainloop(mainloop);
+    EXPECT_EQ(poller->Poll(mainloop), 0);
+    EXPECT_FALSE(mainloop.HasFdEvent(fds[0], MainloopContext::kReadFdSet));
+
+    // The fd stays registered across iterations.
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+    ResetMainloop(mainloop);
+    EXPECT_EQ(poller->Poll(mainloop), 1);
+    EXPECT_TRUE(mainloop.HasFdEvent(fds[0], MainloopContext::kReadFdSet));
+    EXPECT_FALSE(mainloop.HasFdEvent(fds[0], MainloopContext::kWriteFdSet));
+
+    // Fds added to the fd sets are polled together with the registered fds.
+    ResetMainloop(mainloop);
+    mainloop.AddFdToSet(fds[1], MainloopContext::kWriteFdSet);
+    EXPECT_EQ(poller->Poll(mainloop), 2);
+    EXPECT_TRUE(mainloop.HasFdEvent(fds[0], MainloopContext::kReadFdSet));
+    EXPECT_TRUE(mainloop.HasFdEvent(fds[1], MainloopContext::kWriteFdSet));
+    EXPECT_TRUE(FD_ISSET(fds[1], &mainloop.mWriteFdSet));
+
+    // A removed fd is no longer polled.
+    poller->RemoveFd(fds[0]);
+    ResetMainloop(mainloop);
+    EXPECT_EQ(poller->Poll(mainloop), 0);
+    EXPECT_FALSE(mainloop.HasFdEvent(fds[0], MainloopContext::kReadFdSet));
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopPoller, SelectPollerReportsRegisteredFds)
+{
+    TestRegisteredFd(MainloopPoller::Type::kSelect);
+}
+
+#if OTBR_ENABLE_EPOLL
+TEST(MainloopPoller, EpollPollerReportsRegisteredFds)
+{
+    ASSERT_EQ(MainloopPoller::Create(MainloopPoller::Type::kEpoll)->GetType(), MainloopPoller::Type::kEpoll);
+
+    TestRegisteredFd(MainloopPoller::Type::kEpoll);
+}
+
+TEST(MainloopPoller, EpollPollerSupportsFdsBeyondFdSetSize)
+{
+    int                             fds[2];
+    int                             largeFd = FD_SETSIZE + 10;
+    const uint8_t                   kOne    = 1;
+    struct rlimit                   limit;
+    MainloopContext                 mainloop;
+    std::unique_ptr<MainloopPoller> selectPoller = MainloopPoller::Create(MainloopPoller::Type::kSelect);
+    std::unique_ptr<MainloopPoller> epollPoller  = MainloopPoller::Create(MainloopPoller::Type::kEpoll);
+
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &limit), 0);
+    if (limit.rlim_cur <= static_cast<rlim_t>(largeFd))
+    {
+        GTEST_SKIP() << "RLIMIT_NOFILE is too small";
+    }
+
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(dup2(fds[0], largeFd), largeFd);
+
+    EXPECT_EQ(selectPoller->AddFd(largeFd, MainloopContext::kReadFdSet), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(epollPoller->AddFd(largeFd, MainloopContext::kReadFdSet), OTBR_ERROR_NONE);
+
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+    ResetMainloop(mainloop);
+    EXPECT_EQ(epollPoller->Poll(mainloop), 1);
+    EXPECT_TRUE(mainloop.HasFdEvent(largeFd, MainloopContext::kReadFdSet));
+
+    epollPoller->RemoveFd(largeFd);
+    close(largeFd);
+    close(fds[0]);
+    close(fds[1]);
+}
+#endif // OTBR_ENABLE_EPOLL
+
+static void RunMainloopOnce(MainloopContext &aMainloop)
+{
+    ResetMainloop(aMainloop);
+    MainloopManager::GetInstance().Update(aMainloop);
+    ASSERT_GE(MainloopManager::GetInstance().Poll(aMainloop), 0);
+    MainloopManager::GetInstance().Process(aMainloop);
+}
+
+TEST(MainloopManager, DispatchesReadyFdToItsCallback)
+{
+    int             fds[2];
+    uint8_t         buf;
+    int             readyCount = 0;
+    MainloopContext mainloop;
+
+    ASSERT_EQ(pipe(fds), 0);
+    EXPECT_EQ(MainloopManager::GetInstance().AddFd(fds[0], MainloopContext::kReadFdSet,
+                                                   [&](uint8_t aFdSetsMask) {
+                                                       EXPECT_EQ(aFdSetsMask, +MainloopContext::kReadFdSet);
+                                                       EXPECT_EQ(read(fds[0], &buf, sizeof(buf)), 1);
+                                                       ++readyCount;
+                                                   }),
+              OTBR_ERROR_NONE);
+
+    RunMainloopOnce(mainloop);
+    EXPECT_EQ(readyCount, 0);
+
+    buf = 1;
+    ASSERT_EQ(write(fds[1], &buf, sizeof(buf)), 1);
+    RunMainloopOnce(mainloop);
+    EXPECT_EQ(readyCount, 1);
+
+    MainloopManager::GetInstance().RemoveFd(fds[0]);
+    ASSERT_EQ(write(fds[1], &buf, sizeof(buf)), 1);
+    RunMainloopOnce(mainloop);
+    EXPECT_EQ(readyCount, 1);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, SkipsFdReusedDuringDispatch)
+{
+    int             first[2];
+    int             second[2];
+    int             reused[2];
+    int             staleCount  = 0;
+    int             reusedCount = 0;
+    uint8_t         buf         = 1;
+    MainloopContext mainloop;
+
+    ASSERT_EQ(pipe(first), 0);
+    ASSERT_EQ(pipe(second), 0);
+    ASSERT_EQ(pipe(reused), 0);
+    ASSERT_EQ(write(first[1], &buf, sizeof(buf)), 1);
+    ASSERT_EQ(write(second[1], &buf, sizeof(buf)), 1);
+    ASSERT_EQ(write(reused[1], &buf, sizeof(buf)), 1);
+
+    // Whichever callback runs first closes the other fd and registers a new fd with the same number.
+    auto replaceOther = [&](int aSelf, int aOther) {
+        EXPECT_EQ(read(aSelf, &buf, sizeof(buf)), 1);
+        MainloopManager::GetInstance().RemoveFd(aSelf);
+
+        if (staleCount++ == 0)
+        {
+            MainloopManager::GetInstance().RemoveFd(aOther);
+            ASSERT_EQ(dup2(reused[0], aOther), aOther);
+            EXPECT_EQ(MainloopManager::GetInstance().AddFd(aOther, MainloopContext::kReadFdSet,
+                                                           [&, aOther](uint8_t) {
+                                                               EXPECT_EQ(read(aOther, &buf, sizeof(buf)), 1);
+                                                               ++reusedCount;
+                                                           }),
+                      OTBR_ERROR_NONE);
+        }
+    };
+
+    EXPECT_EQ(MainloopManager::GetInstance().AddFd(first[0], MainloopContext::kReadFdSet,
+                                                   [&](uint8_t) { replaceOther(first[0], second[0]); }),
+              OTBR_ERROR_NONE);
+    EXPECT_EQ(MainloopManager::GetInstance().AddFd(second[0], MainloopContext::kReadFdSet,
+                                                   [&](uint8_t) { replaceOther(second[0], first[0]); }),
+              OTBR_ERROR_NONE);
+
+    // The event polled for the closed fd must not be dispatched to the new registration.
+    RunMainloopOnce(mainloop);
+    EXPECT_EQ(staleCount, 1);
+    EXPECT_EQ(reusedCount, 0);
+
+    RunMainloopOnce(mainloop);
+    EXPECT_EQ(staleCount, 1);
+    EXPECT_EQ(reusedCount, 1);
+
+    MainloopManager::GetInstance().RemoveFd(first[0]);
+    MainloopManager::GetInstance().RemoveFd(second[0]);
+    close(first[0]);
+    close(first[1]);
+    close(second[0]);
+    close(second[1]);
+    close(reused[0]);
+    close(reused[1]);
+}
+
+TEST(MainloopManager, FiresTimersInDeadlineOrder)
+{
+    std::vector<int>         fired;
+    MainloopContext          mainloop;
+    MainloopManager::TimerId removed;
+
+    MainloopManager::GetInstance().AddTimer(otbr::Microseconds(20000), [&]() { fired.push_back(2); });
+    MainloopManager::GetInstance().AddTimer(otbr::Microseconds(10000), [&]() { fired.push_back(1); });
+    removed = MainloopManager::GetInstance().AddTimer(otbr::Microseconds(0), [&]() { fired.push_back(0); });
+    EXPECT_NE(removed, 0U);
+    MainloopManager::GetInstance().RemoveTimer(removed);
+
+    while (fired.size() < 2)
+    {
+        RunMainloopOnce(mainloop);
+
+        // The mainloop must not sleep beyond the earliest timer.
+        EXPECT_LE(mainloop.mTimeout.tv_sec, 0);
+        EXPECT_LE(mainloop.mTimeout.tv_usec, 20000);
+    }
+
+    EXPECT_EQ(fired, std::vector<int>({1, 2}));
+}
+
+TEST(MainloopManager, RecordsProcessorLatencies)
+{
+    otbr::TaskRunner taskRunner;
+    MainloopContext  mainloop;
+    bool             found = false;
+
+    taskRunner.Post([]() { usleep(1000); });
+    RunMainloopOnce(mainloop);
+
+    for (const otbr::MainloopProcessorStats &stats : MainloopManager::GetInstance().GetProcessorStats())
+    {
+        if (stats.mName == "TaskRunner")
+        {
+            found = true;
+            EXPECT_GE(stats.mUpdateLatency.mCount, 1U);
+            EXPECT_GE(stats.mProcessLatency.mCount, 1U);
+            EXPECT_GE(stats.mProcessLatency.mMaxUs, 1000U);
+            EXPECT_GE(stats.mDispatchLatency.mCount, 1U);
+        }
+    }
+
+    EXPECT_TRUE(found);
+}
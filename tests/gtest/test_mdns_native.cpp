@@ -0,0 +1,382 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <string.h>
+
+#include "mdns/mdns_native.hpp"
+
+namespace {
+
+constexpr uint16_t kTypeA    = 1;
+constexpr uint16_t kTypePtr  = 12;
+constexpr uint16_t kTypeAaaa = 28;
+constexpr uint16_t kTypeSrv  = 33;
+constexpr uint16_t kTypeAny  = 255;
+constexpr uint16_t kClassIn  = 1;
+
+constexpr uint16_t kProbeFlags    = 0x0000;
+constexpr uint16_t kResponseFlags = 0x8400;
+constexpr uint16_t kCacheFlush    = 0x8000;
+
+void AppendUint16(std::vector<uint8_t> &aPacket, uint16_t aValue)
+{
+    aPacket.push_back(static_cast<uint8_t>(aValue >> 8));
+    aPacket.push_back(static_cast<uint8_t>(aValue & 0xff));
+}
+
+void AppendUint32(std::vector<uint8_t> &aPacket, uint32_t aValue)
+{
+    AppendUint16(aPacket, static_cast<uint16_t>(aValue >> 16));
+    AppendUint16(aPacket, static_cast<uint16_t>(aValue & 0xffff));
+}
+
+void AppendName(std::vector<uint8_t> &aPacket, std::initializer_list<const char *> aLabels)
+{
+    for (const char *label : aLabels)
+    {
+        aPacket.push_back(static_cast<uint8_t>(strlen(label)));
+        aPacket.insert(aPacket.end(), label, label + strlen(label));
+    }
+
+    aPacket.push_back(0);
+}
+
+std::vector<uint8_t> MakeHeader(uint16_t aFlags,
+                                uint16_t aQuestionCount,
+                                uint16_t aAnswerCount,
+                                uint16_t aAuthorityCount)
+{
+    std::vector<uint8_t> packet;
+
+    AppendUint16(packet, 0); // ID
+    AppendUint16(packet, aFlags);
+    AppendUint16(packet, aQuestionCount);
+    AppendUint16(packet, aAnswerCount);
+    AppendUint16(packet, aAuthorityCount);
+    AppendUint16(packet, 0); // Additional count
+
+    return packet;
+}
+
+// Appends the fixed part of a resource record which follows its name.
+void AppendRecordHeader(std::vector<uint8_t> &aPacket, uint16_t aType, uint16_t aClass, uint16_t aDataLength)
+{
+    AppendUint16(aPacket, aType);
+    AppendUint16(aPacket, aClass);
+    AppendUint32(aPacket, 120);
+    AppendUint16(aPacket, aDataLength);
+}
+
+void AppendAaaaRecord(std::vector<uint8_t> &aPacket, const char *aHostName, const char *aAddress, uint16_t aClass)
+{
+    otbr::Ip6Address address(aAddress);
+
+    AppendName(aPacket, {aHostName, "local"});
+    AppendRecordHeader(aPacket, kTypeAaaa, aClass, sizeof(address.m8));
+    aPacket.insert(aPacket.end(), address.m8, address.m8 + sizeof(address.m8));
+}
+
+// A probe of @p aHostName which proposes @p aAddress, as sent by another host.
+std::vector<uint8_t> MakeProbe(const char *aHostName, const char *aAddress)
+{
+    std::vector<uint8_t> packet = MakeHeader(kProbeFlags, 1, 0, 1);
+
+    AppendName(packet, {aHostName, "local"});
+    AppendUint16(packet, kTypeAny);
+    AppendUint16(packet, kClassIn);
+    AppendAaaaRecord(packet, aHostName, aAddress, kClassIn);
+
+    return packet;
+}
+
+// A response of another host which claims @p aAddress for @p aHostName.
+std::vector<uint8_t> MakeResponse(const char *aHostName, const char *aAddress)
+{
+    std::vector<uint8_t> packet = MakeHeader(kResponseFlags, 0, 1, 0);
+
+    AppendAaaaRecord(packet, aHostName, aAddress, kClassIn | kCacheFlush);
+
+    return packet;
+}
+
+// A query of @p aQuestionCount questions, each of which is a compression pointer to the name of the previous one.
+std::vector<uint8_t> MakePointerChain(uint16_t aQuestionCount)
+{
+    std::vector<uint8_t> packet   = MakeHeader(kProbeFlags, aQuestionCount, 0, 0);
+    size_t               previous = packet.size();
+
+    AppendName(packet, {"host", "local"});
+    AppendUint16(packet, kTypeA);
+    AppendUint16(packet, kClassIn);
+
+    for (uint16_t i = 1; i < aQuestionCount; i++)
+    {
+        size_t current = packet.size();
+
+        AppendUint16(packet, static_cast<uint16_t>(0xc000 | previous));
+        AppendUint16(packet, kTypeA);
+        AppendUint16(packet, kClassIn);
+        previous = current;
+    }
+
+    return packet;
+}
+
+} // namespace
+
+namespace otbr {
+
+namespace Mdns {
+
+// Hands crafted messages to a `PublisherNative` which is ready but has no sockets, so
+// that the messages it sends are dropped.
+class PublisherNativeTest : public ::testing::Test
+{
+protected:
+    PublisherNativeTest(void)
+        : mPublisher([](Publisher::State aState) { OTBR_UNUSED_VARIABLE(aState); })
+    {
+        mPublisher.mHostName = "otbr";
+        mPublisher.mState    = Publisher::State::kReady;
+    }
+
+    static bool Parse(const std::vector<uint8_t> &aPacket)
+    {
+        PublisherNative::Message message;
+
+        return PublisherNative::ParseMessage(aPacket.data(), aPacket.size(), message);
+    }
+
+    // Returns the RDATA of the first answer of @p aPacket, or an empty vector if it can't be parsed.
+    static std::vector<uint8_t> ParseAnswerData(const std::vector<uint8_t> &aPacket)
+    {
+        PublisherNative::Message message;
+        std::vector<uint8_t>     data;
+
+        if (PublisherNative::ParseMessage(aPacket.data(), aPacket.size(), message) && !message.mAnswers.empty())
+        {
+            data = message.mAnswers.front().mData;
+        }
+
+        return data;
+    }
+
+    void Receive(const std::vector<uint8_t> &aPacket)
+    {
+        PublisherNative::Message       message;
+        PublisherNative::SocketAddress sender;
+
+        memset(&sender, 0, sizeof(sender));
+        sender.mAddress6.sin6_family = AF_INET6;
+        sender.mAddress6.sin6_port   = htons(5353);
+
+        ASSERT_TRUE(PublisherNative::ParseMessage(aPacket.data(), aPacket.size(), message));
+        mPublisher.HandleMessage(message, /* aNetifIndex */ 1, sender);
+    }
+
+    void PublishHost(const std::string &aName, const char *aAddress)
+    {
+        mPublisher.PublishHost(aName, {Ip6Address(aAddress)}, [this](otbrError aError) { mResults.push_back(aError); });
+    }
+
+    size_t GetEntryCount(void) const { return mPublisher.mEntries.size(); }
+
+    bool IsProbing(size_t aIndex) const
+    {
+        return mPublisher.mEntries[aIndex]->mState == PublisherNative::Entry::State::kProbing;
+    }
+
+    // Returns the time until the next probe or announcement of the entry.
+    Milliseconds GetTimeToNextTx(size_t aIndex) const
+    {
+        return std::chrono::duration_cast<Milliseconds>(mPublisher.mEntries[aIndex]->mTxTime - Clock::now());
+    }
+
+    void SetRegistered(size_t aIndex)
+    {
+        mPublisher.mEntries[aIndex]->mState   = PublisherNative::Entry::State::kRegistered;
+        mPublisher.mEntries[aIndex]->mTxCount = 0;
+    }
+
+    // Declared first, since the registrations are aborted when the publisher is destroyed.
+    std::vector<otbrError> mResults;
+    PublisherNative        mPublisher;
+};
+
+TEST_F(PublisherNativeTest, ParseRejectsCompressionLoops)
+{
+    std::vector<uint8_t> selfPointer = MakeHeader(kProbeFlags, 1, 0, 0);
+    std::vector<uint8_t> forwardLoop = MakeHeader(kProbeFlags, 1, 0, 0);
+
+    // The name of the question points to itself.
+    AppendUint16(selfPointer, 0xc00c);
+    AppendUint16(selfPointer, kTypeA);
+    AppendUint16(selfPointer, kClassIn);
+    EXPECT_FALSE(Parse(selfPointer));
+
+    // The name of the question points forwards to a pointer back to it.
+    AppendUint16(forwardLoop, 0xc00e);
+    AppendUint16(forwardLoop, 0xc00c);
+    AppendUint16(forwardLoop, kTypeA);
+    AppendUint16(forwardLoop, kClassIn);
+    EXPECT_FALSE(Parse(forwardLoop));
+}
+
+TEST_F(PublisherNativeTest, ParseLimitsPointerHops)
+{
+    // The last name of a chain of 17 questions follows 16 pointers, which is the limit.
+    EXPECT_TRUE(Parse(MakePointerChain(17)));
+    EXPECT_FALSE(Parse(MakePointerChain(18)));
+}
+
+TEST_F(PublisherNativeTest, ParseRejectsTruncatedMessages)
+{
+    std::vector<uint8_t> packet;
+
+    EXPECT_FALSE(Parse(std::vector<uint8_t>(11, 0)));
+
+    // A question is announced but missing.
+    EXPECT_FALSE(Parse(MakeHeader(kProbeFlags, 1, 0, 0)));
+
+    // A label runs past the end of the message.
+    packet = MakeHeader(kProbeFlags, 1, 0, 0);
+    packet.insert(packet.end(), {5, 'h', 'o'});
+    EXPECT_FALSE(Parse(packet));
+
+    // A compression pointer is cut in half.
+    packet = MakeHeader(kProbeFlags, 1, 0, 0);
+    packet.push_back(0xc0);
+    EXPECT_FALSE(Parse(packet));
+
+    // The type and class of a question are cut.
+    packet = MakeHeader(kProbeFlags, 1, 0, 0);
+    AppendName(packet, {"host", "local"});
+    AppendUint16(packet, kTypeA);
+    EXPECT_FALSE(Parse(packet));
+
+    // The RDATA of a record runs past the end of the message.
+    packet = MakeHeader(kResponseFlags, 0, 1, 0);
+    AppendName(packet, {"host", "local"});
+    AppendRecordHeader(packet, kTypeAaaa, kClassIn, 16);
+    packet.insert(packet.end(), 4, 0);
+    EXPECT_FALSE(Parse(packet));
+
+    // The RDATA of an SRV record ends before the target name.
+    packet = MakeHeader(kResponseFlags, 0, 1, 0);
+    AppendName(packet, {"ins", "_srv", "_udp", "local"});
+    AppendRecordHeader(packet, kTypeSrv, kClassIn, 6);
+    packet.insert(packet.end(), 6, 0);
+    EXPECT_FALSE(Parse(packet));
+
+    // The name in the RDATA of a PTR record runs past the RDATA, though not past the message.
+    packet = MakeHeader(kResponseFlags, 0, 1, 0);
+    AppendName(packet, {"_srv", "_udp", "local"});
+    AppendRecordHeader(packet, kTypePtr, kClassIn, 3);
+    AppendName(packet, {"ins", "_srv", "_udp", "local"});
+    EXPECT_FALSE(Parse(packet));
+}
+
+TEST_F(PublisherNativeTest, ParseDecompressesRecordData)
+{
+    std::vector<uint8_t> packet = MakeHeader(kResponseFlags, 0, 1, 0);
+    std::vector<uint8_t> expected;
+
+    AppendName(packet, {"_srv", "_udp", "local"});
+    AppendRecordHeader(packet, kTypePtr, kClassIn, 6);
+    packet.insert(packet.end(), {3, 'i', 'n', 's'});
+    AppendUint16(packet, 0xc00c);
+
+    AppendName(expected, {"ins", "_srv", "_udp", "local"});
+    EXPECT_EQ(ParseAnswerData(packet), expected);
+}
+
+TEST_F(PublisherNativeTest, SimultaneousProbeIsDeferredWhenLost)
+{
+    PublishHost("host1", "fd00::5");
+    ASSERT_EQ(GetEntryCount(), 1u);
+    ASSERT_TRUE(IsProbing(0));
+
+    // The proposed records are earlier than ours, so this host wins and goes on probing.
+    Receive(MakeProbe("host1", "fd00::1"));
+    EXPECT_TRUE(IsProbing(0));
+    EXPECT_LE(GetTimeToNextTx(0), Milliseconds(250));
+
+    // Identical records don't break the tie either.
+    Receive(MakeProbe("host1", "fd00::5"));
+    EXPECT_LE(GetTimeToNextTx(0), Milliseconds(250));
+
+    // The proposed records are later than ours, so this host probes again one second later.
+    Receive(MakeProbe("host1", "fd00::9"));
+    EXPECT_TRUE(IsProbing(0));
+    EXPECT_GT(GetTimeToNextTx(0), Milliseconds(500));
+    EXPECT_TRUE(mResults.empty());
+}
+
+TEST_F(PublisherNativeTest, ConflictWhileProbingFailsRegistration)
+{
+    PublishHost("host1", "fd00::5");
+    Receive(MakeResponse("host1", "fd00::9"));
+
+    // The registration fails so that the caller can pick another name.
+    ASSERT_EQ(mResults.size(), 1u);
+    EXPECT_EQ(mResults[0], OTBR_ERROR_DUPLICATED);
+    EXPECT_EQ(GetEntryCount(), 0u);
+
+    PublishHost("host1-2", "fd00::5");
+    Receive(MakeResponse("host1", "fd00::9"));
+    ASSERT_EQ(GetEntryCount(), 1u);
+    EXPECT_TRUE(IsProbing(0));
+    EXPECT_EQ(mResults.size(), 1u);
+}
+
+TEST_F(PublisherNativeTest, ConflictAfterRegistrationProbesAgain)
+{
+    PublishHost("host1", "fd00::5");
+    SetRegistered(0);
+
+    // Our own records which are echoed back are not a conflict.
+    Receive(MakeResponse("host1", "fd00::5"));
+    EXPECT_FALSE(IsProbing(0));
+
+    Receive(MakeResponse("host1", "fd00::9"));
+    ASSERT_EQ(GetEntryCount(), 1u);
+    EXPECT_TRUE(IsProbing(0));
+    EXPECT_TRUE(mResults.empty());
+}
+
+} // namespace Mdns
+
+} // namespace otbr
@@ -0,0 +1,353 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "mdns/mdns.hpp"
+
+#include "fake_mdns_publisher.hpp"
+
+using namespace otbr;
+using namespace otbr::Mdns;
+
+namespace {
+
+// Runs one mainloop iteration without waiting, which fires the due timers.
+void ProcessMainloop(void)
+{
+    MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    MainloopManager::GetInstance().Update(mainloop);
+    MainloopManager::GetInstance().Poll(mainloop);
+    MainloopManager::GetInstance().Process(mainloop);
+}
+
+Publisher::DiscoveredInstanceInfo MakeInstanceInfo(const std::string &aName)
+{
+    Publisher::DiscoveredInstanceInfo instanceInfo;
+
+    instanceInfo.mNetifIndex = 1;
+    instanceInfo.mName       = aName;
+    instanceInfo.mHostName   = "host1.local.";
+    instanceInfo.mPort       = 1234;
+    instanceInfo.mTtl        = 120;
+
+    return instanceInfo;
+}
+
+Publisher::DiscoveredHostInfo MakeHostInfo(void)
+{
+    Publisher::DiscoveredHostInfo hostInfo;
+    Ip6Address                    address;
+
+    SuccessOrDie(Ip6Address::FromString("2002::1", address), "");
+    hostInfo.mHostName   = "host1.local.";
+    hostInfo.mAddresses  = {address};
+    hostInfo.mNetifIndex = 1;
+    hostInfo.mTtl        = 120;
+
+    return hostInfo;
+}
+
+} // namespace
+
+TEST(MdnsPublisher, PublishBatchGroupsRecordsOfName)
+{
+    FakePublisher          publisher;
+    Publisher::Batch       batch;
+    int                    callbackCount = 0;
+    std::vector<otbrError> lastErrors;
+
+    batch.PublishHost("host1", {});
+    batch.PublishService("host1", "service1", "_test._tcp", {}, 1234, {});
+    batch.UnpublishService("service2", "_test._tcp");
+    batch.PublishKey("service1", {1, 2, 3});
+    batch.PublishService("host2", "service3", "_test._tcp", {}, 1234, {});
+    batch.PublishKey("other", {1});
+
+    publisher.PublishBatch(std::move(batch), [&](otbrError aError, const std::vector<otbrError> &aErrors) {
+        OTBR_UNUSED_VARIABLE(aError);
+        callbackCount++;
+        lastErrors = aErrors;
+    });
+
+    EXPECT_EQ(publisher.mEvents, std::vector<std::string>({
+                                     "begin",
+                                     "host host1 (grouped)",
+                                     "end",
+                                     "begin",
+                                     "service service1._test._tcp (grouped)",
+                                     "unpublish service service2._test._tcp",
+                                     "key service1 (grouped)",
+                                     "end",
+                                     "begin",
+                                     "service service3._test._tcp (grouped)",
+                                     "end",
+                                     "key other",
+                                 }));
+
+    ASSERT_EQ(publisher.mPendingCallbacks.size(), 5u);
+    publisher.CompleteNext();
+    publisher.CompleteNext(OTBR_ERROR_MDNS);
+    publisher.CompleteNext();
+    publisher.CompleteNext();
+    EXPECT_EQ(callbackCount, 0);
+    publisher.CompleteNext();
+    EXPECT_EQ(callbackCount, 1);
+    EXPECT_EQ(lastErrors, std::vector<otbrError>({OTBR_ERROR_NONE, OTBR_ERROR_MDNS, OTBR_ERROR_NONE, OTBR_ERROR_NONE,
+                                                  OTBR_ERROR_NONE, OTBR_ERROR_NONE}));
+}
+
+TEST(MdnsPublisher, UpdatingServiceDoesNotRegroupHost)
+{
+    FakePublisher    publisher;
+    Publisher::Batch batch;
+    Publisher::Batch update;
+
+    batch.PublishHost("host1", {});
+    batch.PublishKey("host1", {1});
+    batch.PublishService("host1", "service1", "_test._tcp", {}, 1234, {});
+    batch.PublishService("host1", "service2", "_test._tcp", {}, 1234, {});
+    publisher.PublishBatch(std::move(batch), [](otbrError, const std::vector<otbrError> &) {});
+
+    // The host and its key are registered together, apart from each service.
+    EXPECT_EQ(publisher.mEvents, std::vector<std::string>({
+                                     "begin",
+                                     "host host1 (grouped)",
+                                     "key host1 (grouped)",
+                                     "end",
+                                     "begin",
+                                     "service service1._test._tcp (grouped)",
+                                     "end",
+                                     "begin",
+                                     "service service2._test._tcp (grouped)",
+                                     "end",
+                                 }));
+
+    // So updating one service replaces only the group of that service.
+    publisher.mEvents.clear();
+    update.PublishService("host1", "service1", "_test._tcp", {}, 4321, {});
+    publisher.PublishBatch(std::move(update), [](otbrError, const std::vector<otbrError> &) {});
+    EXPECT_EQ(publisher.mEvents, std::vector<std::string>({
+                                     "begin",
+                                     "service service1._test._tcp (grouped)",
+                                     "end",
+                                 }));
+
+    while (!publisher.mPendingCallbacks.empty())
+    {
+        publisher.CompleteNext();
+    }
+}
+
+TEST(MdnsPublisher, PublishOutsideBatchIsNotGrouped)
+{
+    FakePublisher publisher;
+
+    publisher.PublishHost("host1", {}, [](otbrError aError) { OTBR_UNUSED_VARIABLE(aError); });
+    EXPECT_EQ(publisher.mEvents, std::vector<std::string>({"host host1"}));
+}
+
+TEST(MdnsPublisher, SubscribeRetriesFailedSubscription)
+{
+    FakePublisher publisher;
+
+    publisher.mSubscribeError = OTBR_ERROR_INVALID_STATE;
+    publisher.SubscribeService("_test._tcp", "service1");
+    publisher.SubscribeHost("host1");
+
+    // The subscriptions were not started, so they are tried again for the next subscribers.
+    publisher.mSubscribeError = OTBR_ERROR_NONE;
+    publisher.SubscribeService("_test._tcp", "service1");
+    publisher.SubscribeHost("host1");
+
+    publisher.UnsubscribeService("_test._tcp", "service1");
+    publisher.UnsubscribeHost("host1");
+    publisher.UnsubscribeService("_test._tcp", "service1");
+    publisher.UnsubscribeHost("host1");
+
+    EXPECT_EQ(publisher.mEvents, std::vector<std::string>({
+                                     "subscribe service service1._test._tcp",
+                                     "subscribe host host1",
+                                     "subscribe service service1._test._tcp",
+                                     "subscribe host host1",
+                                     "unsubscribe service service1._test._tcp",
+                                     "unsubscribe host host1",
+                                 }));
+}
+
+TEST(MdnsPublisher, SubscribeReplaysCachedAnswersToNewSubscriberOnly)
+{
+    FakePublisher publisher;
+    int           instanceCounts[2] = {0, 0};
+    int           hostCounts[2]     = {0, 0};
+    uint64_t      subscriberIds[2];
+
+    for (int i = 0; i < 2; i++)
+    {
+        subscriberIds[i] = publisher.AddSubscriptionCallbacks(
+            [&instanceCounts, i](const std::string &aType, const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+                EXPECT_EQ(aType, "_test._tcp");
+                EXPECT_EQ(aInstanceInfo->mName, "service1");
+                instanceCounts[i]++;
+            },
+            [&hostCounts, i](const std::string &aHostName, const Publisher::DiscoveredHostInfoPtr &aHostInfo) {
+                EXPECT_EQ(aHostName, "host1");
+                EXPECT_EQ(aHostInfo->mAddresses.size(), 1u);
+                hostCounts[i]++;
+            });
+    }
+
+    publisher.SubscribeService("_test._tcp", "", subscriberIds[0]);
+    publisher.SubscribeHost("host1", subscriberIds[0]);
+    publisher.Resolve("_test._tcp", MakeInstanceInfo("service1"));
+    publisher.Resolve("host1", MakeHostInfo());
+    EXPECT_EQ(instanceCounts[0], 1);
+    EXPECT_EQ(instanceCounts[1], 1);
+    EXPECT_EQ(hostCounts[0], 1);
+    EXPECT_EQ(hostCounts[1], 1);
+
+    publisher.mEvents.clear();
+    publisher.SubscribeService("_test._tcp", "", subscriberIds[1]);
+    publisher.SubscribeHost("host1", subscriberIds[1]);
+    EXPECT_EQ(instanceCounts[1], 1);
+    EXPECT_EQ(hostCounts[1], 1);
+
+    ProcessMainloop();
+    EXPECT_TRUE(publisher.mEvents.empty());
+    EXPECT_EQ(instanceCounts[0], 1);
+    EXPECT_EQ(instanceCounts[1], 2);
+    EXPECT_EQ(hostCounts[0], 1);
+    EXPECT_EQ(hostCounts[1], 2);
+}
+
+TEST(MdnsPublisher, SubscribeRequeriesWithoutCachedAnswers)
+{
+    FakePublisher publisher;
+    uint64_t      subscriberId = publisher.AddSubscriptionCallbacks(nullptr, nullptr);
+
+    publisher.SubscribeService("_test._tcp", "service1", subscriberId);
+    publisher.SubscribeHost("host1", subscriberId);
+
+    // Nothing has been cached, so the mDNS implementation is queried again for the new subscribers.
+    publisher.SubscribeService("_test._tcp", "service1", subscriberId);
+    publisher.SubscribeHost("host1", subscriberId);
+
+    // A subscriber without ID can't receive cached answers.
+    publisher.Resolve("host1", MakeHostInfo());
+    publisher.SubscribeHost("host1");
+
+    EXPECT_EQ(publisher.mEvents, std::vector<std::string>({
+                                     "subscribe service service1._test._tcp",
+                                     "subscribe host host1",
+                                     "unsubscribe service service1._test._tcp",
+                                     "subscribe service service1._test._tcp",
+                                     "unsubscribe host host1",
+                                     "subscribe host host1",
+                                     "unsubscribe host host1",
+                                     "subscribe host host1",
+                                 }));
+}
+
+TEST(MdnsPublisher, RequeryKeepsSubscriptionReferences)
+{
+    FakePublisher publisher;
+
+    // Nothing is subscribed yet.
+    publisher.RequeryService("_test._tcp", "service1");
+    publisher.RequeryHost("host1");
+    EXPECT_TRUE(publisher.mEvents.empty());
+
+    publisher.SubscribeService("_test._tcp", "service1");
+    publisher.SubscribeHost("host1");
+    publisher.RequeryService("_test._tcp", "service1");
+    publisher.RequeryHost("host1");
+    publisher.UnsubscribeService("_test._tcp", "service1");
+    publisher.UnsubscribeHost("host1");
+
+    // The requeries didn't add references, so the subscriptions are stopped by the single unsubscriptions.
+    publisher.RequeryService("_test._tcp", "service1");
+    publisher.RequeryHost("host1");
+
+    EXPECT_EQ(publisher.mEvents, std::vector<std::string>({
+                                     "subscribe service service1._test._tcp",
+                                     "subscribe host host1",
+                                     "unsubscribe service service1._test._tcp",
+                                     "subscribe service service1._test._tcp",
+                                     "unsubscribe host host1",
+                                     "subscribe host host1",
+                                     "unsubscribe service service1._test._tcp",
+                                     "unsubscribe host host1",
+                                 }));
+}
+
+TEST(MdnsPublisher, NameKeyMatchesBothFormsOfName)
+{
+    using NameKey = FakePublisher::NameKey;
+
+    const std::string fullName     = "ins._srv._udp";
+    const std::string instanceName = "ins";
+    const std::string type         = "_srv._udp";
+    const std::string otherType    = "_srv._tcp";
+    const std::string emptyType    = "";
+
+    std::unordered_map<NameKey, int, NameKey::Hash> map;
+
+    EXPECT_TRUE(NameKey(fullName) == NameKey(instanceName, type));
+    EXPECT_TRUE(NameKey(instanceName, type) == NameKey(fullName));
+    EXPECT_EQ(NameKey::Hash()(NameKey(fullName)), NameKey::Hash()(NameKey(instanceName, type)));
+
+    EXPECT_FALSE(NameKey(fullName) == NameKey(instanceName, otherType));
+    EXPECT_FALSE(NameKey(instanceName) == NameKey(instanceName, emptyType));
+    EXPECT_FALSE(NameKey(instanceName) == NameKey(fullName));
+
+    // A key made of a name and a type is found by the full name, and vice versa.
+    map.emplace(NameKey(instanceName, type), 1);
+    map.emplace(NameKey(instanceName), 2);
+    EXPECT_EQ(map.size(), 2u);
+    ASSERT_NE(map.find(NameKey(fullName)), map.end());
+    EXPECT_EQ(map.find(NameKey(fullName))->second, 1);
+    EXPECT_EQ(map.find(NameKey(instanceName))->second, 2);
+    EXPECT_EQ(map.find(NameKey(instanceName, otherType)), map.end());
+
+    map.clear();
+    map.emplace(NameKey(fullName), 3);
+    EXPECT_EQ(map.count(NameKey(instanceName, type)), 1u);
+}
@@ -31,6 +31,7 @@
 #include <netinet/in.h>
 #include <signal.h>
 
+#include <algorithm>
 #include <set>
 #include <vector>
 
@@ -61,12 +62,11 @@ int RunMainloopUntilTimeout(int aSeconds)
         FD_ZERO(&mainloop.mErrorFdSet);
 
         MainloopManager::GetInstance().Update(mainloop);
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      (mainloop.mTimeout.tv_sec == INT_MAX ? nullptr : &mainloop.mTimeout));
+        rval = MainloopManager::GetInstance().Poll(mainloop);
 
         if (rval < 0)
         {
-            perror("select");
+            perror("poll");
             break;
         }
 
@@ -197,9 +197,10 @@ TEST_F(MdnsTest, SubscribeHost)
 
     pub->AddSubscriptionCallbacks(
         nullptr,
-        [&lastHostName, &lastHostInfo](const std::string &aHostName, const Publisher::DiscoveredHostInfo &aHostInfo) {
+        [&lastHostName, &lastHostInfo](const std::string                      &aHostName,
+                                       const Publisher::DiscoveredHostInfoPtr &aHostInfo) {
             lastHostName = aHostName;
-            lastHostInfo = aHostInfo;
+            lastHostInfo = *aHostInfo;
         });
     pub->SubscribeHost("host1");
 
@@ -235,10 +236,10 @@ TEST_F(MdnsTest, SubscribeServiceInstance)
     };
 
     pub->AddSubscriptionCallbacks(
-        [&lastServiceType, &lastInstanceInfo](const std::string                &aType,
-                                              Publisher::DiscoveredInstanceInfo aInstanceInfo) {
+        [&lastServiceType, &lastInstanceInfo](const std::string                          &aType,
+                                              const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
             lastServiceType  = aType;
-            lastInstanceInfo = aInstanceInfo;
+            lastInstanceInfo = *aInstanceInfo;
         },
         nullptr);
     pub->SubscribeService("_test._tcp", "service1");
@@ -275,10 +276,10 @@ TEST_F(MdnsTest, SubscribeServiceType)
     };
 
     pub->AddSubscriptionCallbacks(
-        [&lastServiceType, &lastInstanceInfo](const std::string                &aType,
-                                              Publisher::DiscoveredInstanceInfo aInstanceInfo) {
+        [&lastServiceType, &lastInstanceInfo](const std::string                          &aType,
+                                              const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
             lastServiceType  = aType;
-            lastInstanceInfo = aInstanceInfo;
+            lastInstanceInfo = *aInstanceInfo;
         },
         nullptr);
     pub->SubscribeService("_test._tcp", "");
@@ -325,3 +326,220 @@ TEST_F(MdnsTest, SubscribeServiceType)
     CheckServiceInstanceAdded(lastInstanceInfo, "host2.local.", {sAddr4}, "service3", 44444, {});
     clearLastInstance();
 }
+
+TEST_F(MdnsTest, SubscriptionCallbacksFilterServiceType)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+    std::vector<std::string>   matchedTypes;
+    std::vector<std::string>   otherTypes;
+
+    pub->AddSubscriptionCallbacks(
+        [&matchedTypes](const std::string &aType, const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+            OTBR_UNUSED_VARIABLE(aInstanceInfo);
+            matchedTypes.push_back(aType);
+        },
+        nullptr, "_TEST._tcp");
+    pub->AddSubscriptionCallbacks(
+        [&otherTypes](const std::string &aType, const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+            OTBR_UNUSED_VARIABLE(aInstanceInfo);
+            otherTypes.push_back(aType);
+        },
+        nullptr, "_other._tcp");
+    pub->SubscribeService("_test._tcp", "");
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1}, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 11111, sTxtData1, NoOpCallback());
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+
+    EXPECT_FALSE(matchedTypes.empty());
+    EXPECT_TRUE(otherTypes.empty());
+}
+
+TEST_F(MdnsTest, PublishBatch)
+{
+    std::unique_ptr<Publisher>        pub = CreatePublisher();
+    std::string                       lastServiceType;
+    Publisher::DiscoveredInstanceInfo lastInstanceInfo{};
+    Publisher::Batch                  batch;
+    int                               callbackCount = 0;
+    std::vector<otbrError>            lastErrors;
+
+    pub->AddSubscriptionCallbacks(
+        [&lastServiceType, &lastInstanceInfo](const std::string                          &aType,
+                                              const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+            lastServiceType  = aType;
+            lastInstanceInfo = *aInstanceInfo;
+        },
+        nullptr);
+    pub->SubscribeService("_test._tcp", "service1");
+
+    batch.PublishService("host1", "service1", "_test._tcp", Publisher::SubTypeList{"_sub1"}, 11111, sTxtData1);
+    batch.PublishHost("host1", Publisher::AddressList{sAddr1, sAddr2});
+    batch.UnpublishService("service2", "_test._tcp");
+    EXPECT_EQ(batch.GetSize(), 3u);
+
+    pub->PublishBatch(std::move(batch), [&callbackCount, &lastErrors](otbrError                     aError,
+                                                                      const std::vector<otbrError> &aErrors) {
+        EXPECT_EQ(aError, OTBR_ERROR_NONE);
+        callbackCount++;
+        lastErrors = aErrors;
+    });
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_EQ(callbackCount, 1);
+    EXPECT_EQ(lastErrors, std::vector<otbrError>(3, OTBR_ERROR_NONE));
+    EXPECT_EQ(pub->GetMdnsOperationStats().mServiceRegistrationLatency.mCount, 1u);
+    EXPECT_EQ(pub->GetMdnsOperationStats().mHostRegistrationLatency.mCount, 1u);
+    EXPECT_EQ("_test._tcp", lastServiceType);
+    CheckServiceInstanceAdded(lastInstanceInfo, "host1.local.", {sAddr1, sAddr2}, "service1", 11111, sTxtData1);
+
+    callbackCount = 0;
+    pub->PublishBatch(Publisher::Batch(), [&callbackCount](otbrError aError, const std::vector<otbrError> &aErrors) {
+        EXPECT_EQ(aError, OTBR_ERROR_NONE);
+        EXPECT_TRUE(aErrors.empty());
+        callbackCount++;
+    });
+    EXPECT_EQ(callbackCount, 1);
+}
+
+TEST_F(MdnsTest, SubscribeServiceInstanceReplaysCachedResult)
+{
+    std::unique_ptr<Publisher>        pub = CreatePublisher();
+    std::string                       lastServiceType;
+    Publisher::DiscoveredInstanceInfo lastInstanceInfo{};
+    int                               firstCallbackCount = 0;
+    uint64_t                          subscriberId;
+
+    pub->AddSubscriptionCallbacks(
+        [&firstCallbackCount](const std::string &aType, const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+            OTBR_UNUSED_VARIABLE(aType);
+            OTBR_UNUSED_VARIABLE(aInstanceInfo);
+            firstCallbackCount++;
+        },
+        nullptr);
+    subscriberId = pub->AddSubscriptionCallbacks(
+        [&lastServiceType, &lastInstanceInfo](const std::string                          &aType,
+                                              const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+            lastServiceType  = aType;
+            lastInstanceInfo = *aInstanceInfo;
+        },
+        nullptr);
+    pub->SubscribeService("_test._tcp", "service1");
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1}, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 11111, sTxtData1, NoOpCallback());
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_EQ("_test._tcp", lastServiceType);
+    lastServiceType    = "";
+    lastInstanceInfo   = {};
+    firstCallbackCount = 0;
+
+    // The second subscription is answered from the cache right away, and only to the new subscriber.
+    pub->SubscribeService("_test._tcp", "service1", subscriberId);
+    RunMainloopUntilTimeout(0);
+    EXPECT_EQ("_test._tcp", lastServiceType);
+    CheckServiceInstanceAdded(lastInstanceInfo, "host1.local.", {sAddr1}, "service1", 11111, sTxtData1);
+    EXPECT_EQ(firstCallbackCount, 0);
+
+    pub->UnsubscribeService("_test._tcp", "service1");
+    pub->UnsubscribeService("_test._tcp", "service1");
+}
+
+TEST_F(MdnsTest, CoalesceServiceUpdatesWithinWindow)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+    std::vector<uint16_t>      discoveredPorts;
+    std::vector<otbrError>     updateErrors;
+
+    pub->SetUpdateCoalescingWindow(Milliseconds(2000));
+    pub->AddSubscriptionCallbacks(
+        [&discoveredPorts](const std::string &aType, const Publisher::DiscoveredInstanceInfoPtr &aInstanceInfo) {
+            OTBR_UNUSED_VARIABLE(aType);
+            if (!aInstanceInfo->mRemoved)
+            {
+                discoveredPorts.push_back(aInstanceInfo->mPort);
+            }
+        },
+        nullptr);
+    pub->SubscribeService("_test._tcp", "service1");
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1}, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 11111, sTxtData1, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 22222, sTxtData1,
+                        [&updateErrors](otbrError aError) { updateErrors.push_back(aError); });
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 33333, sTxtData1,
+                        [&updateErrors](otbrError aError) { updateErrors.push_back(aError); });
+    EXPECT_TRUE(updateErrors.empty());
+    EXPECT_EQ(pub->GetMdnsOperationStats().mCoalescedRegistrationUpdates, 1u);
+
+    RunMainloopUntilTimeout(2 * kTimeoutSeconds);
+
+    EXPECT_EQ(updateErrors, std::vector<otbrError>({OTBR_ERROR_NONE, OTBR_ERROR_NONE}));
+    ASSERT_FALSE(discoveredPorts.empty());
+    EXPECT_EQ(discoveredPorts.back(), 33333);
+    EXPECT_EQ(std::count(discoveredPorts.begin(), discoveredPorts.end(), 22222), 0);
+}
+
+TEST_F(MdnsTest, UnpublishAbortsDeferredUpdate)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+    std::vector<otbrError>     updateErrors;
+
+    pub->SetUpdateCoalescingWindow(Milliseconds(2000));
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1}, NoOpCallback());
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1, sAddr2},
+                     [&updateErrors](otbrError aError) { updateErrors.push_back(aError); });
+    EXPECT_TRUE(updateErrors.empty());
+
+    pub->UnpublishHost("host1", NoOpCallback());
+    EXPECT_EQ(updateErrors, std::vector<otbrError>({OTBR_ERROR_ABORTED}));
+
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_EQ(updateErrors.size(), 1u);
+}
+
+TEST_F(MdnsTest, ReportsRegisteredHostsAndServices)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+
+    EXPECT_FALSE(pub->IsHostRegistered("host1"));
+    EXPECT_FALSE(pub->IsServiceRegistered("service1", "_test._tcp"));
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1}, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 11111, sTxtData1, NoOpCallback());
+    EXPECT_TRUE(pub->IsHostRegistered("host1"));
+    EXPECT_TRUE(pub->IsServiceRegistered("service1", "_test._tcp"));
+    EXPECT_FALSE(pub->IsServiceRegistered("service1", "_test._udp"));
+
+    pub->UnpublishService("service1", "_test._tcp", NoOpCallback());
+    EXPECT_TRUE(pub->IsHostRegistered("host1"));
+    EXPECT_FALSE(pub->IsServiceRegistered("service1", "_test._tcp"));
+
+    // The registrations are dropped when the publisher stops.
+    pub->Stop();
+    EXPECT_FALSE(pub->IsHostRegistered("host1"));
+}
+
+TEST_F(MdnsTest, StopAbortsDeferredUpdates)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+    std::vector<otbrError>     updateErrors;
+
+    pub->SetUpdateCoalescingWindow(Milliseconds(2000));
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1}, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 11111, sTxtData1, NoOpCallback());
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1, sAddr2},
+                     [&updateErrors](otbrError aError) { updateErrors.push_back(aError); });
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 22222, sTxtData1,
+                        [&updateErrors](otbrError aError) { updateErrors.push_back(aError); });
+    EXPECT_TRUE(updateErrors.empty());
+
+    pub->Stop();
+    EXPECT_EQ(updateErrors, std::vector<otbrError>({OTBR_ERROR_ABORTED, OTBR_ERROR_ABORTED}));
+
+    // The aborted updates are not applied to the restarted publisher.
+    EXPECT_EQ(pub->Start(), OTBR_ERROR_NONE);
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_EQ(updateErrors.size(), 2u);
+}
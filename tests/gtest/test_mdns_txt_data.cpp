@@ -0,0 +1,99 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "mdns/mdns.hpp"
+
+using namespace otbr::Mdns;
+
+TEST(MdnsTxtData, EncoderAndIteratorRoundTrip)
+{
+    const uint8_t              value[] = {0x01, 0x02, 0x03};
+    Publisher::TxtData         txtData;
+    Publisher::TxtDataEncoder  encoder(txtData);
+    Publisher::TxtEntryView    entry;
+    Publisher::TxtDataIterator iterator(nullptr, 0);
+
+    EXPECT_EQ(encoder.AppendEntry("key", value, sizeof(value)), OTBR_ERROR_NONE);
+    EXPECT_EQ(encoder.AppendEntry("nn", "OpenThread"), OTBR_ERROR_NONE);
+    EXPECT_EQ(encoder.AppendBooleanAttribute("flag"), OTBR_ERROR_NONE);
+    encoder.Finish();
+
+    iterator = Publisher::TxtDataIterator(txtData.data(), txtData.size());
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.KeyEquals("KEY"));
+    EXPECT_FALSE(entry.KeyEquals("ke"));
+    EXPECT_FALSE(entry.mIsBooleanAttribute);
+    ASSERT_EQ(entry.mValueLength, sizeof(value));
+    EXPECT_EQ(memcmp(entry.mValue, value, sizeof(value)), 0);
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.KeyEquals("nn"));
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(entry.mValue), entry.mValueLength), "OpenThread");
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.KeyEquals("flag"));
+    EXPECT_TRUE(entry.mIsBooleanAttribute);
+    EXPECT_EQ(entry.mValueLength, 0);
+
+    EXPECT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NOT_FOUND);
+}
+
+TEST(MdnsTxtData, EncoderWritesSingleZeroByteWhenEmpty)
+{
+    Publisher::TxtData        txtData = {1, 2, 3};
+    Publisher::TxtDataEncoder encoder(txtData);
+
+    encoder.Finish();
+    EXPECT_EQ(txtData, Publisher::TxtData({0}));
+}
+
+TEST(MdnsTxtData, EncoderRejectsOversizedEntry)
+{
+    Publisher::TxtData        txtData;
+    Publisher::TxtDataEncoder encoder(txtData);
+    std::vector<uint8_t>      value(255, 'x');
+
+    EXPECT_EQ(encoder.AppendEntry("key", value.data(), value.size()), OTBR_ERROR_INVALID_ARGS);
+}
+
+TEST(MdnsTxtData, IteratorRejectsTruncatedData)
+{
+    const uint8_t              txtData[] = {5, 'a', '=', 'b'};
+    Publisher::TxtDataIterator iterator(txtData, sizeof(txtData));
+    Publisher::TxtEntryView    entry;
+
+    EXPECT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_PARSE);
+}
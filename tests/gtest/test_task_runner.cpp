@@ -27,6 +27,7 @@
  */
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -136,6 +137,62 @@ TEST(TaskRunner, TestMultipleThreads)
     EXPECT_EQ(10, counter.load());
 }
 
+TEST(TaskRunner, TestMultipleThreadsKeepPostingOrder)
+{
+    constexpr int            kNumThreads        = 4;
+    constexpr int            kNumTasksPerThread = 10000;
+    int                      executed           = 0;
+    int                      lastSeq[kNumThreads];
+    bool                     ordered = true;
+    otbr::TaskRunner         taskRunner;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < kNumThreads; ++i)
+    {
+        lastSeq[i] = -1;
+        threads.emplace_back([&, i]() {
+            for (int seq = 0; seq < kNumTasksPerThread; ++seq)
+            {
+                taskRunner.Post([&, i, seq]() {
+                    ordered    = ordered && (lastSeq[i] + 1 == seq);
+                    lastSeq[i] = seq;
+                    ++executed;
+                });
+            }
+        });
+    }
+
+    while (executed < kNumThreads * kNumTasksPerThread)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {10, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+
+        // A lost wakeup would time out here.
+        ASSERT_EQ(1, rval);
+
+        taskRunner.Process(mainloop);
+    }
+
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(kNumThreads * kNumTasksPerThread, executed);
+}
+
 TEST(TaskRunner, TestPostAndWait)
 {
     std::atomic<int>         total{0};
@@ -251,6 +308,43 @@ TEST(TaskRunner, TestDelayedTasksOrder)
     EXPECT_STREQ("bac", str.c_str());
 }
 
+TEST(TaskRunner, TestDelayedTasksWithSlackShareWakeup)
+{
+    std::string      str;
+    otbr::TaskRunner taskRunner;
+
+    // The mainloop sleeps until the deadline of 'c', which is the earliest latest-deadline,
+    // and then executes 'a' and 'b' in the same wakeup.
+    taskRunner.Post(
+        std::chrono::milliseconds(10), [&]() { str.push_back('a'); }, std::chrono::milliseconds(40));
+    taskRunner.Post(
+        std::chrono::milliseconds(20), [&]() { str.push_back('b'); }, std::chrono::milliseconds(40));
+    taskRunner.Post(std::chrono::milliseconds(30), [&]() { str.push_back('c'); });
+
+    while (str.size() < 3)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+        taskRunner.Process(mainloop);
+    }
+
+    EXPECT_STREQ("abc", str.c_str());
+    EXPECT_EQ(1u, taskRunner.GetWakeupCount());
+}
+
 TEST(TaskRunner, TestCancelDelayedTasks)
 {
     std::string              str;
@@ -306,6 +400,29 @@ TEST(TaskRunner, TestCancelDelayedTasks)
     t.join();
 }
 
+TEST(TaskRunner, TestCancelReleasesTaskImmediately)
+{
+    otbr::TaskRunner         taskRunner;
+    auto                     captured = std::make_shared<int>(0);
+    otbr::TaskRunner::TaskId tid1, tid2, tid3;
+
+    tid1 = taskRunner.Post(std::chrono::milliseconds(100000), [captured]() { ++*captured; });
+    tid2 = taskRunner.Post(std::chrono::milliseconds(200000), [captured]() { ++*captured; });
+    tid3 = taskRunner.Post(std::chrono::milliseconds(300000), [captured]() { ++*captured; });
+    EXPECT_EQ(captured.use_count(), 4);
+
+    // Cancelled tasks must not hold their captured state until the deadline.
+    taskRunner.Cancel(tid2);
+    EXPECT_EQ(captured.use_count(), 3);
+    taskRunner.Cancel(tid1);
+    taskRunner.Cancel(tid3);
+    EXPECT_EQ(captured.use_count(), 1);
+
+    // Cancelling a task twice is a no-op.
+    taskRunner.Cancel(tid2);
+    EXPECT_EQ(*captured, 0);
+}
+
 TEST(TaskRunner, TestAllAPIs)
 {
     std::atomic<int>         counter{0};
@@ -0,0 +1,114 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "common/mainloop_manager.hpp"
+#include "common/worker_pool.hpp"
+
+using otbr::MainloopContext;
+using otbr::MainloopManager;
+using otbr::WorkerPool;
+
+static void RunMainloopOnce(void)
+{
+    MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {1, 0};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    MainloopManager::GetInstance().Update(mainloop);
+    ASSERT_GE(MainloopManager::GetInstance().Poll(mainloop), 0);
+    MainloopManager::GetInstance().Process(mainloop);
+}
+
+TEST(WorkerPool, DeliversResultsOfSequenceInOrderOnMainloop)
+{
+    WorkerPool             pool(2);
+    WorkerPool::SequenceId sequence       = pool.CreateSequence();
+    std::thread::id        mainloopThread = std::this_thread::get_id();
+    std::vector<int>       results;
+    std::atomic<int>       running{0};
+    std::atomic<bool>      overlapped{false};
+
+    for (int i = 0; i < 5; i++)
+    {
+        pool.Post<int>(
+            sequence,
+            [i, &running, &overlapped]() {
+                overlapped = overlapped || running.fetch_add(1) != 0;
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                running.fetch_sub(1);
+                return i;
+            },
+            [&results, mainloopThread](int aResult) {
+                EXPECT_EQ(std::this_thread::get_id(), mainloopThread);
+                results.push_back(aResult);
+            });
+    }
+
+    while (results.size() < 5)
+    {
+        RunMainloopOnce();
+    }
+
+    EXPECT_EQ(results, std::vector<int>({0, 1, 2, 3, 4}));
+    EXPECT_FALSE(overlapped.load());
+}
+
+TEST(WorkerPool, DropsResultsOfReleasedSequence)
+{
+    WorkerPool             pool(1);
+    WorkerPool::SequenceId released = pool.CreateSequence();
+    WorkerPool::SequenceId alive    = pool.CreateSequence();
+    std::atomic<int>       workCount{0};
+    int                    resultCount = 0;
+
+    pool.Post<int>(
+        released, [&workCount]() { return ++workCount; }, [&resultCount](int) { ++resultCount; });
+    pool.ReleaseSequence(released);
+    pool.Post<int>(
+        alive, [&workCount]() { return ++workCount; }, [&resultCount](int) { ++resultCount; });
+
+    while (workCount.load() < 2 || resultCount < 1)
+    {
+        RunMainloopOnce();
+    }
+
+    // The work of the released sequence still runs, but only the alive sequence gets its result.
+    EXPECT_EQ(workCount.load(), 2);
+    EXPECT_EQ(resultCount, 1);
+}